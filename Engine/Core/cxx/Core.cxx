@@ -13,6 +13,12 @@
 #include "../src/Core/States/PrepareState.cpp"
 #include "../src/Core/States/SceneUpdateState.cpp"
 #include "../src/Core/States/DeltaTimeState.cpp"
+#include "../src/Core/States/EngineThreadState.cpp"
+#include "../src/Core/States/SyncThreadState.cpp"
+#include "../src/Core/States/PhysicsSimulationState.cpp"
+#include "../src/Core/States/PhysicsSynchronizationState.cpp"
+#include "../src/Core/States/ChunkInstantiateState.cpp"
+#include "../src/Core/States/FramePacingState.cpp"
 
 #include "../src/Core/Common/Importers.cpp"
 
@@ -37,5 +43,11 @@
 #include "../src/Core/EngineMigrators.cpp"
 
 #include "../src/Core/Tests/TestManager.cpp"
-
-#include "../src/Core/Utils/GraphicsResourceReloader.cpp"
\ No newline at end of file
+#include "../src/Core/Tests/Benchmark.cpp"
+
+#include "../src/Core/Utils/GraphicsResourceReloader.cpp"
+#include "../src/Core/Utils/ThreadStateSync.cpp"
+#include "../src/Core/Utils/FramePacer.cpp"
+#include "../src/Core/Utils/StateTimings.cpp"
+#include "../src/Core/Utils/JobSystem.cpp"
+#include "../src/Core/Utils/InputRecorder.cpp"
\ No newline at end of file
@@ -30,6 +30,21 @@ namespace SR_CORE_NS {
         virtual bool InitializeResourcesFolder(int argc, char** argv);
 
         SR_NODISCARD const SR_UTILS_NS::Path& GetResourcesPath() const { return m_resourcesPath; }
+        /// no window, no render context and no editor, see "--headless"
+        SR_NODISCARD bool IsHeadless() const { return m_isHeadless; }
+        /// headless run of a fixed number of frames, see "--benchmark" and Benchmark
+        SR_NODISCARD bool IsBenchmark() const { return m_isBenchmark; }
+        SR_NODISCARD uint32_t GetTickRate() const { return m_tickRate; }
+        SR_NODISCARD const SR_UTILS_NS::Path& GetStartupScene() const { return m_startupScene; }
+        void SetStartupScene(const SR_UTILS_NS::Path& path) { m_startupScene = path; }
+        /// ".csv" or ".json" file the state timings are written to on close, see "--state-timings"
+        SR_NODISCARD const SR_UTILS_NS::Path& GetStateTimingsPath() const { return m_stateTimingsPath; }
+        /// ".csv" file the samples of the physics scene are written to on close, see "--physics-stats"
+        SR_NODISCARD const SR_UTILS_NS::Path& GetPhysicsStatisticsPath() const { return m_physicsStatisticsPath; }
+        /// see "--record-input", "--replay-input" and "--locked-dt"
+        SR_NODISCARD const SR_UTILS_NS::Path& GetRecordInputPath() const { return m_recordInputPath; }
+        SR_NODISCARD const SR_UTILS_NS::Path& GetReplayInputPath() const { return m_replayInputPath; }
+        SR_NODISCARD float_t GetLockedDeltaTime() const { return m_lockedDeltaTime; }
 
     private:
         bool InitResourceTypes();
@@ -46,6 +61,17 @@ namespace SR_CORE_NS {
         /// @property
         std::atomic<bool> m_isNeedReload = false;
 
+        bool m_isHeadless = false;
+        bool m_isBenchmark = false;
+        uint32_t m_tickRate = 30;
+        SR_UTILS_NS::Path m_startupScene;
+        SR_UTILS_NS::Path m_stateTimingsPath;
+        SR_UTILS_NS::Path m_physicsStatisticsPath;
+        SR_UTILS_NS::Path m_recordInputPath;
+        SR_UTILS_NS::Path m_replayInputPath;
+        /// seconds, zero means the recorded delta time is used
+        float_t m_lockedDeltaTime = 0.f;
+
         SR_HTYPES_NS::SharedPtr<Engine> m_engine;
 
     };
@@ -18,6 +18,10 @@
 #include <Utils/TaskManager/ThreadWorker.h>
 
 #include <Core/EvoScriptAPI.h>
+#include <Core/Utils/ThreadStateSync.h>
+#include <Core/Utils/FramePacer.h>
+#include <Core/Utils/StateTimings.h>
+#include <Core/Utils/JobSystem.h>
 #include <Core/EngineCommands.h>
 #include <Core/EngineResources.h>
 #include <Utils/Types/SafeQueue.h>
@@ -65,7 +69,9 @@ namespace SR_CORE_NS {
         explicit Engine(Application* pApplication);
         ~Engine();
 
+        /// Blocks until something happens with the engine, the frames are driven by the threads worker.
         SR_NODISCARD bool Execute();
+        void WakeUp();
 
         void Reload();
 
@@ -97,7 +103,13 @@ namespace SR_CORE_NS {
         SR_NODISCARD SR_CORE_GUI_NS::EditorGUI* GetEditor() const { return m_editor; }
         SR_NODISCARD SR_UTILS_NS::CmdManager* GetCmdManager() const { return m_cmdManager; }
         SR_NODISCARD EngineScene* GetEngineScene() const { return m_engineScene; }
+        SR_NODISCARD ThreadStateSync* GetThreadStateSync() const { return m_threadStateSync; }
+        SR_NODISCARD FramePacer* GetFramePacer() const { return m_framePacer; }
+        SR_NODISCARD StateTimings* GetStateTimings() const { return m_stateTimings; }
+        SR_NODISCARD JobSystem* GetJobSystem() const { return m_jobSystem; }
         SR_NODISCARD bool IsApplicationFocused() const;
+        SR_NODISCARD Application* GetApplication() const { return m_application; }
+        SR_NODISCARD bool IsHeadless() const;
 
     public:
         bool Create();
@@ -126,6 +138,14 @@ namespace SR_CORE_NS {
         SR_UTILS_NS::TimePointType m_timeStart;
 
         SR_UTILS_NS::ThreadsWorker::Ptr m_threadsWorker = nullptr;
+        ThreadStateSync* m_threadStateSync = nullptr;
+        FramePacer* m_framePacer = nullptr;
+        StateTimings* m_stateTimings = nullptr;
+        JobSystem* m_jobSystem = nullptr;
+
+        std::mutex m_executeMutex;
+        std::condition_variable m_executeCondition;
+        bool m_executeWakeUp = false;
 
         SR_UTILS_NS::CmdManager* m_cmdManager  = nullptr;
         SR_UTILS_NS::InputDispatcher* m_input = nullptr;
@@ -0,0 +1,23 @@
+//
+// Created by agent on 18.10.2026.
+//
+
+#ifndef SR_ENGINE_CORE_CHUNK_INSTANTIATE_STATE_H
+#define SR_ENGINE_CORE_CHUNK_INSTANTIATE_STATE_H
+
+#include <Core/States/SyncThreadState.h>
+
+namespace SR_CORE_NS {
+    class ChunkInstantiateState : public SyncThreadState {
+        SR_REGISTER_THREAD_STATE(ChunkInstantiateState)
+        using Super = SyncThreadState;
+    public:
+        SR_UTILS_NS::ThreadWorkerResult ExecuteSynced() override;
+
+    protected:
+        SR_NODISCARD std::string GetStateName() const override { return "ChunkInstantiate"; }
+
+    };
+}
+
+#endif //SR_ENGINE_CORE_CHUNK_INSTANTIATE_STATE_H
@@ -5,15 +5,19 @@
 #ifndef SR_ENGINE_CORE_CHUNK_SYSTEM_STATE_H
 #define SR_ENGINE_CORE_CHUNK_SYSTEM_STATE_H
 
-#include <Utils/TaskManager/ThreadWorker.h>
+#include <Core/States/SyncThreadState.h>
+
 #include <Utils/Types/Timer.h>
 
 namespace SR_CORE_NS {
-    class ChunkSystemState : public SR_UTILS_NS::ThreadWorkerStateBase {
+    class ChunkSystemState : public SyncThreadState {
         SR_REGISTER_THREAD_STATE(ChunkSystemState)
-        using Super = SR_UTILS_NS::ThreadWorkerStateBase;
+        using Super = SyncThreadState;
     public:
-        SR_UTILS_NS::ThreadWorkerResult ExecuteImpl() override;
+        SR_UTILS_NS::ThreadWorkerResult ExecuteSynced() override;
+
+    protected:
+        SR_NODISCARD std::string GetStateName() const override { return "ChunkSystem"; }
 
     private:
         SR_HTYPES_NS::Timer m_worldTimer;
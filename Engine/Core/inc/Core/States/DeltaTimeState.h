@@ -5,15 +5,18 @@
 #ifndef SR_ENGINE_CORE_DELTA_TIME_STATE_H
 #define SR_ENGINE_CORE_DELTA_TIME_STATE_H
 
-#include <Utils/TaskManager/ThreadWorker.h>
+#include <Core/States/EngineThreadState.h>
 #include <Utils/Types/Time.h>
 
 namespace SR_CORE_NS {
-    class DeltaTimeState : public SR_UTILS_NS::ThreadWorkerStateBase {
+    class DeltaTimeState : public EngineThreadState {
         SR_REGISTER_THREAD_STATE(DeltaTimeState)
-        using Super = SR_UTILS_NS::ThreadWorkerStateBase;
+        using Super = EngineThreadState;
     public:
-        SR_UTILS_NS::ThreadWorkerResult ExecuteImpl() override;
+        SR_UTILS_NS::ThreadWorkerResult ExecuteState() override;
+
+    protected:
+        SR_NODISCARD std::string GetStateName() const override { return "DeltaTime"; }
 
     private:
         std::optional<SR_UTILS_NS::TimePointType> m_timeStart;
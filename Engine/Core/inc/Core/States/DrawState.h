@@ -5,14 +5,18 @@
 #ifndef SR_ENGINE_CORE_DRAW_STATE_H
 #define SR_ENGINE_CORE_DRAW_STATE_H
 
-#include <Utils/TaskManager/ThreadWorker.h>
+#include <Core/States/SyncThreadState.h>
 
 namespace SR_CORE_NS {
-    class DrawState : public SR_UTILS_NS::ThreadWorkerStateBase {
+    class DrawState : public SyncThreadState {
         SR_REGISTER_THREAD_STATE(DrawState)
-        using Super = SR_UTILS_NS::ThreadWorkerStateBase;
+        using Super = SyncThreadState;
     public:
-        SR_UTILS_NS::ThreadWorkerResult ExecuteImpl() override;
+        SR_UTILS_NS::ThreadWorkerResult ExecuteSynced() override;
+
+    protected:
+        SR_NODISCARD std::string GetStateName() const override { return "Draw"; }
+        SR_NODISCARD bool IsProducer() const override { return true; }
 
     };
 }
@@ -0,0 +1,39 @@
+//
+// Created by agent on 18.10.2026.
+//
+
+#ifndef SR_ENGINE_CORE_ENGINE_THREAD_STATE_H
+#define SR_ENGINE_CORE_ENGINE_THREAD_STATE_H
+
+#include <Utils/TaskManager/ThreadWorker.h>
+
+namespace SR_CORE_NS {
+    class StateTimingBuffer;
+
+    /// Base for all engine states, measures every execution into the engine state timings.
+    class EngineThreadState : public SR_UTILS_NS::ThreadWorkerStateBase {
+        using Super = SR_UTILS_NS::ThreadWorkerStateBase;
+    public:
+        using Super::Super;
+
+    public:
+        SR_UTILS_NS::ThreadWorkerResult ExecuteImpl() final;
+
+    protected:
+        virtual SR_UTILS_NS::ThreadWorkerResult ExecuteState() = 0;
+
+        /// name of the state in Threads.yml
+        SR_NODISCARD virtual std::string GetStateName() const = 0;
+
+        /// time spent waiting for other threads, it is measured separately from the work
+        void AddWaitTime(double_t milliseconds) { m_waitTime += milliseconds; }
+
+    private:
+        StateTimingBuffer* m_timings = nullptr;
+        StateTimingBuffer* m_waitTimings = nullptr;
+        double_t m_waitTime = 0.0;
+
+    };
+}
+
+#endif //SR_ENGINE_CORE_ENGINE_THREAD_STATE_H
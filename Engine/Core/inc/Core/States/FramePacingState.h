@@ -0,0 +1,23 @@
+//
+// Created by agent on 18.10.2026.
+//
+
+#ifndef SR_ENGINE_CORE_FRAME_PACING_STATE_H
+#define SR_ENGINE_CORE_FRAME_PACING_STATE_H
+
+#include <Core/States/EngineThreadState.h>
+
+namespace SR_CORE_NS {
+    class FramePacingState : public EngineThreadState {
+        SR_REGISTER_THREAD_STATE(FramePacingState)
+        using Super = EngineThreadState;
+    public:
+        SR_UTILS_NS::ThreadWorkerResult ExecuteState() override;
+
+    protected:
+        SR_NODISCARD std::string GetStateName() const override { return "FramePacing"; }
+
+    };
+}
+
+#endif //SR_ENGINE_CORE_FRAME_PACING_STATE_H
@@ -5,16 +5,19 @@
 #ifndef SR_ENGINE_CORE_INITIALIZE_STATE_H
 #define SR_ENGINE_CORE_INITIALIZE_STATE_H
 
-#include <Utils/TaskManager/ThreadWorker.h>
+#include <Core/States/EngineThreadState.h>
 
 namespace SR_CORE_NS {
-    class InitializeState : public SR_UTILS_NS::ThreadWorkerStateBase {
+    class InitializeState : public EngineThreadState {
         SR_REGISTER_THREAD_STATE(InitializeState)
-        using Super = SR_UTILS_NS::ThreadWorkerStateBase;
+        using Super = EngineThreadState;
     public:
-        SR_UTILS_NS::ThreadWorkerResult ExecuteImpl() override;
+        SR_UTILS_NS::ThreadWorkerResult ExecuteState() override;
         void FinalizeImpl() override;
 
+    protected:
+        SR_NODISCARD std::string GetStateName() const override { return "Initialize"; }
+
     private:
         bool m_isInitialized = false;
 
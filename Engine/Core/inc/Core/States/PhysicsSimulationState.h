@@ -0,0 +1,24 @@
+//
+// Created by agent on 18.10.2026.
+//
+
+#ifndef SR_ENGINE_CORE_PHYSICS_SIMULATION_STATE_H
+#define SR_ENGINE_CORE_PHYSICS_SIMULATION_STATE_H
+
+#include <Core/States/SyncThreadState.h>
+
+namespace SR_CORE_NS {
+    class PhysicsSimulationState : public SyncThreadState {
+        SR_REGISTER_THREAD_STATE(PhysicsSimulationState)
+        using Super = SyncThreadState;
+    public:
+        SR_UTILS_NS::ThreadWorkerResult ExecuteSynced() override;
+
+    protected:
+        SR_NODISCARD std::string GetStateName() const override { return "PhysicsSimulation"; }
+        SR_NODISCARD bool IsProducer() const override { return true; }
+
+    };
+}
+
+#endif //SR_ENGINE_CORE_PHYSICS_SIMULATION_STATE_H
@@ -5,14 +5,17 @@
 #ifndef SR_ENGINE_CORE_SCENE_UPDATE_STATE_H
 #define SR_ENGINE_CORE_SCENE_UPDATE_STATE_H
 
-#include <Utils/TaskManager/ThreadWorker.h>
+#include <Core/States/SyncThreadState.h>
 
 namespace SR_CORE_NS {
-    class SceneUpdateState : public SR_UTILS_NS::ThreadWorkerStateBase {
+    class SceneUpdateState : public SyncThreadState {
         SR_REGISTER_THREAD_STATE(SceneUpdateState)
-        using Super = SR_UTILS_NS::ThreadWorkerStateBase;
+        using Super = SyncThreadState;
     public:
-        SR_UTILS_NS::ThreadWorkerResult ExecuteImpl() override;
+        SR_UTILS_NS::ThreadWorkerResult ExecuteSynced() override;
+
+    protected:
+        SR_NODISCARD std::string GetStateName() const override { return "SceneUpdate"; }
 
     };
 }
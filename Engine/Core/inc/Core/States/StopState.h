@@ -5,14 +5,17 @@
 #ifndef SR_ENGINE_CORE_STOP_STATE_H
 #define SR_ENGINE_CORE_STOP_STATE_H
 
-#include <Utils/TaskManager/ThreadWorker.h>
+#include <Core/States/EngineThreadState.h>
 
 namespace SR_CORE_NS {
-    class StopState : public SR_UTILS_NS::ThreadWorkerStateBase {
+    class StopState : public EngineThreadState {
         SR_REGISTER_THREAD_STATE(StopState)
-        using Super = SR_UTILS_NS::ThreadWorkerStateBase;
+        using Super = EngineThreadState;
     public:
-        SR_UTILS_NS::ThreadWorkerResult ExecuteImpl() override;
+        SR_UTILS_NS::ThreadWorkerResult ExecuteState() override;
+
+    protected:
+        SR_NODISCARD std::string GetStateName() const override { return "Stop"; }
 
     };
 }
@@ -5,14 +5,20 @@
 #ifndef SR_ENGINE_CORE_SUBMIT_STATE_H
 #define SR_ENGINE_CORE_SUBMIT_STATE_H
 
-#include <Utils/TaskManager/ThreadWorker.h>
+#include <Core/States/SyncThreadState.h>
 
 namespace SR_CORE_NS {
-    class SubmitState : public SR_UTILS_NS::ThreadWorkerStateBase {
+    class SubmitState : public SyncThreadState {
         SR_REGISTER_THREAD_STATE(SubmitState)
-        using Super = SR_UTILS_NS::ThreadWorkerStateBase;
+        using Super = SyncThreadState;
     public:
-        SR_UTILS_NS::ThreadWorkerResult ExecuteImpl() override;
+        SR_UTILS_NS::ThreadWorkerResult ExecuteSynced() override;
+
+    protected:
+        SR_NODISCARD std::string GetStateName() const override { return "Submit"; }
+
+    private:
+        bool m_isContextAttached = false;
 
     };
 }
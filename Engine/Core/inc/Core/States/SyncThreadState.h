@@ -0,0 +1,47 @@
+//
+// Created by agent on 18.10.2026.
+//
+
+#ifndef SR_ENGINE_CORE_SYNC_THREAD_STATE_H
+#define SR_ENGINE_CORE_SYNC_THREAD_STATE_H
+
+#include <Core/States/EngineThreadState.h>
+#include <Core/Utils/ThreadStateSync.h>
+
+namespace SR_CORE_NS {
+    /**
+     * Base for the states that exchange data with states on other threads.
+     * Conditions are "start_condition" and "finish_condition" of the state in Threads.yml,
+     * a state overrides them only to adjust a condition at runtime.
+     */
+    class SyncThreadState : public EngineThreadState {
+        using Super = EngineThreadState;
+    public:
+        using Condition = ThreadStateSync::Condition;
+
+    public:
+        using Super::Super;
+
+    public:
+        SR_UTILS_NS::ThreadWorkerResult ExecuteState() final;
+
+    protected:
+        virtual SR_UTILS_NS::ThreadWorkerResult ExecuteSynced() = 0;
+        /// Runs before the start condition, the state is not busy yet, so ThreadStateSync::Pause() can be used here.
+        virtual void ExecuteBeforeSync() { }
+
+        SR_NODISCARD virtual Condition GetStartCondition();
+        SR_NODISCARD virtual Condition GetFinishCondition();
+        /// producer will not start again until the previous result is consumed
+        SR_NODISCARD virtual bool IsProducer() const { return false; }
+
+        /// if false, the iteration did not produce anything and consumers will not be woken up
+        void SetProduced(bool produced) { m_produced = produced; }
+
+    private:
+        bool m_produced = true;
+
+    };
+}
+
+#endif //SR_ENGINE_CORE_SYNC_THREAD_STATE_H
@@ -0,0 +1,97 @@
+//
+// Created by agent on 18.10.2026.
+//
+
+#ifndef SR_ENGINE_CORE_BENCHMARK_H
+#define SR_ENGINE_CORE_BENCHMARK_H
+
+#include <Utils/Common/Singleton.h>
+#include <Utils/FileSystem/Path.h>
+
+#include <Core/Utils/StateTimings.h>
+
+namespace SR_CORE_NS {
+    class Engine;
+
+    /**
+     * Runs a scene for a fixed number of frames after a warmup, see TestManager::RunBenchmark().
+     *
+     *  --benchmark <name or scene>   name from Engine/Configs/Benchmarks.xml or a path to a scene
+     *  --frames <N> --warmup <M>     measured and skipped frames
+     *  --benchmark-report <file>     JSON report, Cache/Benchmarks/<name>.json by default
+     *  --benchmark-baseline <file>   XML baseline, Engine/Benchmarks/<name>.xml by default
+     *  --benchmark-margin <ratio>    allowed regression over the baseline, 0.1 is 10%
+     *  --benchmark-save-baseline     overwrites the baseline with the results of this run
+     */
+    class Benchmark : public SR_UTILS_NS::Singleton<Benchmark> {
+        SR_REGISTER_SINGLETON(Benchmark)
+        using Clock = std::chrono::steady_clock;
+    public:
+        struct Metric {
+            std::string name;
+            double_t value = 0.0;
+        };
+
+        static constexpr int32_t RegressionExitCode = 5;
+
+    public:
+        /// The resource manager has to be initialized, the benchmark list is a resource.
+        bool Configure(int argc, char** argv);
+
+        /// Marks the start of the loading, called before the engine is created.
+        void Begin();
+        /// Called once per frame by DeltaTimeState, returns true when all frames are measured.
+        SR_NODISCARD bool OnFrame(Engine* pEngine);
+
+        /// Writes the report and compares it with the baseline, returns the exit code of the application.
+        SR_NODISCARD int32_t Finish();
+
+        SR_NODISCARD bool IsActive() const noexcept { return m_isActive; }
+        SR_NODISCARD const SR_UTILS_NS::Path& GetScenePath() const noexcept { return m_scenePath; }
+        SR_NODISCARD uint32_t GetFrames() const noexcept { return m_frames; }
+
+        bool IsSingletonCanBeDestroyed() const override { return false; }
+
+    private:
+        void CollectPhysics(Engine* pEngine);
+        void Collect(StateTimings* pTimings);
+
+        bool WriteReport(const std::vector<std::string>& regressions) const;
+        bool SaveBaseline() const;
+        /// Returns the descriptions of the metrics that are worse than the baseline by more than the margin.
+        SR_NODISCARD std::vector<std::string> CompareWithBaseline() const;
+
+        SR_NODISCARD static uint64_t GetPeakMemoryUsage();
+
+    private:
+        std::string m_name;
+        SR_UTILS_NS::Path m_scenePath;
+        SR_UTILS_NS::Path m_reportPath;
+        SR_UTILS_NS::Path m_baselinePath;
+
+        uint32_t m_frames = 600;
+        uint32_t m_warmup = 120;
+        double_t m_margin = 0.1;
+        bool m_saveBaseline = false;
+
+        bool m_isActive = false;
+        bool m_isCollected = false;
+
+        uint32_t m_frame = 0;
+        Clock::time_point m_loadStart;
+        Clock::time_point m_lastFrame;
+        double_t m_loadTime = 0.0;
+        /// milliseconds of the measured frames
+        std::vector<double_t> m_frameTimes;
+        /// milliseconds of simulate and fetch of each physics step, the history of the scene is shorter than the run
+        std::vector<double_t> m_physicsStepTimes;
+        uint64_t m_physicsCursor = 0;
+
+        std::vector<StateTimingSummary> m_states;
+        /// compared with the baseline
+        std::vector<Metric> m_metrics;
+
+    };
+}
+
+#endif //SR_ENGINE_CORE_BENCHMARK_H
@@ -19,6 +19,8 @@ namespace SR_CORE_NS {
         void AddEngineTest(const TestFn& test, const std::string& name) { m_engineTests.insert(std::make_pair(name, test)); }
 
         void RunAll(int argc, char** argv);
+        /// Boots the engine headless, runs the benchmark scene and returns the exit code, see Benchmark.
+        int32_t RunBenchmark(int argc, char** argv);
 
         bool IsSingletonCanBeDestroyed() const override { return false; }
 
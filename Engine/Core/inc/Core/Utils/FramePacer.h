@@ -0,0 +1,72 @@
+//
+// Created by agent on 18.10.2026.
+//
+
+#ifndef SR_ENGINE_CORE_FRAME_PACER_H
+#define SR_ENGINE_CORE_FRAME_PACER_H
+
+#include <Utils/Common/NonCopyable.h>
+#include <Utils/Common/Enumerations.h>
+#include <Utils/FileSystem/Path.h>
+
+namespace SR_CORE_NS {
+    SR_ENUM_NS_CLASS_T(FramePacingMode, uint8_t,
+        Uncapped,  /// frames are not limited at all
+        FixedFPS,  /// sleep most of the frame, spin the rest to hit the target precisely
+        VSync      /// present blocks on the display refresh, the pacer only measures
+    )
+
+    struct FramePacingStats {
+        /// last frame, milliseconds
+        double_t frameTime = 0.0;
+        double_t slept = 0.0;
+        double_t spun = 0.0;
+
+        /// since the pacer was created, milliseconds
+        double_t totalSlept = 0.0;
+        double_t totalSpun = 0.0;
+        uint64_t frames = 0;
+    };
+
+    class FramePacer : public SR_UTILS_NS::NonCopyable {
+        using Clock = std::chrono::steady_clock;
+    public:
+        FramePacer() = default;
+        ~FramePacer() override = default;
+
+    public:
+        /// Loads "Engine/Configs/FramePacing.xml", keeps the defaults if the file does not exist.
+        bool Load(const SR_UTILS_NS::Path& path);
+
+        /// Blocks until the next frame has to start. Called once per frame by the engine thread.
+        void WaitForNextFrame();
+
+        void SetMode(FramePacingMode mode);
+        void SetTargetFPS(uint32_t fps);
+        void SetSpinThreshold(double_t milliseconds);
+
+        SR_NODISCARD FramePacingMode GetMode() const;
+        SR_NODISCARD uint32_t GetTargetFPS() const;
+        SR_NODISCARD FramePacingStats GetStats() const;
+
+        /// Returns true once after the mode was switched to or from VSync, vsync of the pipeline has to be switched.
+        /// Otherwise the vsync of the pipeline is left as the user has set it.
+        SR_NODISCARD bool ConsumeVSyncChanged();
+
+    private:
+        mutable std::mutex m_mutex;
+
+        FramePacingMode m_mode = FramePacingMode::FixedFPS;
+        uint32_t m_targetFPS = 144;
+        /// the OS scheduler can oversleep by a few ms, the last part of the frame is spun
+        double_t m_spinThreshold = 2.0;
+        bool m_vsyncChanged = false;
+
+        std::optional<Clock::time_point> m_frameStart;
+
+        FramePacingStats m_stats;
+
+    };
+}
+
+#endif //SR_ENGINE_CORE_FRAME_PACER_H
@@ -0,0 +1,132 @@
+//
+// Created by agent on 18.10.2026.
+//
+
+#ifndef SR_ENGINE_CORE_INPUT_RECORDER_H
+#define SR_ENGINE_CORE_INPUT_RECORDER_H
+
+#include <Utils/Common/Singleton.h>
+#include <Utils/Input/InputSystem.h>
+#include <Utils/Input/InputHandler.h>
+#include <Utils/FileSystem/Path.h>
+
+namespace SR_CORE_NS {
+    SR_ENUM_NS_CLASS_T(InputRecorderMode, uint8_t,
+        None, Record, Replay
+    );
+
+    SR_ENUM_NS_CLASS_T(InputEventType, uint8_t,
+        KeyDown, KeyPress, KeyUp, MouseDown, MouseUp, MouseMove, Scroll
+    );
+
+    struct InputEvent {
+        InputEventType type = InputEventType::KeyDown;
+        uint8_t code = 0;
+        /// cursor position of the mouse events
+        SR_MATH_NS::FVector2 position;
+        /// drag of MouseMove, offset of Scroll
+        SR_MATH_NS::FVector2 value;
+    };
+
+    /**
+     * Records the delta time and the input events into a compact binary log and plays them back.
+     *
+     * Recording: the recorder is an input handler of the InputDispatcher, so it stores the same events
+     * the handlers receive (keys, mouse buttons and motion), and the scroll of the window callback.
+     * The events are grouped by input ticks, a tick is one Engine::FixedUpdate() call.
+     *
+     * Replay: the live input is not checked, every tick dispatches the recorded events to the registered handlers
+     * and the polled state (keys, buttons, drag, wheel) is built from them. Core reads the polled input through
+     * the getters below, they forward to SR_UTILS_NS::Input when nothing is replayed.
+     *
+     * Format: "SRIR", uint32 version, then for every frame:
+     *   float dt, uint16 ticks, for every tick: uint16 events, for every event: uint8 type, uint8 code,
+     *   [float x, float y position of mouse events], [float x, float y drag of MouseMove or offset of Scroll]
+     */
+    class InputRecorder : public SR_UTILS_NS::Singleton<InputRecorder>, public SR_UTILS_NS::InputHandler {
+        SR_REGISTER_SINGLETON(InputRecorder)
+        static constexpr uint32_t Version = 2;
+        static constexpr uint32_t KeysCount = 256;
+        using Keys = std::bitset<KeysCount>;
+        using Tick = std::vector<InputEvent>;
+    public:
+        bool StartRecording(const SR_UTILS_NS::Path& path);
+        /// If lockedDeltaTime is positive, it is used instead of the recorded delta time.
+        bool StartReplay(const SR_UTILS_NS::Path& path, float_t lockedDeltaTime);
+        void Stop();
+
+        /// handlers receive the replayed events, nothing is dispatched while recording
+        void Register(SR_UTILS_NS::InputHandler* pHandler);
+        void Unregister(SR_UTILS_NS::InputHandler* pHandler);
+
+        /// Called once per frame by DeltaTimeState, returns the delta time the frame has to use.
+        SR_NODISCARD float_t OnFrame(float_t dt);
+        /// Called once per Engine::FixedUpdate() after the input is checked, or instead of the check while replaying.
+        void OnTick();
+        void OnScroll(double_t x, double_t y);
+
+        SR_NODISCARD InputRecorderMode GetMode() const noexcept { return m_mode; }
+        SR_NODISCARD bool IsReplaying() const noexcept { return m_mode == InputRecorderMode::Replay; }
+        /// the log is over, the engine can be stopped
+        SR_NODISCARD bool IsFinished() const noexcept { return m_isFinished; }
+        SR_NODISCARD uint64_t GetFrame() const noexcept { return m_frame; }
+
+        SR_NODISCARD bool GetKey(SR_UTILS_NS::KeyCode key) const;
+        SR_NODISCARD bool GetKeyDown(SR_UTILS_NS::KeyCode key) const;
+        SR_NODISCARD bool GetKeyUp(SR_UTILS_NS::KeyCode key) const;
+
+        SR_NODISCARD bool GetMouse(SR_UTILS_NS::MouseCode code) const;
+        SR_NODISCARD bool GetMouseDown(SR_UTILS_NS::MouseCode code) const;
+        SR_NODISCARD bool GetMouseUp(SR_UTILS_NS::MouseCode code) const;
+        SR_NODISCARD SR_MATH_NS::FVector2 GetMouseDrag() const;
+        SR_NODISCARD int32_t GetMouseWheel() const;
+
+        void OnMouseMove(const SR_UTILS_NS::MouseInputData* data) override;
+        void OnMouseDown(const SR_UTILS_NS::MouseInputData* data) override;
+        void OnMouseUp(const SR_UTILS_NS::MouseInputData* data) override;
+        void OnKeyDown(const SR_UTILS_NS::KeyboardInputData* data) override;
+        void OnKeyPress(const SR_UTILS_NS::KeyboardInputData* data) override;
+        void OnKeyUp(const SR_UTILS_NS::KeyboardInputData* data) override;
+
+    private:
+        void RecordEvent(const InputEvent& event);
+        void WriteFrame();
+        SR_NODISCARD bool ReadFrame(float_t& dt);
+        void ApplyTick(const Tick& tick);
+        void DispatchTick(const Tick& tick) const;
+
+    private:
+        mutable std::mutex m_mutex;
+
+        InputRecorderMode m_mode = InputRecorderMode::None;
+
+        std::ofstream m_output;
+        std::ifstream m_input;
+
+        std::vector<SR_UTILS_NS::InputHandler*> m_handlers;
+
+        /// recording: the ticks of the frame, written by the next OnFrame() with its delta time
+        /// replay: the ticks of the current frame, OnTick() takes them in order
+        std::vector<Tick> m_ticks;
+        Tick m_tick;
+        uint32_t m_tickIndex = 0;
+        std::optional<float_t> m_frameDeltaTime;
+
+        /// polled state of the replayed tick
+        Keys m_keys;
+        Keys m_keysDown;
+        Keys m_keysUp;
+        uint8_t m_mouse = 0;
+        uint8_t m_mouseDown = 0;
+        uint8_t m_mouseUp = 0;
+        SR_MATH_NS::FVector2 m_mouseDrag;
+        float_t m_mouseWheel = 0.f;
+
+        float_t m_lockedDeltaTime = 0.f;
+        uint64_t m_frame = 0;
+        bool m_isFinished = false;
+
+    };
+}
+
+#endif //SR_ENGINE_CORE_INPUT_RECORDER_H
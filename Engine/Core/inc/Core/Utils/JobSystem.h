@@ -0,0 +1,100 @@
+//
+// Created by agent on 18.10.2026.
+//
+
+#ifndef SR_ENGINE_CORE_JOB_SYSTEM_H
+#define SR_ENGINE_CORE_JOB_SYSTEM_H
+
+#include <Utils/Common/NonCopyable.h>
+#include <Utils/Types/Thread.h>
+
+namespace SR_CORE_NS {
+    /**
+     * Work-stealing job system. Every worker owns a queue, takes jobs from its back
+     * and steals from the front of the other queues when it is empty.
+     * Threads that are not workers push to a shared queue and help to execute jobs while waiting.
+     */
+    class JobSystem : public SR_UTILS_NS::NonCopyable {
+    public:
+        using Job = std::function<void()>;
+
+        class Counter : public SR_UTILS_NS::NonCopyable {
+            friend class JobSystem;
+        public:
+            SR_NODISCARD bool IsDone() const noexcept { return m_pending.load(std::memory_order_acquire) == 0; }
+
+        private:
+            std::atomic<uint32_t> m_pending = 0;
+
+        };
+
+    public:
+        explicit JobSystem(uint32_t workers);
+        ~JobSystem() override;
+
+    public:
+        /// Leaves cores for the engine, physics and submit threads.
+        SR_NODISCARD static uint32_t GetDefaultWorkersCount();
+
+        SR_NODISCARD uint32_t GetWorkersCount() const noexcept { return static_cast<uint32_t>(m_threads.size()); }
+
+        void Schedule(Job job, Counter* pCounter = nullptr);
+        /// Executes pending jobs on the calling thread until the counter is done.
+        void Wait(const Counter& counter);
+
+        /// Calls function(begin, end) for batches of [0, count), the first batch runs on the calling thread.
+        template<typename Function> void ParallelFor(uint32_t count, uint32_t batchSize, Function&& function);
+
+    private:
+        struct Task {
+            Job job;
+            Counter* pCounter = nullptr;
+        };
+
+        struct Queue {
+            std::mutex mutex;
+            std::deque<Task> tasks;
+        };
+
+        void WorkerLoop(uint32_t index);
+        bool TryExecute(uint32_t index);
+        bool TryPop(uint32_t index, Task& task);
+        void Execute(Task& task);
+
+    private:
+        /// one queue per worker and the last one is shared by the other threads
+        std::vector<std::unique_ptr<Queue>> m_queues;
+        std::vector<SR_HTYPES_NS::Thread::Ptr> m_threads;
+
+        std::mutex m_sleepMutex;
+        std::condition_variable m_sleepCondition;
+
+        std::atomic<uint32_t> m_queued = 0;
+        std::atomic<bool> m_stopped = false;
+
+    };
+
+    template<typename Function> void JobSystem::ParallelFor(uint32_t count, uint32_t batchSize, Function&& function) {
+        batchSize = SR_MAX(batchSize, 1u);
+
+        if (count <= batchSize || m_threads.empty()) {
+            if (count > 0) {
+                function(0u, count);
+            }
+            return;
+        }
+
+        Counter counter;
+
+        for (uint32_t begin = batchSize; begin < count; begin += batchSize) {
+            const uint32_t end = SR_MIN(begin + batchSize, count);
+            Schedule([&function, begin, end]() { function(begin, end); }, &counter);
+        }
+
+        function(0u, batchSize);
+
+        Wait(counter);
+    }
+}
+
+#endif //SR_ENGINE_CORE_JOB_SYSTEM_H
@@ -0,0 +1,75 @@
+//
+// Created by agent on 18.10.2026.
+//
+
+#ifndef SR_ENGINE_CORE_STATE_TIMINGS_H
+#define SR_ENGINE_CORE_STATE_TIMINGS_H
+
+#include <Utils/Common/NonCopyable.h>
+#include <Utils/FileSystem/Path.h>
+
+namespace SR_CORE_NS {
+    struct StateTimingSummary {
+        std::string name;
+        uint64_t samples = 0;
+        /// milliseconds over the rolling window
+        double_t last = 0.0;
+        double_t p50 = 0.0;
+        double_t p95 = 0.0;
+        double_t p99 = 0.0;
+        double_t max = 0.0;
+    };
+
+    /// Quotes, backslashes and control characters of a value written into a JSON string.
+    SR_NODISCARD std::string EscapeJSON(const std::string& value);
+
+    /// Ring buffer of the last execution times of one state. Single writer, any number of readers, no locks.
+    class StateTimingBuffer : public SR_UTILS_NS::NonCopyable {
+    public:
+        static constexpr uint32_t DefaultCapacity = 512;
+
+    public:
+        explicit StateTimingBuffer(uint32_t capacity = DefaultCapacity);
+
+    public:
+        void Push(double_t milliseconds) noexcept;
+        /// Drops the collected samples. A sample pushed at the same time may survive.
+        void Reset() noexcept;
+
+        SR_NODISCARD StateTimingSummary Summarize() const;
+
+    private:
+        std::unique_ptr<std::atomic<float_t>[]> m_samples;
+        uint32_t m_capacity = 0;
+        std::atomic<uint64_t> m_count = 0;
+
+    };
+
+    class StateTimings : public SR_UTILS_NS::NonCopyable {
+    public:
+        /// The capacity of the buffers is fixed, the benchmark needs a window as large as the measured frames.
+        explicit StateTimings(uint32_t capacity = StateTimingBuffer::DefaultCapacity);
+        ~StateTimings() override = default;
+
+    public:
+        /// The returned buffer lives as long as this object, states cache it.
+        SR_NODISCARD StateTimingBuffer* GetBuffer(const std::string& name);
+
+        SR_NODISCARD std::vector<StateTimingSummary> Summarize() const;
+        SR_NODISCARD std::optional<StateTimingSummary> Summarize(const std::string& name) const;
+
+        void Reset();
+
+        bool DumpCSV(const SR_UTILS_NS::Path& path) const;
+        bool DumpJSON(const SR_UTILS_NS::Path& path) const;
+
+    private:
+        mutable std::mutex m_mutex;
+        uint32_t m_capacity = 0;
+        /// std::map never moves its values, pointers to the buffers stay valid
+        std::map<std::string, StateTimingBuffer, std::less<>> m_buffers;
+
+    };
+}
+
+#endif //SR_ENGINE_CORE_STATE_TIMINGS_H
@@ -0,0 +1,91 @@
+//
+// Created by agent on 18.10.2026.
+//
+
+#ifndef SR_ENGINE_CORE_THREAD_STATE_SYNC_H
+#define SR_ENGINE_CORE_THREAD_STATE_SYNC_H
+
+#include <Utils/Common/NonCopyable.h>
+#include <Utils/FileSystem/Path.h>
+
+namespace SR_CORE_NS {
+    /**
+     * Ready/idle handshake between thread worker states that run on different threads.
+     *  - "ready" means the state has produced a result that nobody has consumed yet;
+     *  - "idle" means the state is not executing right now.
+     * A state that lists another state in its "ready" condition consumes that result on start.
+     * A state listed in the "consumed" condition must not have a result that is still waiting for its consumer.
+     * Conditions are read from "start_condition" and "finish_condition" of the states in Threads.yml.
+     */
+    class ThreadStateSync : public SR_UTILS_NS::NonCopyable {
+    public:
+        using Names = std::vector<std::string>;
+        using Milliseconds = std::chrono::milliseconds;
+
+        struct Condition {
+            Names ready;
+            Names idle;
+            Names consumed;
+            /// negative means "wait until the condition is met or the sync is stopped"
+            Milliseconds timeout = Milliseconds(-1);
+
+            SR_NODISCARD bool Empty() const noexcept { return ready.empty() && idle.empty() && consumed.empty(); }
+        };
+
+    public:
+        ThreadStateSync() = default;
+        ~ThreadStateSync() override = default;
+
+    public:
+        /// Reads the conditions of the states, the other keys of the file are parsed by ThreadsWorker.
+        bool LoadConditions(const SR_UTILS_NS::Path& path);
+
+        SR_NODISCARD Condition GetStartCondition(const std::string& name) const;
+        SR_NODISCARD Condition GetFinishCondition(const std::string& name) const;
+
+        /// Returns false if the state has to skip this iteration (timeout, pause or stop).
+        SR_NODISCARD bool Begin(const std::string& name, const Condition& condition, bool waitConsumed);
+        /// Marks the state as idle and, if "produced" is set, as ready. Then waits for the finish condition.
+        void End(const std::string& name, const Condition& condition, bool produced);
+
+        /// Blocks new iterations and waits until all states are idle.
+        void Pause();
+        void Resume();
+
+        /// Wakes up all waiting states, after that every Begin() fails.
+        void Stop();
+
+        SR_NODISCARD bool IsReady(const std::string& name) const;
+        SR_NODISCARD bool IsIdle(const std::string& name) const;
+
+    private:
+        struct StateInfo {
+            bool ready = false;
+            bool busy = false;
+        };
+
+        struct StateConditions {
+            Condition start;
+            Condition finish;
+        };
+
+        SR_NODISCARD bool IsMet(const Condition& condition) const;
+        SR_NODISCARD bool AllIdle() const;
+        SR_NODISCARD StateInfo& GetInfo(const std::string& name);
+
+        template<typename Predicate> bool Wait(std::unique_lock<std::mutex>& lock, Milliseconds timeout, Predicate&& predicate);
+
+    private:
+        mutable std::mutex m_mutex;
+        std::condition_variable m_condition;
+
+        std::map<std::string, StateInfo, std::less<>> m_states;
+        std::map<std::string, StateConditions, std::less<>> m_conditions;
+
+        bool m_paused = false;
+        bool m_stopped = false;
+
+    };
+}
+
+#endif //SR_ENGINE_CORE_THREAD_STATE_SYNC_H
@@ -14,6 +14,8 @@
 
 #include <Physics/PhysicsScene.h>
 
+#include <Core/Utils/StateTimings.h>
+
 namespace SR_CORE_NS {
     class Engine;
 
@@ -33,6 +35,9 @@ namespace SR_CORE_NS {
         SR_NODISCARD bool Init();
 
         SR_NODISCARD CameraPtr GetMainCamera() const { return pMainCamera; }
+        /// Part of the fixed step that is accumulated but not simulated yet, in [0, 1].
+        SR_NODISCARD float_t GetInterpolationAlpha() const noexcept { return m_interpolationAlpha; }
+        SR_NODISCARD float_t GetFixedStep() const noexcept { return m_fixedStep; }
 
         void SetActive(bool active);
         void SetPaused(bool pause);
@@ -45,8 +50,10 @@ namespace SR_CORE_NS {
         void UpdateChunkDebug();
 
     private:
+        bool LoadSimulationSettings(const SR_UTILS_NS::Path& path);
         void UpdateFrequency();
         void FixedStep(bool isPaused);
+        void PushScriptTime();
 
     public:
         ScenePtr pScene;
@@ -56,10 +63,18 @@ namespace SR_CORE_NS {
         CameraPtr pMainCamera;
         Engine* pEngine = nullptr;
 
+        /// time spent in the scene updater (behaviours and other components) during the current frame, milliseconds
+        double_t m_scriptTime = 0.0;
+        StateTimingBuffer* m_scriptTimings = nullptr;
+
         float_t m_speed = 1.f;
         float_t m_updateFrequency = 1.f;
         float_t m_accumulator = 1.f;
+        float_t m_fixedStep = 1.f / 60.f;
+        float_t m_interpolationAlpha = 0.f;
+        uint32_t m_maxSubSteps = 8;
         bool m_accumulateDt = false;
+        bool m_interpolation = true;
 
     };
 }
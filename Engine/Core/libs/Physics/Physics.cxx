@@ -10,19 +10,27 @@
 #include "src/Physics/CollisionShape.cpp"
 #include "src/Physics/PhysicsScene.cpp"
 #include "src/Physics/PhysicsWorld.cpp"
+#include "src/Physics/PhysicsStatistics.cpp"
 #include "src/Physics/PhysicsLib.cpp"
 #include "src/Physics/LibraryImpl.cpp"
 
 #include "src/Physics/3D/Rigidbody3D.cpp"
 #include "src/Physics/2D/Rigidbody2D.cpp"
+#include "src/Physics/2D/Raycast2D.cpp"
 #include "src/Physics/3D/Raycast3D.cpp"
+#include "src/Physics/3D/SceneQuery3D.cpp"
 #include "src/Physics/3D/Vehicle4W3D.cpp"
+#include "src/Physics/3D/CharacterController3D.cpp"
 
 #ifdef SR_PHYSICS_USE_BULLET3
     #include "src/Physics/Bullet3/Bullet3Rigidbody3D.cpp"
     #include "src/Physics/Bullet3/Bullet3LibraryImpl.cpp"
     #include "src/Physics/Bullet3/Bullet3PhysicsWorld.cpp"
     #include "src/Physics/Bullet3/Bullet3CollisionShape.cpp"
+    #include "src/Physics/Bullet3/Bullet3TaskScheduler.cpp"
+    #include "src/Physics/Bullet3/Bullet3ContactListener.cpp"
+    #include "src/Physics/Bullet3/Bullet3CharacterController3D.cpp"
+    #include "src/Physics/Bullet3/Bullet3Raycast3DImpl.cpp"
 #endif
 
 #ifdef SR_PHYSICS_USE_PHYSX
@@ -32,10 +40,20 @@
     #include "src/Physics/PhysX/PhysXRaycast3DImpl.cpp"
     #include "src/Physics/PhysX/PhysXMaterialImpl.cpp"
     #include "src/Physics/PhysX/PhysXCollisionShape.cpp"
+    #include "src/Physics/PhysX/PhysXMeshCache.cpp"
+    #include "src/Physics/PhysX/PhysXShapeCache.cpp"
+    #include "src/Physics/PhysX/PhysXJobDispatcher.cpp"
     #include "src/Physics/PhysX/PhysXSimulationCallback.cpp"
     #include "src/Physics/PhysX/PhysXVehicle4W3D.cpp"
+    #include "src/Physics/PhysX/PhysXChunkAggregates.cpp"
+    #include "src/Physics/PhysX/PhysXCharacterController3D.cpp"
 #endif
 
 #ifdef SR_PHYSICS_USE_BOX2D
     #include "src/Physics/Box2D/Box2DLibraryImpl.cpp"
+    #include "src/Physics/Box2D/Box2DPhysicsWorld.cpp"
+    #include "src/Physics/Box2D/Box2DRigidbody2D.cpp"
+    #include "src/Physics/Box2D/Box2DRaycast2DImpl.cpp"
+    #include "src/Physics/Box2D/Box2DCollisionShape.cpp"
+    #include "src/Physics/Box2D/Box2DContactListener.cpp"
 #endif
\ No newline at end of file
@@ -0,0 +1,31 @@
+//
+// Created by agent on 18.10.2026.
+//
+
+#ifndef SR_ENGINE_RAYCAST2D_H
+#define SR_ENGINE_RAYCAST2D_H
+
+#include <Physics/Raycast.h>
+#include <Utils/Math/Vector2.h>
+#include <Utils/Common/Singleton.h>
+
+namespace SR_PHYSICS_NS {
+    /// Rays in the XY plane of the 2D world, the hits have zero Z.
+    class Raycast2D final : public SR_UTILS_NS::Singleton<Raycast2D>, public Raycast {
+        SR_REGISTER_SINGLETON(Raycast2D)
+    public:
+        RaycastHits Cast(const SR_MATH_NS::FVector2& origin, const SR_MATH_NS::FVector2& direction, float_t maxDistance, uint32_t maxHits, const RaycastFilter& filter);
+        RaycastHits Cast(const SR_MATH_NS::FVector2& origin, const SR_MATH_NS::FVector2& direction, float_t maxDistance, uint32_t maxHits);
+        RaycastHits Cast(const SR_MATH_NS::FVector2& origin, const SR_MATH_NS::FVector2& direction, float_t maxDistance);
+
+        /// Line of sight check, returns true as soon as anything is hit.
+        bool CastAny(const SR_MATH_NS::FVector2& origin, const SR_MATH_NS::FVector2& direction, float_t maxDistance, const RaycastFilter& filter = RaycastFilter());
+
+        /// The same layer bits as the 3D ones, see Raycast3D::GetLayerMask().
+        SR_NODISCARD static uint32_t GetLayerMask(SR_UTILS_NS::StringAtom layer);
+        SR_NODISCARD static uint32_t GetCollisionLayerMask(SR_UTILS_NS::StringAtom layer);
+
+    };
+}
+
+#endif //SR_ENGINE_RAYCAST2D_H
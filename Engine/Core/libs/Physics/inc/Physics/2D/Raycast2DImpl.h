@@ -0,0 +1,28 @@
+//
+// Created by agent on 18.10.2026.
+//
+
+#ifndef SR_ENGINE_RAYCAST2DIMPL_H
+#define SR_ENGINE_RAYCAST2DIMPL_H
+
+#include <Physics/RaycastImpl.h>
+#include <Physics/Raycast.h>
+
+#include <Utils/Math/Vector2.h>
+
+namespace SR_PHYSICS_NS {
+    class Raycast2DImpl : public RaycastImpl {
+        using Super = RaycastImpl;
+    public:
+        explicit Raycast2DImpl(SR_PHYSICS_NS::PhysicsWorld* world)
+            : Super(world)
+        { }
+
+        /// Returns up to maxHits nearest hits sorted by distance.
+        virtual RaycastHits Cast(const SR_MATH_NS::FVector2& origin, const SR_MATH_NS::FVector2& direction, float_t maxDistance, uint32_t maxHits, const RaycastFilter& filter) = 0;
+        /// Stops at the first found hit, which is not necessarily the nearest one.
+        virtual bool CastAny(const SR_MATH_NS::FVector2& origin, const SR_MATH_NS::FVector2& direction, float_t maxDistance, const RaycastFilter& filter) = 0;
+    };
+}
+
+#endif //SR_ENGINE_RAYCAST2DIMPL_H
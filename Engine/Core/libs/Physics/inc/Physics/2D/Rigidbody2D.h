@@ -7,17 +7,52 @@
 
 #include <Physics/Rigidbody.h>
 
+#include <Utils/Math/Vector2.h>
+
 namespace SR_PTYPES_NS {
     class Rigidbody2DImpl : public RigidbodyImpl {
+        using Super = RigidbodyImpl;
+    public:
+        SR_NODISCARD virtual SR_MATH_NS::FVector2 GetLinearVelocity() const = 0;
+        /// Radians per second around Z.
+        SR_NODISCARD virtual float_t GetAngularVelocity() const = 0;
+
+        virtual void AddLinearVelocity(const SR_MATH_NS::FVector2& velocity) { }
+        virtual void AddAngularVelocity(float_t velocity) { }
+
+        virtual void SetLinearVelocity(const SR_MATH_NS::FVector2& velocity) { }
+        virtual void SetAngularVelocity(float_t velocity) { }
+
+        virtual void SetFixedRotation(bool fixedRotation) { }
 
     };
 
+    /// ----------------------------------------------------------------------------------------------------------------
+
     class Rigidbody2D : public Rigidbody {
         using Super = Rigidbody;
         SR_REGISTER_NEW_COMPONENT(Rigidbody2D, 1007);
     public:
         SR_NODISCARD SR_UTILS_NS::Measurement GetMeasurement() const override;
 
+        SR_NODISCARD bool IsFixedRotation() const noexcept { return m_fixedRotation; }
+
+        SR_NODISCARD SR_MATH_NS::FVector2 GetLinearVelocity() const;
+        SR_NODISCARD float_t GetAngularVelocity() const;
+
+        SR_NODISCARD bool InitializeEntity() noexcept override;
+
+        void SetFixedRotation(bool fixedRotation);
+
+        void AddLinearVelocity(const SR_MATH_NS::FVector2& velocity);
+        void AddAngularVelocity(float_t velocity);
+
+        void SetLinearVelocity(const SR_MATH_NS::FVector2& velocity);
+        void SetAngularVelocity(float_t velocity);
+
+    protected:
+        bool m_fixedRotation = false;
+
     };
 }
 
@@ -0,0 +1,177 @@
+//
+// Created by agent on 18.10.2026.
+//
+
+#ifndef SR_ENGINE_CHARACTER_CONTROLLER_3D_H
+#define SR_ENGINE_CHARACTER_CONTROLLER_3D_H
+
+#include <Physics/PhysicsLib.h>
+
+#include <Utils/ECS/ComponentManager.h>
+#include <Utils/ECS/Component.h>
+#include <Utils/Types/SafePointer.h>
+#include <Utils/Math/Vector3.h>
+
+namespace SR_PHYSICS_NS {
+    class PhysicsScene;
+    class PhysicsWorld;
+    class LibraryImpl;
+}
+
+namespace SR_PTYPES_NS {
+    class CharacterController3D;
+    class Rigidbody;
+
+    /// The controller of a backend, a capsule standing on its foot position. It is created in the world by Init().
+    class CharacterController3DImpl : public SR_UTILS_NS::NonCopyable {
+    protected:
+        using Super = SR_UTILS_NS::NonCopyable;
+        using LibraryPtr = SR_PHYSICS_NS::LibraryImpl*;
+        using PhysicsWorldPtr = SR_PHYSICS_NS::PhysicsWorld*;
+    public:
+        explicit CharacterController3DImpl(LibraryPtr pLibrary)
+            : Super()
+            , m_library(pLibrary)
+        { }
+
+    public:
+        SR_NODISCARD virtual void* GetHandle() const noexcept = 0;
+
+        void SetController(CharacterController3D* pController) { m_controller = pController; }
+
+        virtual bool Init(PhysicsWorldPtr pWorld) = 0;
+        virtual void DeInit() = 0;
+
+        /// Sweeps the capsule by the displacement, slides along the walls and climbs the steps.
+        /// PhysX moves at once, Bullet sets the velocity and the controller is moved by the step of the world.
+        virtual void Move(const SR_MATH_NS::FVector3& displacement, float_t step) = 0;
+
+        virtual void SetFootPosition(const SR_MATH_NS::FVector3& position) = 0;
+        SR_NODISCARD virtual SR_MATH_NS::FVector3 GetFootPosition() const = 0;
+
+        /// Takes the radius, the height, the slope limit and the step offset of the component.
+        virtual void UpdateShape() { }
+
+        /// Called by the world after its origin is moved, only the backends which don't move the controllers themselves need it.
+        virtual void ShiftOrigin(const SR_MATH_NS::FVector3& shift) { }
+
+        SR_NODISCARD bool IsGrounded() const noexcept { return m_isGrounded; }
+
+    protected:
+        CharacterController3D* m_controller = nullptr;
+        LibraryPtr m_library = nullptr;
+        PhysicsWorldPtr m_world = nullptr;
+        bool m_isGrounded = false;
+
+    };
+
+    /// ----------------------------------------------------------------------------------------------------------------
+
+    /**
+     * Kinematic capsule moved by the gameplay code instead of forces, see Move().
+     * The transform is at the feet of the character. The moves are queued and executed by the world
+     * for all its controllers at once before the step, the transforms are moved by the synchronization.
+     * Moving the transform directly teleports the controller.
+     * The touched rigidbodies are reported to the components of the game object by the collision events.
+     */
+    class CharacterController3D final : public SR_UTILS_NS::Component {
+        friend class SR_PHYSICS_NS::PhysicsScene;
+        using Super = SR_UTILS_NS::Component;
+        using LibraryPtr = SR_PHYSICS_NS::LibraryImpl*;
+        using PhysicsScenePtr = SR_HTYPES_NS::SafePtr<SR_PHYSICS_NS::PhysicsScene>;
+        SR_REGISTER_NEW_COMPONENT(CharacterController3D, 1000);
+    public:
+        ~CharacterController3D() override;
+
+    public:
+        SR_NODISCARD bool InitializeEntity() noexcept override;
+
+        /// Queued until the next step, the moves of a tick are summed up.
+        void Move(const SR_MATH_NS::FVector3& displacement);
+        /// Vertical speed of the gravity, a positive one makes a jump.
+        void SetVerticalVelocity(float_t velocity) { m_verticalVelocity = velocity; }
+
+        void SetRadius(float_t radius);
+        void SetHeight(float_t height);
+        void SetSlopeLimit(float_t degrees);
+        void SetStepOffset(float_t offset);
+        void SetUseGravity(bool enabled) { m_useGravity = enabled; }
+        void SetRideOnPlatforms(bool enabled) { m_rideOnPlatforms = enabled; }
+
+        SR_NODISCARD float_t GetRadius() const noexcept { return m_radius; }
+        /// Height of the cylindrical part of the capsule, the same as in PhysX.
+        SR_NODISCARD float_t GetHeight() const noexcept { return m_height; }
+        SR_NODISCARD float_t GetSlopeLimit() const noexcept { return m_slopeLimit; }
+        SR_NODISCARD float_t GetSlopeLimitRadians() const noexcept { return m_slopeLimit * static_cast<float_t>(SR_PI) / 180.f; }
+        SR_NODISCARD float_t GetStepOffset() const noexcept { return m_stepOffset; }
+        SR_NODISCARD bool IsUseGravity() const noexcept { return m_useGravity; }
+        SR_NODISCARD bool IsRideOnPlatforms() const noexcept { return m_rideOnPlatforms; }
+
+        /// The controller stood on the ground after the last synchronized step.
+        SR_NODISCARD bool IsGrounded() const noexcept { return m_isGrounded; }
+        SR_NODISCARD float_t GetVerticalVelocity() const noexcept { return m_verticalVelocity; }
+        /// The real speed of the steps since the previous synchronization, the walls and the platforms included.
+        SR_NODISCARD SR_MATH_NS::FVector3 GetVelocity() const noexcept { return m_velocity; }
+
+        SR_NODISCARD CharacterController3DImpl* GetImpl() const noexcept { return m_impl; }
+        SR_NODISCARD void* GetHandle() const noexcept;
+
+    public:
+        /// Used by the worlds: teleports the controller to the moved transform and executes the queued moves.
+        void PrepareMove(float_t step);
+        /// Used by the worlds: moves the transform to the controller and dispatches the collision events.
+        void Synchronize();
+        /// Used by the worlds: the simulated state is already shifted, the transform is shifted by the owner of the origin.
+        void ShiftOrigin(const SR_MATH_NS::FVector3& shift);
+
+        /// Used by the backends while moving, the first point of a rigidbody is kept.
+        void AddHit(Rigidbody* pRigidbody, const SR_MATH_NS::FVector3& point);
+        /// Drops the hits of the removed rigidbodies, they can be deleted after it.
+        void RemoveHits(const std::vector<Rigidbody*>& sortedRigidbodies);
+
+    protected:
+        void OnEnable() override;
+        void OnDisable() override;
+        void OnDestroy() override;
+
+        SR_NODISCARD const PhysicsScenePtr& GetPhysicsScene() const;
+
+    private:
+        void DispatchHits();
+
+    private:
+        CharacterController3DImpl* m_impl = nullptr;
+        LibraryPtr m_library = nullptr;
+
+        mutable PhysicsScenePtr m_physicsScene;
+
+        float_t m_radius = 0.5f;
+        float_t m_height = 1.f;
+        /// degrees
+        float_t m_slopeLimit = 45.f;
+        float_t m_stepOffset = 0.3f;
+
+        bool m_useGravity = true;
+        bool m_rideOnPlatforms = true;
+        bool m_hasCollisionEvents = true;
+        bool m_hasCollisionStayEvents = false;
+
+        bool m_isShapeDirty = true;
+        bool m_isGrounded = false;
+
+        SR_MATH_NS::FVector3 m_pendingDisplacement = SR_MATH_NS::FVector3(SR_MATH_NS::Unit(0));
+        float_t m_verticalVelocity = 0.f;
+        SR_MATH_NS::FVector3 m_velocity = SR_MATH_NS::FVector3(SR_MATH_NS::Unit(0));
+        /// the steps moved since the previous synchronization
+        float_t m_movedTime = 0.f;
+
+        /// the foot position at the last synchronization, a transform moved from it is a teleport
+        SR_MATH_NS::FVector3 m_synchronizedTranslation = SR_MATH_NS::InfinityFV3;
+
+        std::unordered_map<Rigidbody*, SR_MATH_NS::FVector3> m_hits;
+        std::unordered_map<Rigidbody*, SR_MATH_NS::FVector3> m_previousHits;
+
+    };
+}
+
+#endif //SR_ENGINE_CHARACTER_CONTROLLER_3D_H
@@ -6,6 +6,7 @@
 #define SR_ENGINE_RAYCAST3D_H
 
 #include <Physics/Raycast.h>
+#include <Physics/3D/SceneQuery3D.h>
 #include <Utils/Math/Vector3.h>
 #include <Utils/Common/Singleton.h>
 
@@ -13,8 +14,26 @@ namespace SR_PHYSICS_NS {
     class Raycast3D final : public SR_UTILS_NS::Singleton<Raycast3D>, public Raycast {
         SR_REGISTER_SINGLETON(Raycast3D)
     public:
+        RaycastHits Cast(const SR_MATH_NS::FVector3 &origin, const SR_MATH_NS::FVector3 &direction, float_t maxDistance, uint32_t maxHits, const RaycastFilter& filter);
         RaycastHits Cast(const SR_MATH_NS::FVector3 &origin, const SR_MATH_NS::FVector3 &direction, float_t maxDistance, uint32_t maxHits);
         RaycastHits Cast(const SR_MATH_NS::FVector3 &origin, const SR_MATH_NS::FVector3 &direction, float_t maxDistance);
+
+        /// Line of sight check, returns true as soon as anything is hit.
+        bool CastAny(const SR_MATH_NS::FVector3 &origin, const SR_MATH_NS::FVector3 &direction, float_t maxDistance, const RaycastFilter& filter = RaycastFilter());
+
+        /// Executes all queries of the batch, spread over the threads of the parallel for when it is set.
+        bool Execute(SceneQueryBatch3D& batch);
+
+        /// The engine sets it to the job system, queries are executed on the calling thread otherwise.
+        void SetParallelFor(SceneQueryParallelFor parallelFor) { m_parallelFor = std::move(parallelFor); }
+
+        SR_NODISCARD static uint32_t GetLayerMask(SR_UTILS_NS::StringAtom layer);
+        /// The layers the given layer collides with, the ray is filtered as a rigidbody of this layer.
+        SR_NODISCARD static uint32_t GetCollisionLayerMask(SR_UTILS_NS::StringAtom layer);
+
+    private:
+        SceneQueryParallelFor m_parallelFor;
+
     };
 }
 
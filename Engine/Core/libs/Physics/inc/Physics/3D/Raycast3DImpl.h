@@ -6,6 +6,8 @@
 #define SR_ENGINE_RAYCAST3DIMPL_H
 
 #include <Physics/RaycastImpl.h>
+#include <Physics/Raycast.h>
+#include <Physics/3D/SceneQuery3D.h>
 
 namespace SR_PHYSICS_NS {
     class Raycast3DImpl : public RaycastImpl{
@@ -15,7 +17,12 @@ namespace SR_PHYSICS_NS {
             : Super(world)
         { }
 
-        virtual RaycastHits Cast(const SR_MATH_NS::FVector3 &origin, const SR_MATH_NS::FVector3 &direction, float_t maxDistance, uint32_t maxHits) = 0;
+        /// Returns up to maxHits nearest hits sorted by distance.
+        virtual RaycastHits Cast(const SR_MATH_NS::FVector3 &origin, const SR_MATH_NS::FVector3 &direction, float_t maxDistance, uint32_t maxHits, const RaycastFilter& filter) = 0;
+        /// Stops at the first found hit, which is not necessarily the nearest one.
+        virtual bool CastAny(const SR_MATH_NS::FVector3 &origin, const SR_MATH_NS::FVector3 &direction, float_t maxDistance, const RaycastFilter& filter) = 0;
+        /// Fills the results of the batch, parallelFor is never empty.
+        virtual bool Execute(SceneQueryBatch3D& batch, const SceneQueryParallelFor& parallelFor) = 0;
     };
 }
 
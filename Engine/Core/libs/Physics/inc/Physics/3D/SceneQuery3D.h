@@ -0,0 +1,99 @@
+//
+// Created by agent on 18.10.2026.
+//
+
+#ifndef SR_ENGINE_PHYSICS_SCENE_QUERY_3D_H
+#define SR_ENGINE_PHYSICS_SCENE_QUERY_3D_H
+
+#include <Physics/Raycast.h>
+
+#include <Utils/Common/NonCopyable.h>
+#include <Utils/Math/Vector3.h>
+#include <Utils/Math/Quaternion.h>
+#include <Utils/Types/Function.h>
+
+namespace SR_PHYSICS_NS {
+    SR_ENUM_NS_CLASS_T(SceneQueryType, uint8_t,
+        Raycast,
+        Sweep,
+        Overlap
+    );
+
+    SR_ENUM_NS_CLASS_T(SceneQueryShape, uint8_t,
+        Sphere,
+        Capsule, /// along the Y axis
+        Box
+    );
+
+    struct SceneQueryGeometry {
+        SR_NODISCARD static SceneQueryGeometry Sphere(float_t radius);
+        SR_NODISCARD static SceneQueryGeometry Capsule(float_t radius, float_t halfHeight);
+        SR_NODISCARD static SceneQueryGeometry Box(const SR_MATH_NS::FVector3& halfExtents);
+
+        SceneQueryShape shape = SceneQueryShape::Sphere;
+        float_t radius = 0.5f;
+        /// half of the cylindrical part of the capsule
+        float_t halfHeight = 0.5f;
+        SR_MATH_NS::FVector3 halfExtents = SR_MATH_NS::FVector3(0.5f);
+        SR_MATH_NS::Quaternion rotation = SR_MATH_NS::Quaternion::Identity();
+    };
+
+    struct SceneQuery3D {
+        SceneQueryType type = SceneQueryType::Raycast;
+        /// not used by raycasts
+        SceneQueryGeometry geometry;
+        /// the position of the shape for overlaps
+        SR_MATH_NS::FVector3 origin;
+        SR_MATH_NS::FVector3 direction;
+        float_t maxDistance = 0.f;
+        RaycastFilter filter;
+    };
+
+    /// Runs function(begin, end) for batches of [0, count), possibly on several threads, and returns when all are done.
+    using SceneQueryParallelFor = SR_HTYPES_NS::Function<void(uint32_t count, uint32_t batchSize, const SR_HTYPES_NS::Function<void(uint32_t, uint32_t)>& function)>;
+
+    /**
+     * Set of raycasts, sweeps and overlaps executed by one call of Raycast3D::Execute().
+     * Every query owns maxHitsPerQuery slots of one contiguous hits buffer, so backends fill the results from
+     * several threads without synchronization. Hits of raycasts and sweeps are sorted by distance.
+     * The batch can be cleared and refilled every tick, the memory is reused.
+     */
+    class SceneQueryBatch3D : public SR_UTILS_NS::NonCopyable {
+    public:
+        using Hit = SR_UTILS_NS::RaycastHit;
+        using Hits = std::span<const Hit>;
+
+    public:
+        explicit SceneQueryBatch3D(uint32_t maxHitsPerQuery = 1);
+        ~SceneQueryBatch3D() override = default;
+
+    public:
+        uint32_t AddRaycast(const SR_MATH_NS::FVector3& origin, const SR_MATH_NS::FVector3& direction, float_t maxDistance, const RaycastFilter& filter = RaycastFilter());
+        uint32_t AddSweep(const SceneQueryGeometry& geometry, const SR_MATH_NS::FVector3& origin, const SR_MATH_NS::FVector3& direction, float_t maxDistance, const RaycastFilter& filter = RaycastFilter());
+        uint32_t AddOverlap(const SceneQueryGeometry& geometry, const SR_MATH_NS::FVector3& position, const RaycastFilter& filter = RaycastFilter());
+
+        void Clear();
+
+        SR_NODISCARD uint32_t GetQueriesCount() const noexcept { return static_cast<uint32_t>(m_queries.size()); }
+        SR_NODISCARD const SceneQuery3D& GetQuery(uint32_t index) const { return m_queries[index]; }
+        SR_NODISCARD uint32_t GetMaxHitsPerQuery() const noexcept { return m_maxHitsPerQuery; }
+
+        SR_NODISCARD Hits GetHits(uint32_t index) const;
+        SR_NODISCARD bool HasHits(uint32_t index) const { return m_counts[index] > 0; }
+
+    public:
+        /// Used by the backends: resets the results before the execution.
+        void PrepareResults();
+        SR_NODISCARD Hit* GetHitsBuffer(uint32_t index) { return m_hits.data() + static_cast<size_t>(index) * m_maxHitsPerQuery; }
+        void SetHitsCount(uint32_t index, uint32_t count) { m_counts[index] = SR_MIN(count, m_maxHitsPerQuery); }
+
+    private:
+        std::vector<SceneQuery3D> m_queries;
+        std::vector<Hit> m_hits;
+        std::vector<uint32_t> m_counts;
+        uint32_t m_maxHitsPerQuery = 1;
+
+    };
+}
+
+#endif //SR_ENGINE_PHYSICS_SCENE_QUERY_3D_H
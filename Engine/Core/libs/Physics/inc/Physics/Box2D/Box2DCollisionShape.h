@@ -0,0 +1,43 @@
+//
+// Created by agent on 18.10.2026.
+//
+
+#ifndef SR_ENGINE_BOX2D_COLLISION_SHAPE_H
+#define SR_ENGINE_BOX2D_COLLISION_SHAPE_H
+
+#include <Physics/CollisionShape.h>
+
+#include <Physics/Box2D/Box2DUtils.h>
+
+namespace SR_PTYPES_NS {
+    /// Box2D clones the shapes into the fixtures, so the collision shape only keeps the geometry with the scale applied.
+    /// A triangle mesh is a polygon per triangle of the raw mesh projected to XY, the rigidbody gets a fixture per shape.
+    class Box2DCollisionShape : public CollisionShape {
+        using Super = CollisionShape;
+    public:
+        explicit Box2DCollisionShape(LibraryPtr pLibrary);
+        ~Box2DCollisionShape() override;
+
+    public:
+        bool UpdateShape() override;
+        bool UpdateMatrix() override;
+
+        SR_NODISCARD void* GetHandle() const noexcept override { return m_shapes.empty() ? nullptr : m_shapes.front(); }
+        SR_NODISCARD const std::vector<b2Shape*>& GetShapes() const noexcept { return m_shapes; }
+
+    private:
+        SR_NODISCARD bool MakeShapes(std::vector<b2Shape*>& shapes) const;
+        SR_NODISCARD bool MakeTriangleMesh(std::vector<b2Shape*>& shapes) const;
+
+        void ReleaseShapes();
+
+    private:
+        std::vector<b2Shape*> m_shapes;
+        /// the scale the shapes were made with, UpdateMatrix() remakes them only when it is changed
+        SR_MATH_NS::FVector3 m_shapesScale;
+        SR_MATH_NS::FVector3 m_shapesBounds;
+
+    };
+}
+
+#endif //SR_ENGINE_BOX2D_COLLISION_SHAPE_H
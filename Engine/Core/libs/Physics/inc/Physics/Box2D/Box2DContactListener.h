@@ -0,0 +1,89 @@
+//
+// Created by agent on 18.10.2026.
+//
+
+#ifndef SR_ENGINE_BOX2D_CONTACT_LISTENER_H
+#define SR_ENGINE_BOX2D_CONTACT_LISTENER_H
+
+#include <Physics/Box2D/Box2DUtils.h>
+
+namespace SR_PTYPES_NS {
+    class Rigidbody;
+}
+
+namespace SR_PHYSICS_NS {
+    /// Rejects the pairs by the collision matrix and the triggers touching the static bodies, see PhysicsLibrary.
+    class Box2DContactFilter : public b2ContactFilter {
+    public:
+        bool ShouldCollide(b2Fixture* pFixtureA, b2Fixture* pFixtureB) override;
+
+        void SetTriggersVsStatic(bool enabled) noexcept { m_triggersVsStatic = enabled; }
+
+    private:
+        bool m_triggersVsStatic = true;
+
+    };
+
+    /**
+     * Box2D calls the listener from the inside of b2World::Step(), the world is locked there.
+     * The events are buffered the same way as by the PhysX callback and dispatched from the synchronization,
+     * stay events are collected from the touching contacts after the step.
+     */
+    class Box2DContactListener : public b2ContactListener {
+        enum class EventType : uint8_t {
+            CollisionEnter, CollisionStay, CollisionExit, TriggerEnter, TriggerExit
+        };
+
+        struct Event {
+            SR_PTYPES_NS::Rigidbody* pRigidbodies[2] = { nullptr, nullptr };
+            EventType type = EventType::CollisionEnter;
+            SR_MATH_NS::FVector3 point;
+            SR_MATH_NS::FVector3 impulse;
+        };
+
+        struct EventKey {
+            SR_PTYPES_NS::Rigidbody* pFirst = nullptr;
+            SR_PTYPES_NS::Rigidbody* pSecond = nullptr;
+            EventType type = EventType::CollisionEnter;
+
+            bool operator==(const EventKey& other) const noexcept {
+                return pFirst == other.pFirst && pSecond == other.pSecond && type == other.type;
+            }
+        };
+
+        struct EventKeyHash {
+            size_t operator()(const EventKey& key) const noexcept {
+                const size_t hash = std::hash<void*>()(key.pFirst) ^ (std::hash<void*>()(key.pSecond) << 1);
+                return hash ^ (static_cast<size_t>(key.type) << 3);
+            }
+        };
+
+    public:
+        void BeginContact(b2Contact* pContact) override;
+        void EndContact(b2Contact* pContact) override;
+
+    public:
+        /// Must be called before b2World::Step(), the deduplication is done within a step.
+        void BeginStep() { m_keys.clear(); }
+        /// Buffers the stay events of the touching contacts, must be called after b2World::Step().
+        void EndStep(b2World* pWorld);
+        /// Calls the components for the buffered events and clears the buffer, must be called from the scene thread.
+        void Dispatch();
+        /// Drops the buffered events of the rigidbody, it can be deleted after it.
+        void Remove(SR_PTYPES_NS::Rigidbody* pRigidbody);
+
+    private:
+        void AddEvent(b2Contact* pContact, EventType collisionType, EventType triggerType);
+        void AddEvent(SR_PTYPES_NS::Rigidbody* pFirst, SR_PTYPES_NS::Rigidbody* pSecond, EventType type, b2Contact* pContact);
+        static void Dispatch(const Event& event, uint8_t index);
+        SR_NODISCARD static bool IsListening(const SR_PTYPES_NS::Rigidbody* pRigidbody, EventType type);
+
+    private:
+        std::vector<Event> m_events;
+        std::vector<Event> m_dispatched;
+        std::unordered_set<EventKey, EventKeyHash> m_keys;
+
+    };
+}
+
+#endif //SR_ENGINE_BOX2D_CONTACT_LISTENER_H
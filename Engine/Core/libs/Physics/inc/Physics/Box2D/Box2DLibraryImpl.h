@@ -23,9 +23,20 @@ namespace SR_PHYSICS_NS {
         SR_NODISCARD ShapeType GetDefaultShape() const override { return ShapeType::Box2D; }
 
         SR_NODISCARD SR_PTYPES_NS::CollisionShape* CreateCollisionShape() override;
-        SR_NODISCARD SR_PTYPES_NS::Rigidbody2D* CreateRigidbody2D() override;
+        SR_NODISCARD SR_PTYPES_NS::Rigidbody2DImpl* CreateRigidbody2DImpl() override;
         SR_NODISCARD SR_PHYSICS_NS::PhysicsWorld* CreatePhysicsWorld(Space space) override;
 
+    public:
+        SR_NODISCARD int32_t GetVelocityIterations() const noexcept { return m_velocityIterations; }
+        SR_NODISCARD int32_t GetPositionIterations() const noexcept { return m_positionIterations; }
+
+    private:
+        void LoadSettings();
+
+    private:
+        int32_t m_velocityIterations = 8;
+        int32_t m_positionIterations = 3;
+
     };
 }
 
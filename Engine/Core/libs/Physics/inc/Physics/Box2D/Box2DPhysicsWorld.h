@@ -0,0 +1,75 @@
+//
+// Created by agent on 18.10.2026.
+//
+
+#ifndef SR_ENGINE_BOX2D_PHYSICSWORLD_H
+#define SR_ENGINE_BOX2D_PHYSICSWORLD_H
+
+#include <Physics/Box2D/Box2DUtils.h>
+#include <Physics/PhysicsWorld.h>
+
+namespace SR_PTYPES_NS {
+    class Box2DRigidbody2DImpl;
+}
+
+namespace SR_PHYSICS_NS {
+    class Box2DContactListener;
+    class Box2DContactFilter;
+
+    class Box2DPhysicsWorld : public PhysicsWorld {
+        using Super = PhysicsWorld;
+    public:
+        explicit Box2DPhysicsWorld(LibraryPtr pLibrary, Space space);
+        ~Box2DPhysicsWorld() override;
+
+    public:
+        bool Initialize() override;
+        bool ClearForces() override;
+        bool Synchronize() override;
+
+        bool StepSimulation(float_t step) override;
+
+        bool AddRigidbody(RigidbodyPtr pRigidbody) override;
+        bool RemoveRigidbody(RigidbodyPtr pRigidbody) override;
+
+        void Interpolate(float_t alpha) override;
+        void RestoreSimulatedPoses() override;
+
+        /// b2World::ShiftOrigin() moves the bodies and the broadphase at once, the z of the shift is not simulated.
+        void ShiftOrigin(const SR_MATH_NS::FVector3& shift) override;
+
+        /// The phases of the steps are from b2Profile, Box2D does not report the islands.
+        SR_NODISCARD PhysicsStatistics GetStatistics() const override;
+
+        SR_NODISCARD b2World* GetB2World() const noexcept { return m_world; }
+
+    private:
+        /// Pushes the results of the last step to the awake bodies.
+        bool SynchronizeActive();
+        /// Pushes the rigidbodies dirtied by the engine to the world.
+        bool SynchronizeDirty();
+
+        SR_NODISCARD static SR_PTYPES_NS::Box2DRigidbody2DImpl* GetImpl(RigidbodyPtr pRigidbody);
+
+    private:
+        b2World* m_world = nullptr;
+        Box2DContactListener* m_contactListener = nullptr;
+        Box2DContactFilter* m_contactFilter = nullptr;
+
+        int32_t m_velocityIterations = 8;
+        int32_t m_positionIterations = 3;
+
+        std::vector<b2Body*> m_awakeBodies;
+
+        /// rigidbodies moved by the last step, only they are interpolated
+        std::vector<RigidbodyPtr> m_movedRigidbodies;
+        /// moved by the step before, used to stop the interpolation of the bodies that fell asleep
+        std::vector<RigidbodyPtr> m_previousMovedRigidbodies;
+
+        /// set by StepSimulation(), interpolated bodies take a new state only once per step
+        std::atomic<bool> m_hasNewState = false;
+
+    };
+}
+
+#endif //SR_ENGINE_BOX2D_PHYSICSWORLD_H
@@ -0,0 +1,32 @@
+//
+// Created by agent on 18.10.2026.
+//
+
+#ifndef SR_ENGINE_BOX2D_RAYCAST2DIMPL_H
+#define SR_ENGINE_BOX2D_RAYCAST2DIMPL_H
+
+#include <Physics/2D/Raycast2DImpl.h>
+#include <Physics/Box2D/Box2DUtils.h>
+
+namespace SR_PHYSICS_NS {
+    /// Rays go through b2World::RayCast, which walks the dynamic tree of the broad phase.
+    class Box2DRaycast2DImpl : public Raycast2DImpl {
+        using Super = Raycast2DImpl;
+    public:
+        explicit Box2DRaycast2DImpl(SR_PHYSICS_NS::PhysicsWorld* world)
+            : Super(world)
+        { }
+
+        RaycastHits Cast(const SR_MATH_NS::FVector2& origin, const SR_MATH_NS::FVector2& direction, float_t maxDistance, uint32_t maxHits, const RaycastFilter& filter) override;
+        bool CastAny(const SR_MATH_NS::FVector2& origin, const SR_MATH_NS::FVector2& direction, float_t maxDistance, const RaycastFilter& filter) override;
+
+        /// Zero is reserved for "any tag", see Box2DFilterData::tag.
+        SR_NODISCARD static uint32_t MakeTagHash(SR_UTILS_NS::StringAtom tag);
+
+    private:
+        SR_NODISCARD b2World* GetB2World() const;
+
+    };
+}
+
+#endif //SR_ENGINE_BOX2D_RAYCAST2DIMPL_H
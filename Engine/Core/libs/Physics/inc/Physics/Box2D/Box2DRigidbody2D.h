@@ -0,0 +1,65 @@
+//
+// Created by agent on 18.10.2026.
+//
+
+#ifndef SR_ENGINE_BOX2D_RIGIDBODY2D_H
+#define SR_ENGINE_BOX2D_RIGIDBODY2D_H
+
+#include <Physics/2D/Rigidbody2D.h>
+
+#include <Physics/Box2D/Box2DUtils.h>
+
+namespace SR_PTYPES_NS {
+    /// Box2D has no bodies outside of a world, the body is created by InitBody() in the world set by Box2DPhysicsWorld
+    /// and destroyed when the rigidbody is removed from it. The user data of the body is the rigidbody.
+    class Box2DRigidbody2DImpl : public Rigidbody2DImpl {
+        using Super = Rigidbody2DImpl;
+    public:
+        ~Box2DRigidbody2DImpl() override;
+
+    public:
+        SR_NODISCARD void* GetHandle() const noexcept override { return m_body; }
+
+    public:
+        void UpdateInertia() override;
+        bool InitBody() override;
+        void ClearForces() override;
+
+        void AddLinearVelocity(const SR_MATH_NS::FVector2& velocity) override;
+        void AddAngularVelocity(float_t velocity) override;
+
+        void SetLinearVelocity(const SR_MATH_NS::FVector2& velocity) override;
+        void SetAngularVelocity(float_t velocity) override;
+
+        SR_NODISCARD SR_MATH_NS::FVector2 GetLinearVelocity() const override;
+        SR_NODISCARD float_t GetAngularVelocity() const override;
+
+        void SetFixedRotation(bool fixedRotation) override;
+
+        void Synchronize(bool interpolate) override;
+
+        bool UpdateMatrix(bool force) override;
+        bool UpdateShapeInternal() override;
+
+        void SetWorld(b2World* pWorld) { m_world = pWorld; }
+        void DestroyBody();
+        /// The world is deleted with all its bodies, the handle is just forgotten.
+        void OnWorldDestroyed() noexcept;
+
+    private:
+        void ApplyBodyPose();
+        void GetBodyPose(SR_MATH_NS::FVector3& translation, SR_MATH_NS::Quaternion& rotation) const;
+        void UpdateFilterData();
+        SR_NODISCARD bool IsAngleChanged(float_t angle) const;
+
+    private:
+        b2World* m_world = nullptr;
+        b2Body* m_body = nullptr;
+
+        /// pointed by the fixtures, see Box2DContactFilter
+        SR_PHYSICS_NS::Box2DFilterData m_filterData;
+
+    };
+}
+
+#endif //SR_ENGINE_BOX2D_RIGIDBODY2D_H
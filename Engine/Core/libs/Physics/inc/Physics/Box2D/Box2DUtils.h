@@ -0,0 +1,56 @@
+//
+// Created by agent on 18.10.2026.
+//
+
+#ifndef SR_ENGINE_BOX2D_UTILS_H
+#define SR_ENGINE_BOX2D_UTILS_H
+
+#include <Physics/PhysicsLib.h>
+
+#include <Utils/Math/Vector2.h>
+#include <Utils/Math/Vector3.h>
+#include <Utils/Math/Quaternion.h>
+
+#include <box2d/box2d.h>
+
+namespace SR_PHYSICS_NS {
+    /// Box2D categories are 16 bits wide, the filter of the fixtures is done by Box2DContactFilter with the 32 bits layers.
+    /// Pointed by the user data of the fixtures, owned by the rigidbody implementation.
+    struct Box2DFilterData {
+        /// layer bit, zero collides with everything
+        uint32_t layer = 0;
+        /// row of the collision matrix, see PhysicsLibrary::GetCollisionMask()
+        uint32_t mask = 0;
+        /// hash of the tag of the game object, see RaycastFilter
+        uint32_t tag = 0;
+        ContactEventFlags events = 0;
+    };
+}
+
+namespace SR_PHYSICS_UTILS_NS {
+    SR_MAYBE_UNUSED static b2Vec2 FV2ToB2V2(const SR_MATH_NS::FVector2& vector2) {
+        return b2Vec2(vector2.x, vector2.y);
+    }
+
+    SR_MAYBE_UNUSED static b2Vec2 FV3ToB2V2(const SR_MATH_NS::FVector3& vector3) {
+        return b2Vec2(vector3.x, vector3.y);
+    }
+
+    SR_MAYBE_UNUSED static SR_MATH_NS::FVector3 B2V2ToFV3(const b2Vec2& vector2, float_t z = 0.f) {
+        return SR_MATH_NS::FVector3(vector2.x, vector2.y, z);
+    }
+
+    /// Angle of the rotation around Z in radians, the other axes are dropped by the 2D simulation.
+    SR_MAYBE_UNUSED static float_t QuaternionToB2Angle(const SR_MATH_NS::Quaternion& q) {
+        const double_t siny = 2.0 * (q.W() * q.Z() + q.X() * q.Y());
+        const double_t cosy = 1.0 - 2.0 * (q.Y() * q.Y() + q.Z() * q.Z());
+        return static_cast<float_t>(std::atan2(siny, cosy));
+    }
+
+    SR_MAYBE_UNUSED static SR_MATH_NS::Quaternion B2AngleToQuaternion(float_t angle) {
+        const double_t half = static_cast<double_t>(angle) * 0.5;
+        return SR_MATH_NS::Quaternion(0.0, 0.0, std::sin(half), std::cos(half));
+    }
+}
+
+#endif //SR_ENGINE_BOX2D_UTILS_H
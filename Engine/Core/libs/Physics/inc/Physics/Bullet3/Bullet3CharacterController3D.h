@@ -0,0 +1,62 @@
+//
+// Created by agent on 18.10.2026.
+//
+
+#ifndef SR_ENGINE_BULLET3_CHARACTER_CONTROLLER_3D_H
+#define SR_ENGINE_BULLET3_CHARACTER_CONTROLLER_3D_H
+
+#include <Physics/3D/CharacterController3D.h>
+#include <Physics/Bullet3/Bullet3PhysicsLib.h>
+
+class btKinematicCharacterController;
+
+namespace SR_PTYPES_NS {
+    /**
+     * btKinematicCharacterController on a pair caching ghost object. The controller is an action of the world,
+     * Move() sets its velocity for the step and all controllers are moved by the step itself.
+     * The gravity is applied by the component, the ground and the hits are taken from the contacts of the ghost,
+     * the ridden platforms give their velocity at the ground point.
+     */
+    class Bullet3CharacterController3DImpl : public CharacterController3DImpl {
+        using Super = CharacterController3DImpl;
+    public:
+        explicit Bullet3CharacterController3DImpl(LibraryPtr pLibrary);
+        ~Bullet3CharacterController3DImpl() override;
+
+    public:
+        SR_NODISCARD void* GetHandle() const noexcept override { return m_ghostObject; }
+
+        bool Init(PhysicsWorldPtr pWorld) override;
+        void DeInit() override;
+
+        void Move(const SR_MATH_NS::FVector3& displacement, float_t step) override;
+
+        void SetFootPosition(const SR_MATH_NS::FVector3& position) override;
+        SR_NODISCARD SR_MATH_NS::FVector3 GetFootPosition() const override;
+
+        /// Bullet can't resize the shape of a controller, the controller is recreated at the same place.
+        void UpdateShape() override;
+
+        void ShiftOrigin(const SR_MATH_NS::FVector3& shift) override;
+
+        /// Called by the world after the step, finds the ground and reports the touched rigidbodies.
+        void UpdateContacts();
+
+    private:
+        SR_NODISCARD SR_MATH_NS::FVector3 GetPlatformVelocity() const;
+
+    private:
+        btDiscreteDynamicsWorld* m_btWorld = nullptr;
+        btCapsuleShape* m_shape = nullptr;
+        btPairCachingGhostObject* m_ghostObject = nullptr;
+        btKinematicCharacterController* m_characterController = nullptr;
+
+        btManifoldArray m_manifolds;
+
+        /// from the foot to the center of the capsule
+        float_t m_centerOffset = 0.f;
+
+    };
+}
+
+#endif //SR_ENGINE_BULLET3_CHARACTER_CONTROLLER_3D_H
@@ -10,10 +10,12 @@
 #include <Physics/Bullet3/Bullet3PhysicsLib.h>
 
 namespace SR_PTYPES_NS {
+    /// The shape is made with the scale applied, UpdateMatrix() dirties the rigidbody to remake it when the scale is changed.
+    /// Convex shapes are hulls of the vertices of the raw mesh.
     class Bullet3CollisionShape : public CollisionShape {
         using Super = CollisionShape;
     public:
-        Bullet3CollisionShape(LibraryPtr pLibrary);
+        explicit Bullet3CollisionShape(LibraryPtr pLibrary);
         ~Bullet3CollisionShape() override;
 
     public:
@@ -24,8 +26,15 @@ namespace SR_PTYPES_NS {
 
         SR_NODISCARD SR_MATH_NS::FVector3 CalculateLocalInertia(float_t mass) const override;
 
+    private:
+        SR_NODISCARD btCollisionShape* MakeShape() const;
+        SR_NODISCARD btCollisionShape* MakeConvexHull() const;
+
     private:
         btCollisionShape* m_shape = nullptr;
+        /// the scale the shape was made with
+        SR_MATH_NS::FVector3 m_shapeScale;
+        SR_MATH_NS::FVector3 m_shapeBounds;
 
     };
 }
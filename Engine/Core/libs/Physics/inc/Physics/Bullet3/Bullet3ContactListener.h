@@ -0,0 +1,73 @@
+//
+// Created by agent on 18.10.2026.
+//
+
+#ifndef SR_ENGINE_BULLET3_CONTACT_LISTENER_H
+#define SR_ENGINE_BULLET3_CONTACT_LISTENER_H
+
+#include <Physics/Bullet3/Bullet3PhysicsLib.h>
+
+namespace SR_PHYSICS_NS {
+    /**
+     * Bullet has no contact callbacks which are safe for the multithreaded world,
+     * the touching pairs are collected from the manifolds of the dispatcher after the step and compared with the previous ones.
+     * Ghost objects of the triggers have no contact response, the manifolds of them give the trigger events.
+     * The events are buffered the same way as by the PhysX callback and dispatched from the synchronization.
+     */
+    class Bullet3ContactListener {
+        enum class EventType : uint8_t {
+            CollisionEnter, CollisionStay, CollisionExit, TriggerEnter, TriggerExit
+        };
+
+        struct Event {
+            SR_PTYPES_NS::Rigidbody* pRigidbodies[2] = { nullptr, nullptr };
+            EventType type = EventType::CollisionEnter;
+            SR_MATH_NS::FVector3 point;
+            SR_MATH_NS::FVector3 impulse;
+        };
+
+        struct Pair {
+            SR_PTYPES_NS::Rigidbody* pFirst = nullptr;
+            SR_PTYPES_NS::Rigidbody* pSecond = nullptr;
+            bool isTrigger = false;
+
+            bool operator==(const Pair& other) const noexcept {
+                return pFirst == other.pFirst && pSecond == other.pSecond && isTrigger == other.isTrigger;
+            }
+        };
+
+        struct PairHash {
+            size_t operator()(const Pair& pair) const noexcept {
+                const size_t hash = std::hash<void*>()(pair.pFirst) ^ (std::hash<void*>()(pair.pSecond) << 1);
+                return hash ^ (static_cast<size_t>(pair.isTrigger) << 3);
+            }
+        };
+
+    public:
+        /// Buffers the events of the pairs which are changed by the step, must be called after btDynamicsWorld::stepSimulation().
+        void Update(btDispatcher* pDispatcher);
+        /// Calls the components for the buffered events and clears the buffer, must be called from the scene thread.
+        void Dispatch();
+        /// Drops the buffered events and the pairs of the rigidbody, it can be deleted after it.
+        void Remove(SR_PTYPES_NS::Rigidbody* pRigidbody);
+
+        void SetTriggersVsStatic(bool enabled) noexcept { m_triggersVsStatic = enabled; }
+
+    private:
+        void AddEvent(const Pair& pair, EventType type, const btPersistentManifold* pManifold);
+        static void Dispatch(const Event& event, uint8_t index);
+        SR_NODISCARD static bool IsListening(const SR_PTYPES_NS::Rigidbody* pRigidbody, EventType type);
+
+    private:
+        std::vector<Event> m_events;
+        std::vector<Event> m_dispatched;
+
+        std::unordered_set<Pair, PairHash> m_pairs;
+        std::unordered_set<Pair, PairHash> m_previousPairs;
+
+        bool m_triggersVsStatic = true;
+
+    };
+}
+
+#endif //SR_ENGINE_BULLET3_CONTACT_LISTENER_H
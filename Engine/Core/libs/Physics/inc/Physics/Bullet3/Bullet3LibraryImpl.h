@@ -7,23 +7,56 @@
 
 #include <Physics/LibraryImpl.h>
 
+class btITaskScheduler;
+
 namespace SR_PHYSICS_NS {
+    SR_ENUM_NS_CLASS_T(Bullet3SchedulerMode, uint8_t,
+        Sequential, /// everything is done by the simulating thread
+        Default, /// own Bullet threads
+        JobSystem /// loops are scheduled to the job system of the engine, see PhysicsLibrary::SetJobScheduler()
+    );
+
     class Bullet3LibraryImpl : public SR_PHYSICS_NS::LibraryImpl {
         using Super = SR_PHYSICS_NS::LibraryImpl;
     public:
         Bullet3LibraryImpl() = default;
-        ~Bullet3LibraryImpl() override = default;
+        ~Bullet3LibraryImpl() override;
 
     public:
-        SR_NODISCARD bool Initialize() override { return true; }
+        SR_NODISCARD bool Initialize() override;
 
         SR_NODISCARD bool IsShapeSupported(ShapeType type) const override;
         SR_NODISCARD ShapeType GetDefaultShape() const override { return ShapeType::Box3D; }
 
         SR_NODISCARD SR_PTYPES_NS::CollisionShape* CreateCollisionShape() override;
-        SR_NODISCARD SR_PTYPES_NS::Rigidbody3D* CreateRigidbody3D() override;
+        SR_NODISCARD SR_PTYPES_NS::Rigidbody3DImpl* CreateRigidbody3DImpl() override;
+        SR_NODISCARD SR_PTYPES_NS::CharacterController3DImpl* CreateCharacterController3DImpl() override;
         SR_NODISCARD SR_PHYSICS_NS::PhysicsWorld* CreatePhysicsWorld(Space space) override;
 
+    public:
+        SR_NODISCARD int32_t GetSolverIterations() const noexcept { return m_solverIterations; }
+        /// Size of the pool of the parallel solvers, resolves "auto" to a solver per thread of the scheduler.
+        SR_NODISCARD uint32_t GetSolverPoolSize() const;
+
+        /// Created by the first world, Bullet has a single scheduler for the whole process.
+        SR_NODISCARD btITaskScheduler* GetTaskScheduler();
+
+    private:
+        void LoadSettings();
+
+    private:
+        int32_t m_solverIterations = 10;
+        /// zero is "auto"
+        uint32_t m_solverPoolSize = 0;
+
+        Bullet3SchedulerMode m_schedulerMode = Bullet3SchedulerMode::JobSystem;
+        /// zero is "auto"
+        uint32_t m_schedulerWorkers = 0;
+
+        btITaskScheduler* m_taskScheduler = nullptr;
+        /// the sequential scheduler is a static object of Bullet
+        bool m_isTaskSchedulerOwned = false;
+
     };
 }
 
@@ -9,10 +9,15 @@
 
 #include <btBulletDynamicsCommon.h>
 #include <BulletCollision/CollisionShapes/btBox2dShape.h>
+#include <BulletCollision/CollisionDispatch/btGhostObject.h>
 
 #include <LinearMath/btVector3.h>
 #include <LinearMath/btAlignedObjectArray.h>
 
+namespace SR_PTYPES_NS {
+    class Rigidbody;
+}
+
 namespace SR_PHYSICS_UTILS_NS {
     SR_MAYBE_UNUSED static btVector3 FV3ToBtV3(const SR_MATH_NS::FVector3 &vector3) {
         return btVector3(vector3.x, vector3.y, vector3.z);
@@ -21,6 +26,19 @@ namespace SR_PHYSICS_UTILS_NS {
     SR_MAYBE_UNUSED static SR_MATH_NS::FVector3 BtV33ToFV(const btVector3 &vector3) {
         return SR_MATH_NS::FVector3(vector3.x(), vector3.y(), vector3.z());
     }
+
+    SR_MAYBE_UNUSED static btQuaternion QuaternionToBtQ(const SR_MATH_NS::Quaternion& q) {
+        return btQuaternion(q.X(), q.Y(), q.Z(), q.W());
+    }
+
+    SR_MAYBE_UNUSED static SR_MATH_NS::Quaternion BtQToQuaternion(const btQuaternion& q) {
+        return SR_MATH_NS::Quaternion(q.x(), q.y(), q.z(), q.w());
+    }
+
+    /// The user pointer of the bodies and the ghost objects of the triggers is the rigidbody.
+    SR_MAYBE_UNUSED static SR_PTYPES_NS::Rigidbody* GetBtObjectRigidbody(const btCollisionObject* pObject) {
+        return pObject ? static_cast<SR_PTYPES_NS::Rigidbody*>(pObject->getUserPointer()) : nullptr;
+    }
 }
 
 #endif //SR_ENGINE_BULLET3PHYSICSLIB_H
@@ -8,7 +8,18 @@
 #include <Physics/Bullet3/Bullet3PhysicsLib.h>
 #include <Physics/PhysicsWorld.h>
 
+class btDiscreteDynamicsWorldMt;
+class btConstraintSolverPoolMt;
+class btGhostPairCallback;
+
+namespace SR_PTYPES_NS {
+    class Bullet3Rigidbody3DImpl;
+}
+
 namespace SR_PHYSICS_NS {
+    class Bullet3ContactListener;
+
+    /// The world is a btDiscreteDynamicsWorldMt, the narrowphase and the solver pool run on the scheduler of Bullet3LibraryImpl.
     class Bullet3PhysicsWorld : public PhysicsWorld {
         using Super = PhysicsWorld;
     public:
@@ -25,13 +36,66 @@ namespace SR_PHYSICS_NS {
         bool AddRigidbody(RigidbodyPtr pRigidbody) override;
         bool RemoveRigidbody(RigidbodyPtr pRigidbody) override;
 
+        bool AddCharacterController(CharacterControllerPtr pController) override;
+        bool RemoveCharacterController(CharacterControllerPtr pController) override;
+
+        /// Only sets the velocities, the controllers are the actions of the world and are moved by the step together.
+        void MoveCharacterControllers(float_t step) override;
+
+        void Interpolate(float_t alpha) override;
+        void RestoreSimulatedPoses() override;
+
+        /// The objects are translated one by one, the broadphase is updated once for all of them.
+        void ShiftOrigin(const SR_MATH_NS::FVector3& shift) override;
+
+        /// Walks all collision objects and manifolds, the cost is paid only while the statistics are enabled.
+        SR_NODISCARD PhysicsStatistics GetStatistics() const override;
+
+        /// Called by the motion states from the step, the threads of the scheduler can call it at the same time.
+        void MarkMoved(RigidbodyPtr pRigidbody);
+
+        SR_NODISCARD btDiscreteDynamicsWorld* GetBtWorld() const noexcept;
+
     private:
-        btAlignedObjectArray<btCollisionShape*> m_collisionShapes;
-        btBroadphaseInterface* m_broadPhase = nullptr;
+        /// Pushes the results of the last step to the bodies moved by it.
+        bool SynchronizeActive();
+        /// Pushes the rigidbodies dirtied by the engine to the world.
+        bool SynchronizeDirty();
+        /// Finds the contacts of the controllers after the step and moves their transforms.
+        void SynchronizeCharacterControllers();
+
+        /// Group is the layer bit and mask is the row of the collision matrix, the same as the filter data of PhysX.
+        static void UpdateCollisionFilter(RigidbodyPtr pRigidbody, btBroadphaseProxy* pProxy);
+
+        SR_NODISCARD static SR_PTYPES_NS::Bullet3Rigidbody3DImpl* GetImpl(RigidbodyPtr pRigidbody);
+
+    private:
+        btDefaultCollisionConfiguration* m_collisionConfiguration = nullptr;
         btCollisionDispatcher* m_dispatcher = nullptr;
+        btBroadphaseInterface* m_broadPhase = nullptr;
+        btConstraintSolverPoolMt* m_solverPool = nullptr;
         btConstraintSolver* m_solver = nullptr;
-        btDefaultCollisionConfiguration* m_collisionConfiguration = nullptr;
-        btDiscreteDynamicsWorld* m_dynamicsWorld = nullptr;
+        btDiscreteDynamicsWorldMt* m_dynamicsWorld = nullptr;
+
+        /// keeps the overlapping pairs of the ghost objects of the controllers
+        btGhostPairCallback* m_ghostPairCallback = nullptr;
+
+        Bullet3ContactListener* m_contactListener = nullptr;
+
+        std::vector<CharacterControllerPtr> m_characterControllers;
+
+        std::mutex m_steppedMutex;
+        /// filled by the motion states, Bullet synchronizes the awake bodies only
+        std::vector<RigidbodyPtr> m_steppedRigidbodies;
+        std::vector<RigidbodyPtr> m_synchronizedRigidbodies;
+
+        /// rigidbodies moved by the last step, only they are interpolated
+        std::vector<RigidbodyPtr> m_movedRigidbodies;
+        /// moved by the step before, used to stop the interpolation of the bodies that fell asleep
+        std::vector<RigidbodyPtr> m_previousMovedRigidbodies;
+
+        /// set by StepSimulation(), interpolated bodies take a new state only once per step
+        std::atomic<bool> m_hasNewState = false;
 
     };
 }
@@ -0,0 +1,35 @@
+//
+// Created by agent on 18.10.2026.
+//
+
+#ifndef SR_ENGINE_BULLET3_RAYCAST_3D_IMPL_H
+#define SR_ENGINE_BULLET3_RAYCAST_3D_IMPL_H
+
+#include <Physics/3D/Raycast3DImpl.h>
+#include <Physics/Bullet3/Bullet3PhysicsLib.h>
+#include <Utils/Common/RaycastHit.h>
+
+namespace SR_PHYSICS_NS {
+    /**
+     * Scene queries go through the broadphase of the world: rays by rayTest, sweeps by convexSweepTest
+     * and overlaps by contactTest of a temporary object. The group of the broadphase proxy is the layer bit,
+     * the tag is taken from the game object of the rigidbody, so the filtering is the same as for PhysX.
+     */
+    class Bullet3Raycast3DImpl : public Raycast3DImpl {
+        using Super = Raycast3DImpl;
+    public:
+        explicit Bullet3Raycast3DImpl(SR_PHYSICS_NS::PhysicsWorld* world)
+            : Super(world)
+        { }
+
+        RaycastHits Cast(const SR_MATH_NS::FVector3 &origin, const SR_MATH_NS::FVector3 &direction, float_t maxDistance, uint32_t maxHits, const RaycastFilter& filter) override;
+        bool CastAny(const SR_MATH_NS::FVector3 &origin, const SR_MATH_NS::FVector3 &direction, float_t maxDistance, const RaycastFilter& filter) override;
+        bool Execute(SceneQueryBatch3D& batch, const SceneQueryParallelFor& parallelFor) override;
+
+    private:
+        SR_NODISCARD btDiscreteDynamicsWorld* GetBtWorld() const;
+
+    };
+}
+
+#endif //SR_ENGINE_BULLET3_RAYCAST_3D_IMPL_H
@@ -7,32 +7,65 @@
 
 #include <Physics/3D/Rigidbody3D.h>
 
-class btRigidBody;
-class btMotionState;
+#include <Physics/Bullet3/Bullet3PhysicsLib.h>
+
+namespace SR_PHYSICS_NS {
+    class Bullet3PhysicsWorld;
+}
 
 namespace SR_PTYPES_NS {
-    class Bullet3Rigidbody3D : public Rigidbody3D {
-        using Super = Rigidbody3D;
+    /// The handle is a btRigidBody, or a btGhostObject for the triggers, the user pointer of both is the rigidbody.
+    class Bullet3Rigidbody3DImpl : public Rigidbody3DImpl {
+        using Super = Rigidbody3DImpl;
     public:
-        explicit Bullet3Rigidbody3D(LibraryPtr pLibrary);
-        ~Bullet3Rigidbody3D() override;
+        ~Bullet3Rigidbody3DImpl() override;
 
     public:
-        SR_NODISCARD void* GetHandle() const noexcept override;
+        SR_NODISCARD void* GetHandle() const noexcept override { return m_object; }
 
     public:
         void UpdateInertia() override;
         bool InitBody() override;
+        void ClearForces() override;
+
+        void AddLinearVelocity(const SR_MATH_NS::FVector3& velocity) override;
+        void AddAngularVelocity(const SR_MATH_NS::FVector3& velocity) override;
+
+        void SetLinearVelocity(const SR_MATH_NS::FVector3& velocity) override;
+        void SetAngularVelocity(const SR_MATH_NS::FVector3& velocity) override;
+
+        SR_NODISCARD SR_MATH_NS::FVector3 GetLinearVelocity() const override;
+        SR_NODISCARD SR_MATH_NS::FVector3 GetAngularVelocity() const override;
+
+        void Synchronize(bool interpolate) override;
+        /// Bullet has no origin to move, the object and its motion state are translated.
+        void ShiftOrigin(const SR_MATH_NS::FVector3& shift) override;
 
         bool UpdateMatrix(bool force) override;
         bool UpdateShapeInternal() override;
 
-        void AddLinearVelocity(const SR_MATH_NS::FVector3& velocity) override;
-        void AddAngularVelocity(const SR_MATH_NS::FVector3& velocity) override;
-        //void SetVelocity(const SR_MATH_NS::FVector3& velocity) override;
+        void SetLinearLock(const SR_MATH_NS::BVector3& lock) override;
+        void SetAngularLock(const SR_MATH_NS::BVector3& lock) override;
+
+        SR_NODISCARD btRigidBody* GetBtRigidBody() const noexcept { return btRigidBody::upcast(m_object); }
+        SR_NODISCARD btGhostObject* GetBtGhostObject() const noexcept { return btGhostObject::upcast(m_object); }
+
+        /// Set by the world the object is added to, the object is removed from it before it is released.
+        void SetWorld(SR_PHYSICS_NS::Bullet3PhysicsWorld* pWorld) noexcept { m_world = pWorld; }
+        SR_NODISCARD SR_PHYSICS_NS::Bullet3PhysicsWorld* GetWorld() const noexcept { return m_world; }
+
+        /// Called by the motion state for the bodies moved by the step.
+        void OnMoved();
+
+    private:
+        void ReleaseObject();
+        void UpdateLocks();
+        void ApplyGlobalPose();
+        void GetGlobalPose(SR_MATH_NS::FVector3& translation, SR_MATH_NS::Quaternion& rotation) const;
 
     private:
-        btRigidBody* m_rigidbody = nullptr;
+        SR_PHYSICS_NS::Bullet3PhysicsWorld* m_world = nullptr;
+        btCollisionObject* m_object = nullptr;
         btMotionState* m_motionState = nullptr;
 
     };
@@ -0,0 +1,45 @@
+//
+// Created by agent on 18.10.2026.
+//
+
+#ifndef SR_ENGINE_BULLET3_TASK_SCHEDULER_H
+#define SR_ENGINE_BULLET3_TASK_SCHEDULER_H
+
+#include <Physics/Bullet3/Bullet3PhysicsLib.h>
+
+#include <LinearMath/btThreads.h>
+
+namespace SR_PHYSICS_NS {
+    /**
+     * Runs the parallel loops of Bullet (narrowphase, solver pool, integration) on the job system of the engine.
+     * The calling thread takes the ranges as well, so a loop is finished even if all workers are busy,
+     * the jobs which start after it just find nothing to do.
+     */
+    class Bullet3TaskScheduler final : public btITaskScheduler {
+    public:
+        Bullet3TaskScheduler(PhysicsLibrary::JobScheduler scheduler, uint32_t workers);
+        ~Bullet3TaskScheduler() override = default;
+
+    public:
+        SR_NODISCARD int getMaxNumThreads() const override { return static_cast<int>(m_workers) + 1; }
+        SR_NODISCARD int getNumThreads() const override { return m_threads; }
+        void setNumThreads(int numThreads) override;
+
+        void parallelFor(int iBegin, int iEnd, int grainSize, const btIParallelForBody& body) override;
+        btScalar parallelSum(int iBegin, int iEnd, int grainSize, const btIParallelSumBody& body) override;
+
+    private:
+        struct Loop;
+
+        void Run(int iBegin, int iEnd, int grainSize, const btIParallelForBody* pForBody, const btIParallelSumBody* pSumBody, btScalar& sum);
+        static void RunRanges(Loop& loop);
+
+    private:
+        PhysicsLibrary::JobScheduler m_scheduler;
+        uint32_t m_workers = 1;
+        int m_threads = 1;
+
+    };
+}
+
+#endif //SR_ENGINE_BULLET3_TASK_SCHEDULER_H
@@ -37,6 +37,11 @@ namespace SR_PTYPES_NS {
         virtual bool UpdateShape() { return false; }
         virtual bool UpdateMatrix() { return false; }
 
+        /// The handle is a placeholder until the mesh is cooked, UpdateShape() replaces it.
+        SR_NODISCARD virtual bool IsPlaceholder() const { return false; }
+        /// The mesh is still cooking, updating the shape now would restart it.
+        SR_NODISCARD virtual bool IsCooking() const { return false; }
+
         void UpdateDebugShape();
         void RemoveDebugShape();
 
@@ -13,6 +13,7 @@ namespace SR_PTYPES_NS {
     class CollisionShape;
     class PhysicsMaterialImpl;
     class Vehicle4W3D;
+    class CharacterController3DImpl;
 }
 
 namespace SR_PHYSICS_NS {
@@ -42,6 +43,7 @@ namespace SR_PHYSICS_NS {
         SR_NODISCARD virtual SR_PTYPES_NS::Rigidbody3DImpl* CreateRigidbody3DImpl() { SRHalt("Not implemented!"); return nullptr; }
 
         SR_NODISCARD virtual SR_PTYPES_NS::Vehicle4W3D* CreateVehicle4W3D() { return nullptr; }
+        SR_NODISCARD virtual SR_PTYPES_NS::CharacterController3DImpl* CreateCharacterController3DImpl() { return nullptr; }
 
         SR_NODISCARD virtual SR_PHYSICS_NS::PhysicsWorld* CreatePhysicsWorld(Space space) { return nullptr; }
 
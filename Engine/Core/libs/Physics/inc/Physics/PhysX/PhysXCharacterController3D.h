@@ -0,0 +1,61 @@
+//
+// Created by agent on 18.10.2026.
+//
+
+#ifndef SR_ENGINE_PHYSX_CHARACTER_CONTROLLER_3D_H
+#define SR_ENGINE_PHYSX_CHARACTER_CONTROLLER_3D_H
+
+#include <Physics/3D/CharacterController3D.h>
+#include <Physics/PhysX/PhysXUtils.h>
+
+namespace SR_PTYPES_NS {
+    /**
+     * PxCapsuleController of the PxControllerManager of the world. The controller filters the scene by the collision
+     * matrix of the layer of its game object and reports the touched rigidbodies, the ridden platforms are
+     * selected by the behavior callback.
+     */
+    class PhysXCharacterController3DImpl : public CharacterController3DImpl
+        , public physx::PxUserControllerHitReport
+        , public physx::PxControllerBehaviorCallback
+        , public physx::PxQueryFilterCallback
+    {
+        using Super = CharacterController3DImpl;
+    public:
+        explicit PhysXCharacterController3DImpl(LibraryPtr pLibrary);
+        ~PhysXCharacterController3DImpl() override;
+
+    public:
+        SR_NODISCARD void* GetHandle() const noexcept override { return m_pxController; }
+
+        bool Init(PhysicsWorldPtr pWorld) override;
+        void DeInit() override;
+
+        void Move(const SR_MATH_NS::FVector3& displacement, float_t step) override;
+
+        void SetFootPosition(const SR_MATH_NS::FVector3& position) override;
+        SR_NODISCARD SR_MATH_NS::FVector3 GetFootPosition() const override;
+
+        void UpdateShape() override;
+
+    public:
+        void onShapeHit(const physx::PxControllerShapeHit& hit) override;
+        void onControllerHit(const physx::PxControllersHit& hit) override { }
+        void onObstacleHit(const physx::PxControllerObstacleHit& hit) override { }
+
+        physx::PxControllerBehaviorFlags getBehaviorFlags(const physx::PxShape& shape, const physx::PxActor& actor) override;
+        physx::PxControllerBehaviorFlags getBehaviorFlags(const physx::PxController& controller) override;
+        physx::PxControllerBehaviorFlags getBehaviorFlags(const physx::PxObstacle& obstacle) override;
+
+        physx::PxQueryHitType::Enum preFilter(const physx::PxFilterData& filterData, const physx::PxShape* pShape,
+                const physx::PxRigidActor* pActor, physx::PxHitFlags& queryFlags) override;
+        physx::PxQueryHitType::Enum postFilter(const physx::PxFilterData& filterData, const physx::PxQueryHit& hit) override;
+
+    private:
+        physx::PxCapsuleController* m_pxController = nullptr;
+        /// the collision mask of the layer at the last move
+        uint32_t m_collisionMask = std::numeric_limits<uint32_t>::max();
+
+    };
+}
+
+#endif //SR_ENGINE_PHYSX_CHARACTER_CONTROLLER_3D_H
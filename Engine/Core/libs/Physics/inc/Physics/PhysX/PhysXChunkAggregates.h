@@ -0,0 +1,64 @@
+//
+// Created by agent on 18.10.2026.
+//
+
+#ifndef SR_ENGINE_PHYSX_CHUNK_AGGREGATES_H
+#define SR_ENGINE_PHYSX_CHUNK_AGGREGATES_H
+
+#include <Physics/PhysX/PhysXUtils.h>
+
+#include <Utils/Common/NonCopyable.h>
+
+namespace SR_PHYSICS_NS {
+    /**
+     * Groups the static actors of a scene by the chunks of the world grid, see World.xml.
+     * A chunk is a single bounding volume in the broadphase, and a streamed chunk is added and removed
+     * as whole aggregates instead of actor by actor. PhysX limits the size of an aggregate,
+     * a chunk with more static actors gets several of them.
+     */
+    class PhysXChunkAggregates : public SR_UTILS_NS::NonCopyable {
+    public:
+        PhysXChunkAggregates(physx::PxPhysics* pPhysics, physx::PxScene* pScene, const SR_MATH_NS::FVector3& chunkSize, uint32_t maxActors);
+        ~PhysXChunkAggregates() override;
+
+    public:
+        /// The actor must not be in a scene. Aggregates created meanwhile are added to the scene by Commit().
+        void Add(physx::PxRigidActor* pActor);
+        /// Adds the aggregates created by Add() to the scene, a call per an aggregate.
+        void Commit();
+
+        /// Removes the actors from their aggregates and the scene. Aggregates losing all their actors are removed at once.
+        void Remove(const std::vector<physx::PxRigidActor*>& actors);
+
+        /// The chunks stay the same after a shift of the origin, the keys are taken in the unshifted space.
+        void ShiftOrigin(const SR_MATH_NS::FVector3& shift) { m_origin -= shift; }
+
+        SR_NODISCARD uint32_t GetAggregatesCount() const noexcept { return static_cast<uint32_t>(m_keys.size()); }
+        SR_NODISCARD uint32_t GetChunksCount() const noexcept { return static_cast<uint32_t>(m_chunks.size()); }
+
+    private:
+        SR_NODISCARD uint64_t GetChunkKey(const physx::PxVec3& position) const;
+        SR_NODISCARD physx::PxAggregate* GetFreeAggregate(uint64_t key);
+
+        void Release(physx::PxAggregate* pAggregate);
+
+    private:
+        physx::PxPhysics* m_physics = nullptr;
+        physx::PxScene* m_scene = nullptr;
+
+        SR_MATH_NS::FVector3 m_chunkSize;
+        /// the sum of the shifts of the origin with the opposite sign
+        SR_MATH_NS::FVector3 m_origin = SR_MATH_NS::FVector3(SR_MATH_NS::Unit(0));
+        uint32_t m_maxActors = 128;
+
+        std::unordered_map<uint64_t, std::vector<physx::PxAggregate*>> m_chunks;
+        std::unordered_map<physx::PxAggregate*, uint64_t> m_keys;
+
+        /// created by Add(), not in the scene yet
+        std::vector<physx::PxAggregate*> m_pending;
+        std::unordered_map<physx::PxAggregate*, uint32_t> m_removed;
+
+    };
+}
+
+#endif //SR_ENGINE_PHYSX_CHUNK_AGGREGATES_H
@@ -8,8 +8,11 @@
 #include <Physics/CollisionShape.h>
 
 #include <Physics/PhysX/PhysXUtils.h>
+#include <Physics/PhysX/PhysXMeshCache.h>
+#include <Physics/PhysX/PhysXShapeCache.h>
 
 namespace SR_PTYPES_NS {
+    /// The PxShape is shared with the other actors of the library, any change of it acquires another one from PhysXShapeCache.
     class PhysXCollisionShape : public CollisionShape {
         using Super = CollisionShape;
     public:
@@ -22,13 +25,33 @@ namespace SR_PTYPES_NS {
 
         physx::PxMaterial* GetMaterial() const;
 
-        physx::PxConvexMesh* CreateConvexMesh(SR_HTYPES_NS::RawMesh* pRawMesh);
-        physx::PxTriangleMesh* CreateTriangleMesh(SR_HTYPES_NS::RawMesh* pRawMesh);
+        SR_NODISCARD bool IsPlaceholder() const override { return m_cookingTask != nullptr; }
+        SR_NODISCARD bool IsCooking() const override { return m_cookingTask && !m_cookingTask->IsDone(); }
 
         SR_NODISCARD void* GetHandle() const noexcept override { return m_shape; }
 
+    private:
+        /// Takes the cooked mesh or starts the cooking, the shape is a placeholder until the task is done.
+        SR_NODISCARD bool PrepareMesh(SR_HTYPES_NS::RawMesh* pRawMesh);
+        /// Geometry with the scale of the rigidbody applied, meshes and placeholders are not scaled.
+        SR_NODISCARD bool MakeGeometry(physx::PxGeometryHolder& geometry, physx::PxTransform& localPose) const;
+        SR_NODISCARD bool MakeShapeDesc(SR_PHYSICS_NS::PhysXShapeDesc& desc) const;
+        /// Acquires the shape of the description, the previous one is released.
+        SR_NODISCARD bool ReplaceShape(const SR_PHYSICS_NS::PhysXShapeDesc& desc);
+
+        void CancelCooking();
+        void ReleaseMesh();
+        void ReleaseShape();
+
     private:
         physx::PxShape* m_shape = nullptr;
+        /// geometry of the acquired shape, the scale changes are compared with it
+        physx::PxGeometryHolder m_geometry;
+        /// convex or triangle mesh acquired from the mesh cache of the library
+        physx::PxBase* m_mesh = nullptr;
+
+        SR_PHYSICS_NS::PhysXMeshCache::TaskPtr m_cookingTask;
+        physx::PxBounds3 m_placeholderBounds = physx::PxBounds3::empty();
     };
 }
 
@@ -0,0 +1,29 @@
+//
+// Created by agent on 18.10.2026.
+//
+
+#ifndef SR_ENGINE_PHYSX_JOB_DISPATCHER_H
+#define SR_ENGINE_PHYSX_JOB_DISPATCHER_H
+
+#include <Physics/PhysX/PhysXUtils.h>
+#include <Physics/PhysicsLib.h>
+
+namespace SR_PHYSICS_NS {
+    /// Runs the tasks of the PhysX solver on the job system of the engine instead of own PhysX threads.
+    class PhysXJobDispatcher final : public physx::PxCpuDispatcher {
+    public:
+        PhysXJobDispatcher(PhysicsLibrary::JobScheduler scheduler, uint32_t workers);
+        ~PhysXJobDispatcher() override = default;
+
+    public:
+        void submitTask(physx::PxBaseTask& task) override;
+        SR_NODISCARD physx::PxU32 getWorkerCount() const override { return m_workers; }
+
+    private:
+        PhysicsLibrary::JobScheduler m_scheduler;
+        uint32_t m_workers = 1;
+
+    };
+}
+
+#endif //SR_ENGINE_PHYSX_JOB_DISPATCHER_H
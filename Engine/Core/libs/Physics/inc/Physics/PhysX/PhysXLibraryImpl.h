@@ -7,8 +7,21 @@
 
 #include <Physics/LibraryImpl.h>
 #include <Physics/PhysX/PhysXUtils.h>
+#include <Physics/PhysX/PhysXMeshCache.h>
+#include <Physics/PhysX/PhysXShapeCache.h>
 
 namespace SR_PHYSICS_NS {
+    SR_ENUM_NS_CLASS_T(PhysXDispatcherMode, uint8_t,
+        Default, /// own PhysX threads
+        JobSystem /// tasks are scheduled to the job system of the engine, see PhysicsLibrary::SetJobScheduler()
+    );
+
+    SR_ENUM_NS_CLASS_T(PhysXBroadPhaseType, uint8_t,
+        SAP, /// single sweep and prune, slow for many actors added at once
+        MBP, /// sweep and prune per a region of the world grid
+        ABP /// automatic box pruning, does not need the regions
+    );
+
     class PhysXLibraryImpl : public SR_PHYSICS_NS::LibraryImpl {
         using Super = SR_PHYSICS_NS::LibraryImpl;
     public:
@@ -28,11 +41,33 @@ namespace SR_PHYSICS_NS {
         SR_NODISCARD SR_PHYSICS_NS::PhysicsWorld* CreatePhysicsWorld(Space space) override;
 
         SR_NODISCARD SR_PTYPES_NS::Vehicle4W3D* CreateVehicle4W3D() override;
+        SR_NODISCARD SR_PTYPES_NS::CharacterController3DImpl* CreateCharacterController3DImpl() override;
 
         SR_NODISCARD SR_PTYPES_NS::PhysicsMaterialImpl* CreatePhysicsMaterial() override;
 
     public:
         SR_NODISCARD physx::PxPhysics* GetPxPhysics() const { return m_physics; }
+        SR_NODISCARD PhysXMeshCache* GetMeshCache() const { return m_meshCache; }
+        SR_NODISCARD PhysXShapeCache* GetShapeCache() const { return m_shapeCache; }
+
+        SR_NODISCARD PhysXDispatcherMode GetDispatcherMode() const noexcept { return m_dispatcherMode; }
+        /// Resolves "auto", which leaves two cores to the engine and render threads.
+        SR_NODISCARD uint32_t GetDispatcherWorkers() const;
+
+        SR_NODISCARD PhysXBroadPhaseType GetBroadPhaseType() const noexcept { return m_broadPhaseType; }
+        /// Count of the MBP regions along X and Z, the regions of the world grid around the origin.
+        SR_NODISCARD uint32_t GetBroadPhaseRegions() const noexcept { return m_broadPhaseRegions; }
+
+        SR_NODISCARD bool IsChunkAggregatesEnabled() const noexcept { return m_isChunkAggregates; }
+        SR_NODISCARD uint32_t GetAggregateMaxActors() const noexcept { return m_aggregateMaxActors; }
+
+        /// The grid of the world from World.xml, width along X and Z and height along Y.
+        SR_NODISCARD SR_MATH_NS::FVector3 GetChunkSize() const noexcept { return m_chunkSize; }
+        SR_NODISCARD SR_MATH_NS::FVector3 GetRegionSize() const noexcept { return m_chunkSize * static_cast<float_t>(m_regionWidth); }
+
+    private:
+        void LoadSettings();
+        void LoadWorldSettings();
 
     private:
         physx::PxErrorCallback* m_errorCallback = nullptr;
@@ -41,6 +76,27 @@ namespace SR_PHYSICS_NS {
         physx::PxPhysics* m_physics = nullptr;
         physx::PxFoundation* m_foundation = nullptr;
 
+        PhysXMeshCache* m_meshCache = nullptr;
+        PhysXShapeCache* m_shapeCache = nullptr;
+
+        /// convex and triangle meshes are cooked by the workers of the mesh cache, the shapes keep placeholders meanwhile
+        bool m_isAsyncCooking = true;
+        uint32_t m_cookingWorkers = 1;
+
+        PhysXDispatcherMode m_dispatcherMode = PhysXDispatcherMode::JobSystem;
+        /// zero is "auto"
+        uint32_t m_dispatcherWorkers = 0;
+
+        PhysXBroadPhaseType m_broadPhaseType = PhysXBroadPhaseType::ABP;
+        uint32_t m_broadPhaseRegions = 4;
+
+        /// static actors of a chunk are added and removed as aggregates
+        bool m_isChunkAggregates = true;
+        uint32_t m_aggregateMaxActors = 128;
+
+        SR_MATH_NS::FVector3 m_chunkSize = SR_MATH_NS::FVector3(32.f, 128.f, 32.f);
+        uint32_t m_regionWidth = 32;
+
         PhysXPvdConnection* m_pvd = nullptr;
         physx::PxPvdTransport* m_pvdTransport = nullptr;
 
@@ -9,11 +9,13 @@
 
 namespace SR_PHYSICS_NS {
     class LibraryImpl;
+    class PhysXShapeCache;
 }
 
 namespace SR_PTYPES_NS {
     class PhysicsMaterial;
 
+    /// The PxMaterial is shared with the other materials of equal parameters, see PhysXShapeCache::AcquireMaterial().
     class PhysXMaterialImpl : public PhysicsMaterialImpl {
         using Super = PhysicsMaterialImpl;
         using LibraryPtr = SR_PHYSICS_NS::LibraryImpl*;
@@ -36,7 +38,7 @@ namespace SR_PTYPES_NS {
         physx::PxMaterial* m_pxMaterial = nullptr;
         PhysicsMaterial* m_material = nullptr;
 
-        physx::PxPhysics* m_physics = nullptr;
+        SR_PHYSICS_NS::PhysXShapeCache* m_shapeCache = nullptr;
     };
 }
 
@@ -0,0 +1,143 @@
+//
+// Created by agent on 18.10.2026.
+//
+
+#ifndef SR_ENGINE_PHYSX_MESH_CACHE_H
+#define SR_ENGINE_PHYSX_MESH_CACHE_H
+
+#include <Physics/PhysX/PhysXUtils.h>
+
+#include <Utils/Common/NonCopyable.h>
+#include <Utils/FileSystem/Path.h>
+#include <Utils/Types/Thread.h>
+
+namespace SR_PHYSICS_NS {
+    /// Mesh cooked by the workers of PhysXMeshCache, the shape keeps a placeholder until it is done.
+    class PhysXCookingTask final : public SR_UTILS_NS::NonCopyable {
+        friend class PhysXMeshCache;
+        using Clock = std::chrono::steady_clock;
+
+        enum class State : uint8_t {
+            Pending, Done, Cancelled
+        };
+
+    public:
+        explicit PhysXCookingTask(uint64_t hash)
+            : SR_UTILS_NS::NonCopyable()
+            , m_hash(hash)
+            , m_start(Clock::now())
+        { }
+
+    public:
+        SR_NODISCARD bool IsDone() const noexcept { return m_state.load(std::memory_order_acquire) == State::Done; }
+        SR_NODISCARD uint64_t GetHash() const noexcept { return m_hash; }
+        /// The reference of the cache, the receiver has to return it by PhysXMeshCache::Release(). Nullptr if the cooking failed.
+        SR_NODISCARD physx::PxBase* GetMesh() const noexcept { return m_mesh; }
+        /// milliseconds from the request to the ready mesh
+        SR_NODISCARD double_t GetTime() const noexcept { return m_time; }
+
+    private:
+        /// Returns false if the task was cancelled, the mesh is not taken then.
+        bool Complete(physx::PxBase* pMesh);
+        /// Returns the mesh if the task was already done.
+        SR_NODISCARD physx::PxBase* Cancel();
+
+    private:
+        const uint64_t m_hash = 0;
+        const Clock::time_point m_start;
+
+        physx::PxBase* m_mesh = nullptr;
+        double_t m_time = 0.0;
+
+        std::atomic<State> m_state = State::Pending;
+
+    };
+
+    /**
+     * Cooked convex and triangle meshes shared between the shapes of the library.
+     * Meshes are keyed by the hash of the source data and the cooking parameters, identical meshes are cooked once
+     * and reference counted. The cooked streams are stored in Cache/PhysX/Meshes, so later runs skip the cooking.
+     * Meshes that are not in memory can be loaded or cooked by the background workers, see CookConvexMeshAsync().
+     */
+    class PhysXMeshCache : public SR_UTILS_NS::NonCopyable {
+    public:
+        using TaskPtr = std::shared_ptr<PhysXCookingTask>;
+
+        struct Statistics {
+            uint32_t meshes = 0;
+            uint32_t pending = 0;
+            uint32_t cooked = 0;
+            uint32_t loaded = 0;
+            /// sum of the times from the request to the ready mesh of the asynchronous tasks
+            double_t asyncTime = 0.0;
+            double_t maxAsyncTime = 0.0;
+            /// sum of the times of the cooking itself, in any thread
+            double_t cookingTime = 0.0;
+        };
+
+    public:
+        PhysXMeshCache(physx::PxPhysics* pPhysics, uint32_t workers);
+        ~PhysXMeshCache() override;
+
+    public:
+        SR_NODISCARD uint64_t GetConvexMeshHash(const std::vector<physx::PxVec3>& points) const;
+        SR_NODISCARD uint64_t GetTriangleMeshHash(const std::vector<physx::PxVec3>& points, const std::vector<uint32_t>& indices) const;
+
+        /// Every acquired mesh has to be returned by Release().
+        SR_NODISCARD physx::PxConvexMesh* AcquireConvexMesh(const std::vector<physx::PxVec3>& points);
+        SR_NODISCARD physx::PxTriangleMesh* AcquireTriangleMesh(const std::vector<physx::PxVec3>& points, const std::vector<uint32_t>& indices);
+
+        /// The task is done at once if the mesh is in memory or there are no workers.
+        SR_NODISCARD TaskPtr CookConvexMeshAsync(uint64_t hash, std::vector<physx::PxVec3> points);
+        SR_NODISCARD TaskPtr CookTriangleMeshAsync(uint64_t hash, std::vector<physx::PxVec3> points, std::vector<uint32_t> indices);
+        /// The mesh of the task is released when it is done.
+        void Cancel(const TaskPtr& pTask);
+
+        void Release(physx::PxBase* pMesh);
+
+        SR_NODISCARD bool IsAsync() const noexcept { return !m_workers.empty(); }
+        SR_NODISCARD Statistics GetStatistics() const;
+
+    private:
+        struct Entry {
+            physx::PxBase* pMesh = nullptr;
+            uint32_t references = 0;
+        };
+
+        SR_NODISCARD physx::PxBase* Acquire(uint64_t hash);
+        /// Returns the mesh stored in the cache, which is not the given one if the same mesh was added meanwhile.
+        SR_NODISCARD physx::PxBase* Insert(uint64_t hash, physx::PxBase* pMesh);
+
+        SR_NODISCARD physx::PxConvexMesh* CreateConvexMesh(uint64_t hash, const std::vector<physx::PxVec3>& points);
+        SR_NODISCARD physx::PxTriangleMesh* CreateTriangleMesh(uint64_t hash, const std::vector<physx::PxVec3>& points, const std::vector<uint32_t>& indices);
+
+        SR_NODISCARD TaskPtr Schedule(uint64_t hash, std::function<physx::PxBase*()> create);
+        void WorkerLoop();
+
+        SR_NODISCARD physx::PxCookingParams GetCookingParams() const;
+        SR_NODISCARD uint64_t GetParamsHash() const;
+
+        SR_NODISCARD SR_UTILS_NS::Path GetCachePath(uint64_t hash, const char* extension) const;
+        SR_NODISCARD static bool Load(const SR_UTILS_NS::Path& path, std::vector<uint8_t>& data);
+        static void Save(const SR_UTILS_NS::Path& path, const physx::PxDefaultMemoryOutputStream& stream);
+
+    private:
+        mutable std::mutex m_mutex;
+
+        physx::PxPhysics* m_physics = nullptr;
+        physx::PxCooking* m_cooking = nullptr;
+
+        std::unordered_map<uint64_t, Entry> m_entries;
+        std::unordered_map<physx::PxBase*, uint64_t> m_hashes;
+
+        std::vector<SR_HTYPES_NS::Thread::Ptr> m_workers;
+        std::deque<std::function<void()>> m_jobs;
+        std::condition_variable m_condition;
+        bool m_stopped = false;
+
+        Statistics m_statistics;
+
+    };
+}
+
+#endif //SR_ENGINE_PHYSX_MESH_CACHE_H
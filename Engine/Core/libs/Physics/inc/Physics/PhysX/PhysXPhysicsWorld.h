@@ -8,12 +8,17 @@
 #include <Physics/PhysX/PhysXUtils.h>
 #include <Physics/PhysicsWorld.h>
 
+#include <shared_mutex>
+
 namespace SR_PTYPES_NS {
     class Rigidbody;
 }
 
 namespace SR_PHYSICS_NS {
     class ContactReportCallback;
+    class PhysXJobDispatcher;
+    class PhysXChunkAggregates;
+
     class PhysXPhysicsWorld : public PhysicsWorld {
         using Super = PhysicsWorld;
     public:
@@ -26,27 +31,91 @@ namespace SR_PHYSICS_NS {
         bool Synchronize() override;
 
         bool StepSimulation(float_t step) override;
+        bool BeginStep(float_t step) override;
+        bool EndStep() override;
 
         bool AddRigidbody(RigidbodyPtr pRigidbody) override;
         bool RemoveRigidbody(RigidbodyPtr pRigidbody) override;
 
+        bool AddRigidbodies(const std::vector<RigidbodyPtr>& rigidbodies) override;
+        bool RemoveRigidbodies(const std::vector<RigidbodyPtr>& rigidbodies) override;
+
+        bool AddCharacterController(CharacterControllerPtr pController) override;
+        bool RemoveCharacterController(CharacterControllerPtr pController) override;
+
+        /// The controllers move one by one, the manager computes their mutual interactions once for all of them.
+        void MoveCharacterControllers(float_t step) override;
+
         void ForEachRigidbody3D(const SR_HTYPES_NS::Function<void(SR_PTYPES_NS::Rigidbody3D *)> &fun) override;
 
         void Flush() override;
+        void Interpolate(float_t alpha) override;
+        void RestoreSimulatedPoses() override;
+
+        /// PxScene::shiftOrigin() moves the actors and the query structures at once.
+        void ShiftOrigin(const SR_MATH_NS::FVector3& shift) override;
+
+        /// Counters of PxSimulationStatistics of the last step, the cooking time is of the whole library.
+        SR_NODISCARD PhysicsStatistics GetStatistics() const override;
+
+        SR_NODISCARD physx::PxScene* GetPxScene() const noexcept { return m_scene; }
+        SR_NODISCARD physx::PxControllerManager* GetControllerManager() const noexcept { return m_controllerManager; }
+        /// scene queries take it shared, fetching the simulation results takes it exclusively
+        SR_NODISCARD std::shared_mutex& GetQueryMutex() const noexcept { return m_queryMutex; }
+        /// nullptr if the aggregates are disabled in Physics.xml
+        SR_NODISCARD PhysXChunkAggregates* GetChunkAggregates() const noexcept { return m_aggregates; }
 
     private:
-        bool SynchronizeStatic();
-        bool SynchronizeDynamic();
+        /// Pushes the results of the last step to the rigidbodies moved by it.
+        bool SynchronizeActive();
+        /// Pushes the rigidbodies dirtied by the engine to the scene.
+        bool SynchronizeDirty();
+        /// Moves the transforms of the controllers moved since the last synchronization.
+        void SynchronizeCharacterControllers();
+
+        /// MBP regions are the regions of the world grid around the origin, see PhysXLibraryImpl::GetRegionSize().
+        /// PxScene::shiftOrigin() moves the regions with the actors, after a shift the regions left behind are removed
+        /// and the missing ones around the new origin are added and populated with the actors already in the scene.
+        void UpdateBroadPhaseRegions();
 
     private:
         physx::PxScene* m_scene = nullptr;
         physx::PxDefaultCpuDispatcher* m_cpuDispatcher = nullptr;
+        PhysXJobDispatcher* m_jobDispatcher = nullptr;
         ContactReportCallback* m_contactCallback = nullptr;
+        physx::PxBroadPhaseCallback* m_broadPhaseCallback = nullptr;
+        PhysXChunkAggregates* m_aggregates = nullptr;
+        physx::PxControllerManager* m_controllerManager = nullptr;
+
+        std::vector<CharacterControllerPtr> m_characterControllers;
+
+        std::vector<physx::PxActor*> m_batchActors;
+        std::vector<physx::PxRigidActor*> m_batchAggregated;
+        std::vector<RigidbodyPtr> m_batchRigidbodies;
+
+        /// the handles of the MBP regions by the cells of the world grid, see UpdateBroadPhaseRegions()
+        std::unordered_map<uint64_t, uint32_t> m_broadPhaseRegions;
+        /// the sum of the shifts of the origin, the regions stay on the unshifted grid
+        SR_MATH_NS::FVector3 m_broadPhaseShift = SR_MATH_NS::FVector3(SR_MATH_NS::Unit(0));
 
-        std::vector<physx::PxActor*> m_dynamicActors;
-        std::vector<physx::PxActor*> m_staticActors;
+        std::vector<physx::PxActor*> m_activeActors;
         std::vector<physx::PxActor*> m_actors;
 
+        /// rigidbodies moved by the last step, only they are interpolated
+        std::vector<RigidbodyPtr> m_movedRigidbodies;
+        /// moved by the step before, used to stop the interpolation of the bodies that fell asleep
+        std::vector<RigidbodyPtr> m_previousMovedRigidbodies;
+
+        /// set by EndStep(), interpolated bodies take a new state only once per step
+        std::atomic<bool> m_hasNewState = false;
+        /// the cooking time of the mesh cache at the previous sample
+        mutable double_t m_cookingTime = 0.0;
+
+        /// simulate() was called, but the results are not fetched yet
+        bool m_isSimulating = false;
+
+        mutable std::shared_mutex m_queryMutex;
+
     };
 }
 
@@ -6,9 +6,11 @@
 #define SR_ENGINE_PHYSXRAYCAST3DIMPL_H
 
 #include <Physics/3D/Raycast3DImpl.h>
+#include <Physics/PhysX/PhysXUtils.h>
 #include <Utils/Common/RaycastHit.h>
 
 namespace SR_PHYSICS_NS {
+    /// Scene queries go through PxScene::raycast, so the scene pruning structures (BVH) are used instead of testing every actor.
     class PhysXRaycast3DImpl : public Raycast3DImpl {
         using Super = Raycast3DImpl;
     public:
@@ -16,7 +18,12 @@ namespace SR_PHYSICS_NS {
             : Super(world)
         { }
 
-        RaycastHits Cast(const SR_MATH_NS::FVector3 &origin, const SR_MATH_NS::FVector3 &direction, float_t maxDistance, uint32_t maxHits) override;
+        RaycastHits Cast(const SR_MATH_NS::FVector3 &origin, const SR_MATH_NS::FVector3 &direction, float_t maxDistance, uint32_t maxHits, const RaycastFilter& filter) override;
+        bool CastAny(const SR_MATH_NS::FVector3 &origin, const SR_MATH_NS::FVector3 &direction, float_t maxDistance, const RaycastFilter& filter) override;
+        bool Execute(SceneQueryBatch3D& batch, const SceneQueryParallelFor& parallelFor) override;
+
+        /// word0 is the layer bit and word1 is the tag hash of the game object, see RaycastFilter
+        SR_NODISCARD static physx::PxFilterData MakeQueryFilterData(SR_UTILS_NS::StringAtom layer, SR_UTILS_NS::StringAtom tag);
     };
 }
 
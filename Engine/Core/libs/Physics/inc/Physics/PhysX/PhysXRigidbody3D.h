@@ -30,7 +30,7 @@ namespace SR_PTYPES_NS {
         SR_NODISCARD SR_MATH_NS::FVector3 GetLinearVelocity() const override;
         SR_NODISCARD SR_MATH_NS::FVector3 GetAngularVelocity() const override;
 
-        void Synchronize() override;
+        void Synchronize(bool interpolate) override;
 
         bool UpdateMatrix(bool force) override;
         bool UpdateShapeInternal() override;
@@ -40,6 +40,8 @@ namespace SR_PTYPES_NS {
 
     private:
         void UpdateLocks();
+        void ApplyGlobalPose();
+        void GetGlobalPose(SR_MATH_NS::FVector3& translation, SR_MATH_NS::Quaternion& rotation) const;
 
     private:
         physx::PxRigidActor* m_rigidActor = nullptr;
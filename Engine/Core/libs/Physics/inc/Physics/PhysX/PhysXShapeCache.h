@@ -0,0 +1,109 @@
+//
+// Created by agent on 18.10.2026.
+//
+
+#ifndef SR_ENGINE_PHYSX_SHAPE_CACHE_H
+#define SR_ENGINE_PHYSX_SHAPE_CACHE_H
+
+#include <Physics/PhysX/PhysXUtils.h>
+#include <Physics/PhysicsMaterial.h>
+
+#include <Utils/Common/NonCopyable.h>
+
+namespace SR_PHYSICS_NS {
+    /// Everything that makes a shape, shapes with equal descriptions are the same PxShape.
+    struct PhysXShapeDesc {
+        physx::PxGeometryHolder geometry;
+        physx::PxMaterial* pMaterial = nullptr;
+        physx::PxTransform localPose = physx::PxTransform(physx::PxIdentity);
+        physx::PxShapeFlags flags = physx::PxShapeFlag::eVISUALIZATION | physx::PxShapeFlag::eSCENE_QUERY_SHAPE | physx::PxShapeFlag::eSIMULATION_SHAPE;
+        physx::PxFilterData simulationFilterData;
+        physx::PxFilterData queryFilterData;
+    };
+
+    /**
+     * Materials and shapes shared between the actors of the library.
+     * PhysicsMaterial resources with equal parameters get one PxMaterial, rigidbodies without a material use the default one.
+     * Shapes are created as not exclusive and reference counted, so a prefab instanced many times has a shape per distinct
+     * geometry instead of a shape per object. Shared shapes are immutable: a changed shape is replaced by another one.
+     */
+    class PhysXShapeCache : public SR_UTILS_NS::NonCopyable {
+    public:
+        struct Statistics {
+            uint32_t materials = 0;
+            uint32_t shapes = 0;
+            /// acquired shapes, the difference with the shapes is the number of saved ones
+            uint32_t shapeReferences = 0;
+        };
+
+    public:
+        explicit PhysXShapeCache(physx::PxPhysics* pPhysics);
+        ~PhysXShapeCache() override;
+
+    public:
+        /// Every acquired material has to be returned by ReleaseMaterial().
+        SR_NODISCARD physx::PxMaterial* AcquireMaterial(const SR_PTYPES_NS::PhysicsMaterialData& data);
+        void ReleaseMaterial(physx::PxMaterial* pMaterial);
+        /// Owned by the cache, used by the shapes without a PhysicsMaterial.
+        SR_NODISCARD physx::PxMaterial* GetDefaultMaterial() const noexcept { return m_defaultMaterial; }
+
+        /// Every acquired shape has to be returned by ReleaseShape(), the shape must not be modified.
+        SR_NODISCARD physx::PxShape* AcquireShape(const PhysXShapeDesc& desc);
+        void ReleaseShape(physx::PxShape* pShape);
+
+        SR_NODISCARD Statistics GetStatistics() const;
+
+    private:
+        struct MaterialKey {
+            float_t staticFriction = 0.f;
+            float_t dynamicFriction = 0.f;
+            float_t restitution = 0.f;
+            physx::PxCombineMode::Enum frictionCombine = physx::PxCombineMode::eAVERAGE;
+            physx::PxCombineMode::Enum restitutionCombine = physx::PxCombineMode::eAVERAGE;
+
+            bool operator==(const MaterialKey& other) const noexcept;
+        };
+
+        struct ShapeKey {
+            physx::PxGeometryType::Enum type = physx::PxGeometryType::eINVALID;
+            /// half extents of a box, radius and half height of a capsule, radius of a sphere
+            physx::PxVec3 dimensions = physx::PxVec3(0.f);
+            const void* pMesh = nullptr;
+            physx::PxMeshScale meshScale;
+            physx::PxMaterial* pMaterial = nullptr;
+            physx::PxTransform localPose = physx::PxTransform(physx::PxIdentity);
+            uint8_t flags = 0;
+            physx::PxFilterData simulationFilterData;
+            physx::PxFilterData queryFilterData;
+
+            bool operator==(const ShapeKey& other) const noexcept;
+        };
+
+        struct KeyHash {
+            size_t operator()(const MaterialKey& key) const noexcept;
+            size_t operator()(const ShapeKey& key) const noexcept;
+        };
+
+        template<typename T> struct Entry {
+            T* pObject = nullptr;
+            uint32_t references = 0;
+        };
+
+        SR_NODISCARD static ShapeKey MakeShapeKey(const PhysXShapeDesc& desc);
+
+    private:
+        mutable std::mutex m_mutex;
+
+        physx::PxPhysics* m_physics = nullptr;
+        physx::PxMaterial* m_defaultMaterial = nullptr;
+
+        std::unordered_map<MaterialKey, Entry<physx::PxMaterial>, KeyHash> m_materials;
+        std::unordered_map<physx::PxMaterial*, MaterialKey> m_materialKeys;
+
+        std::unordered_map<ShapeKey, Entry<physx::PxShape>, KeyHash> m_shapes;
+        std::unordered_map<physx::PxShape*, ShapeKey> m_shapeKeys;
+
+    };
+}
+
+#endif //SR_ENGINE_PHYSX_SHAPE_CACHE_H
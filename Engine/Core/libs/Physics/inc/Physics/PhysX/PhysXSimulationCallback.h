@@ -7,8 +7,48 @@
 
 #include <Physics/PhysX/PhysXUtils.h>
 
+#include <Utils/Math/Vector3.h>
+
+namespace SR_PTYPES_NS {
+    class Rigidbody;
+}
+
 namespace SR_PHYSICS_NS {
+    /**
+     * Collects the contacts and the triggers reported by fetchResults() into a flat buffer,
+     * the components are called later by Dispatch() from the synchronization.
+     * Only the events the rigidbodies listen to are stored (see Rigidbody::SetContactEvents()),
+     * the contact points are extracted only for them. Events repeated by a step are stored once.
+     */
     class ContactReportCallback : public physx::PxSimulationEventCallback {
+        enum class EventType : uint8_t {
+            CollisionEnter, CollisionStay, CollisionExit, TriggerEnter, TriggerExit
+        };
+
+        struct Event {
+            SR_PTYPES_NS::Rigidbody* pRigidbodies[2] = { nullptr, nullptr };
+            EventType type = EventType::CollisionEnter;
+            SR_MATH_NS::FVector3 point;
+            SR_MATH_NS::FVector3 impulse;
+        };
+
+        struct EventKey {
+            SR_PTYPES_NS::Rigidbody* pFirst = nullptr;
+            SR_PTYPES_NS::Rigidbody* pSecond = nullptr;
+            EventType type = EventType::CollisionEnter;
+
+            bool operator==(const EventKey& other) const noexcept {
+                return pFirst == other.pFirst && pSecond == other.pSecond && type == other.type;
+            }
+        };
+
+        struct EventKeyHash {
+            size_t operator()(const EventKey& key) const noexcept {
+                const size_t hash = std::hash<void*>()(key.pFirst) ^ (std::hash<void*>()(key.pSecond) << 1);
+                return hash ^ (static_cast<size_t>(key.type) << 3);
+            }
+        };
+
     public:
         void onConstraintBreak(physx::PxConstraintInfo* constraints, physx::PxU32 count) override { };
         void onWake(physx::PxActor** actors, physx::PxU32 count) override { };
@@ -16,6 +56,25 @@ namespace SR_PHYSICS_NS {
         void onContact(const physx::PxContactPairHeader &pairHeader, const physx::PxContactPair *pairs, physx::PxU32 nbPairs) override;
         void onTrigger(physx::PxTriggerPair* pairs, physx::PxU32 count) override;
         void onAdvance(const physx::PxRigidBody*const* bodyBuffer, const physx::PxTransform* poseBuffer, const physx::PxU32 count) override { };
+
+    public:
+        /// Must be called before fetchResults(), the deduplication is done within a step.
+        void BeginStep() { m_keys.clear(); }
+        /// Calls the components for the buffered events and clears the buffer, must be called from the scene thread.
+        void Dispatch();
+        /// Drops the buffered events of the rigidbody, it can be deleted after it.
+        void Remove(SR_PTYPES_NS::Rigidbody* pRigidbody);
+
+    private:
+        void AddEvent(SR_PTYPES_NS::Rigidbody* pFirst, SR_PTYPES_NS::Rigidbody* pSecond, EventType type, const physx::PxContactPair* pPair);
+        static void Dispatch(const Event& event, uint8_t index);
+        SR_NODISCARD static bool IsListening(const SR_PTYPES_NS::Rigidbody* pRigidbody, EventType type);
+
+    private:
+        std::vector<Event> m_events;
+        std::vector<Event> m_dispatched;
+        std::unordered_set<EventKey, EventKeyHash> m_keys;
+
     };
 }
 
@@ -8,6 +8,7 @@
 #include <Utils/Common/Measurement.h>
 #include <Utils/Common/Singleton.h>
 #include <Utils/Math/Vector3.h>
+#include <Utils/Types/Function.h>
 
 #include <Physics/Utils/Utils.h>
 
@@ -23,6 +24,11 @@ namespace SR_PHYSICS_NS {
         using Super = SR_UTILS_NS::Singleton<PhysicsLibrary>;
         using Space = SR_UTILS_NS::Measurement;
         using LibraryTypes = std::vector<LibraryType>;
+    public:
+        using Job = std::function<void()>;
+        /// Schedules a job to the worker pool of the engine, must be callable from the jobs themselves.
+        using JobScheduler = SR_HTYPES_NS::Function<void(Job)>;
+
     public:
         PhysicsLibrary();
         ~PhysicsLibrary() override;
@@ -34,16 +40,45 @@ namespace SR_PHYSICS_NS {
 
         SR_NODISCARD SR_PTYPES_NS::PhysicsMaterial* GetDefaultMaterial() const noexcept { return m_defaultMaterial; }
 
+        /// Worlds created after this call may run the solver on the given pool, see PhysXJobDispatcher.
+        void SetJobScheduler(JobScheduler scheduler, uint32_t workers);
+        SR_NODISCARD const JobScheduler& GetJobScheduler() const noexcept { return m_jobScheduler; }
+        SR_NODISCARD uint32_t GetJobWorkersCount() const noexcept { return m_jobWorkers; }
+
+        /// Bits of the layers the given layer collides with, see the CollisionMatrix node of Physics.xml.
+        SR_NODISCARD uint32_t GetCollisionMask(SR_UTILS_NS::StringAtom layer) const;
+        /// Triggers don't report the static rigidbodies when it is disabled.
+        SR_NODISCARD bool IsTriggersVsStaticEnabled() const noexcept { return m_triggersVsStatic; }
+
+        /// The physics scenes take a sample of PhysicsStatistics per synchronization, see the Statistics node of Physics.xml.
+        void SetStatisticsEnabled(bool enabled) noexcept { m_statisticsEnabled = enabled; }
+        SR_NODISCARD bool IsStatisticsEnabled() const noexcept { return m_statisticsEnabled; }
+
+        /// Index of the layer in the collision matrix, only the first 32 layers of the LayerManager have own bits.
+        SR_NODISCARD static uint32_t GetLayerIndex(SR_UTILS_NS::StringAtom layer);
+
     protected:
         void InitSingleton() override;
         void OnSingletonDestroy() override;
 
+    private:
+        void LoadCollisionMatrix(const SR_XML_NS::Node& node);
+
     private:
         std::vector<LibraryImpl*> m_libraries;
         std::map<Space, LibraryType> m_activeLibs;
         std::set<LibraryType> m_supportedLibs;
 
         SR_PTYPES_NS::PhysicsMaterial* m_defaultMaterial = nullptr;
+
+        JobScheduler m_jobScheduler;
+        uint32_t m_jobWorkers = 0;
+
+        /// every layer collides with every layer by default
+        std::array<uint32_t, 32> m_collisionMatrix = { };
+        bool m_triggersVsStatic = true;
+        std::atomic<bool> m_statisticsEnabled = false;
+
     };
 }
 
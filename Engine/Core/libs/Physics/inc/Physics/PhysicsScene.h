@@ -6,6 +6,7 @@
 #define SR_ENGINE_PHYSICSSCENE_H
 
 #include <Physics/PhysicsLib.h>
+#include <Physics/PhysicsStatistics.h>
 #include <Utils/Types/SafePointer.h>
 
 namespace SR_WORLD_NS {
@@ -14,17 +15,29 @@ namespace SR_WORLD_NS {
 
 namespace SR_PHYSICS_NS::Types {
     class Rigidbody;
+    class CharacterController3D;
 }
 
 namespace SR_PHYSICS_NS {
     class PhysicsWorld;
 
+    /**
+     * A step can stay in flight between BeginStep() and EndStep(), the solver runs on the workers meanwhile.
+     * While a step is in flight the gameplay code may:
+     *  - read the transforms and the velocities of the rigidbodies, they are the results of the previous step;
+     *  - run scene queries, they see the world of the previous step;
+     *  - register and remove rigidbodies, set velocities and move transforms, these writes are buffered
+     *    and take effect in the next step.
+     * It must not release rigidbodies bypassing Remove(), and BeginStep(), EndStep() and Synchronize()
+     * must not run concurrently with the gameplay code.
+     */
     class PhysicsScene : public SR_HTYPES_NS::SafePtr<PhysicsScene> {
         friend class SR_HTYPES_NS::SafePtr<PhysicsScene>;
     public:
         using Super = SR_HTYPES_NS::SafePtr<PhysicsScene>;
         using Ptr = Super;
         using RigidbodyPtr = SR_PTYPES_NS::Rigidbody*;
+        using CharacterControllerPtr = SR_PTYPES_NS::CharacterController3D*;
         using PhysicsWorldPtr = SR_PHYSICS_NS::PhysicsWorld*;
         using LibraryPtr = SR_PHYSICS_NS::LibraryImpl*;
         using ScenePtr = SR_HTYPES_NS::SharedPtr<SR_WORLD_NS::Scene>;
@@ -38,25 +51,111 @@ namespace SR_PHYSICS_NS {
         virtual void FixedUpdate();
         virtual bool Init();
 
+        /// Can be called from any thread, steps are simulated by Simulate().
+        void RequestStep(float_t step);
+        /// Can be called from any thread. The world origin is moved by the shift, the positions of the rigidbodies and
+        /// their transforms get "+ shift". Applied once per all rigidbodies before the next step or synchronization.
+        void RequestOriginShift(const SR_MATH_NS::FVector3& shift);
+        /// Wraps the code which moves all root transforms by the shift of the world offset (the scene logic).
+        /// The rigidbodies moved in between are checked once against the shift instead of being queued one by one.
+        /// Must be called from the scene thread while the simulation is not running.
+        void BeginOriginShift();
+        void EndOriginShift(const SR_MATH_NS::FVector3& shift);
+        /// Called by the rigidbody whose transform is moved between BeginOriginShift() and EndOriginShift().
+        void DeferOriginShift(RigidbodyPtr pRigidbody);
+        /// Simulates all requested steps and ends the step in flight without synchronizing the rigidbodies.
+        bool Simulate();
+        /// Starts the requested steps, the last one stays in flight until EndStep(). The step in flight is ended first.
+        bool BeginStep();
+        /// Waits for the step in flight, returns false if there is no step in flight.
+        bool EndStep();
+        /// Pushes the simulation results to the rigidbodies, must be called from the scene thread.
+        void Synchronize();
+
+        /// Moves interpolated rigidbodies between the two last synchronized states, must be called from the scene thread.
+        /// The pose is only shown, it is called after the gameplay code of the frame.
+        void Interpolate(float_t alpha);
+        /// Puts the interpolated rigidbodies back to the simulated states before the gameplay code of the next frame.
+        void RestoreSimulatedPoses();
+
+        SR_NODISCARD bool HasRequestedSteps() const;
+        SR_NODISCARD bool IsStepInFlight() const noexcept { return m_isStepInFlight; }
+        SR_NODISCARD bool IsOriginShifting() const noexcept { return m_isOriginShifting; }
+        /// The sum of the applied shifts, the rigidbodies catch up with it by Rigidbody::CatchUpOrigin().
+        SR_NODISCARD SR_MATH_NS::FVector3 GetOriginShift() const noexcept { return m_originShift; }
+
         virtual void Remove(RigidbodyPtr pRigidbody);
         virtual void Register(RigidbodyPtr pRigidbody);
 
+        /// Buffered the same way as the rigidbodies, the controllers live in the 3D world.
+        void Remove(CharacterControllerPtr pController);
+        void Register(CharacterControllerPtr pController);
+
         virtual void ClearForces();
 
+        /// See PhysicsWorld::MarkDirty(), can be called from any thread.
+        void MarkDirty(RigidbodyPtr pRigidbody);
+
+        /// The worlds are nullptr until a rigidbody of their space is registered.
         SR_NODISCARD SR_PHYSICS_NS::PhysicsWorld* Get2DWorld() const noexcept { return m_2DWorld; }
         SR_NODISCARD SR_PHYSICS_NS::PhysicsWorld* Get3DWorld() const noexcept { return m_3DWorld; }
         SR_NODISCARD bool IsDebugEnabled() const noexcept;
 
+        SR_NODISCARD float_t GetFixedStep() const noexcept { return m_fixedStep; }
+        SR_NODISCARD float_t GetInterpolationAlpha() const noexcept { return m_interpolationAlpha; }
+        SR_NODISCARD bool IsInterpolationEnabled() const noexcept { return m_interpolation; }
+        /// Filled by Synchronize() while PhysicsLibrary::IsStatisticsEnabled(), can be read from any thread.
+        SR_NODISCARD const PhysicsStatisticsHistory& GetStatistics() const noexcept { return m_statistics; }
+
         void SetIsGameMode(bool enabled) noexcept { m_isGameMode = enabled; }
+        void SetFixedStep(float_t step) noexcept { m_fixedStep = step; }
+        void SetInterpolationEnabled(bool enabled);
 
     private:
         virtual bool Flush();
-        virtual bool CreateDynamicWorld();
+        /// Applies the buffered registrations and forces and moves the character controllers before a step.
+        void PrepareStep(float_t step);
+        void StepSimulation(float_t dt);
+        /// Moves the worlds by the requested shift, the step must not be in flight.
+        void ApplyOriginShift();
+        /// Sums up the worlds and the times of the scene into a sample of the history.
+        void TakeStatisticsSample();
+
+        /// Scenes without rigidbodies of a space don't have its world, it is created by the first registered one.
+        SR_NODISCARD PhysicsWorldPtr GetOrCreateWorld(Space space);
+        SR_NODISCARD PhysicsWorldPtr GetWorld(ShapeType type) const;
+
+        template<typename T> void ForEachWorld(const T& function) {
+            if (m_2DWorld) {
+                function(m_2DWorld);
+            }
+
+            if (m_3DWorld) {
+                function(m_3DWorld);
+            }
+        }
 
     private:
+        mutable std::recursive_mutex m_mutex;
+
+        std::vector<float_t> m_requestedSteps;
+        SR_MATH_NS::FVector3 m_requestedOriginShift = SR_MATH_NS::FVector3(SR_MATH_NS::Unit(0));
+        /// written by ApplyOriginShift() only while the scene thread does not touch the rigidbodies
+        SR_MATH_NS::FVector3 m_originShift = SR_MATH_NS::FVector3(SR_MATH_NS::Unit(0));
+
+        /// the scene thread only, between BeginOriginShift() and EndOriginShift()
+        std::vector<RigidbodyPtr> m_originShiftedRigidbodies;
+        bool m_isOriginShifting = false;
+
         std::list<SR_PTYPES_NS::Rigidbody*> m_rigidbodyToRemove;
         std::list<SR_PTYPES_NS::Rigidbody*> m_rigidbodyToRegister;
 
+        std::list<CharacterControllerPtr> m_controllerToRemove;
+        std::list<CharacterControllerPtr> m_controllerToRegister;
+
+        std::vector<RigidbodyPtr> m_flushBatch2D;
+        std::vector<RigidbodyPtr> m_flushBatch3D;
+
         ScenePtr m_scene;
 
         LibraryPtr m_library2D = nullptr;
@@ -65,9 +164,19 @@ namespace SR_PHYSICS_NS {
         PhysicsWorldPtr m_2DWorld = nullptr;
         PhysicsWorldPtr m_3DWorld = nullptr;
 
+        std::atomic<bool> m_isStepInFlight = false;
+
         bool m_needClearForces = false;
         bool m_debugEnabled = true;
         bool m_isGameMode = false;
+        bool m_interpolation = false;
+
+        PhysicsStatisticsHistory m_statistics;
+        /// times of the scene since the last sample, the counters are taken from the worlds
+        PhysicsStatistics m_sampleTimes;
+
+        float_t m_fixedStep = 1.f / 60.f;
+        float_t m_interpolationAlpha = 0.f;
 
     };
 }
@@ -0,0 +1,68 @@
+//
+// Created by agent on 18.10.2026.
+//
+
+#ifndef SR_ENGINE_PHYSICS_STATISTICS_H
+#define SR_ENGINE_PHYSICS_STATISTICS_H
+
+#include <Utils/Common/NonCopyable.h>
+#include <Utils/FileSystem/Path.h>
+
+namespace SR_PHYSICS_NS {
+    /// A sample per synchronization of the physics scene, the worlds of both spaces are summed up.
+    struct PhysicsStatistics {
+        uint32_t activeBodies = 0;
+        uint32_t staticBodies = 0;
+        uint32_t sleepingBodies = 0;
+        /// pairs with overlapping bounds, the input of the narrowphase
+        uint32_t broadPhasePairs = 0;
+        /// pairs with touching contact points
+        uint32_t contacts = 0;
+        /// simulation islands, PhysX does not report them and gives the partitions of the solver instead
+        uint32_t islands = 0;
+
+        /// milliseconds of the calling thread, a step in flight runs in the background between simulate and fetch
+        double_t simulateTime = 0.0;
+        double_t fetchTime = 0.0;
+        double_t synchronizeTime = 0.0;
+        /// the dispatch of the contact events to the components, a part of the synchronization
+        double_t callbackTime = 0.0;
+        /// meshes cooked since the previous sample
+        double_t cookingTime = 0.0;
+
+        /// phases of the step reported by the backend itself (Box2D), PhysX and Bullet do not report them
+        double_t broadPhaseTime = 0.0;
+        double_t narrowPhaseTime = 0.0;
+        double_t solverTime = 0.0;
+        /// the times of the phases are measured, otherwise they are zero and mean nothing
+        bool hasPhaseTimes = false;
+
+        PhysicsStatistics& operator+=(const PhysicsStatistics& other);
+    };
+
+    /// Rolling window of the last samples. Written by the scene thread, read by any other under the lock.
+    class PhysicsStatisticsHistory : public SR_UTILS_NS::NonCopyable {
+    public:
+        static constexpr uint32_t Capacity = 256;
+
+    public:
+        void Push(const PhysicsStatistics& statistics);
+        void Reset();
+
+        /// From the oldest sample to the newest one.
+        SR_NODISCARD std::vector<PhysicsStatistics> GetSamples() const;
+        SR_NODISCARD PhysicsStatistics GetLast() const;
+        /// Samples pushed since the cursor that are still in the window, the cursor is moved past the newest one.
+        SR_NODISCARD std::vector<PhysicsStatistics> GetSamplesSince(uint64_t& cursor) const;
+
+        bool DumpCSV(const SR_UTILS_NS::Path& path) const;
+
+    private:
+        mutable std::mutex m_mutex;
+        std::array<PhysicsStatistics, Capacity> m_samples = { };
+        uint64_t m_count = 0;
+
+    };
+}
+
+#endif //SR_ENGINE_PHYSICS_STATISTICS_H
@@ -6,9 +6,15 @@
 #define SR_ENGINE_PHYSICSWORLD_H
 
 #include <Physics/Utils/Utils.h>
+#include <Physics/PhysicsStatistics.h>
+
+namespace SR_PTYPES_NS {
+    class CharacterController3D;
+}
 
 namespace SR_PHYSICS_NS {
     class LibraryImpl;
+    class Raycast2DImpl;
     class Raycast3DImpl;
 
     class PhysicsWorld : public SR_UTILS_NS::NonCopyable {
@@ -16,6 +22,7 @@ namespace SR_PHYSICS_NS {
         using Super = SR_UTILS_NS::NonCopyable;
         using LibraryPtr = SR_PHYSICS_NS::LibraryImpl*;
         using RigidbodyPtr = SR_PTYPES_NS::Rigidbody*;
+        using CharacterControllerPtr = SR_PTYPES_NS::CharacterController3D*;
         using Space = SR_UTILS_NS::Measurement;
     public:
         explicit PhysicsWorld(LibraryPtr pLibrary, Space space);
@@ -23,21 +30,60 @@ namespace SR_PHYSICS_NS {
 
     public:
         virtual bool StepSimulation(float_t step) { return false; }
+        /// Starts the step without waiting for it. Worlds that can't simulate in the background only keep the step,
+        /// it is simulated by EndStep() on the thread that ends it, see PhysicsSimulationState.
+        virtual bool BeginStep(float_t step);
+        /// Waits for the step started by BeginStep() and fetches its results.
+        virtual bool EndStep();
         virtual bool Initialize() { return false; }
         virtual bool ClearForces() { return false; }
         virtual bool Synchronize() { return false; }
 
         virtual void Flush() { }
 
+        /// Moves the origin of the world in one call instead of teleporting every body, the positions get "+ shift".
+        /// The physics scene has already added the shift to its origin, implementations call Rigidbody::CatchUpOrigin()
+        /// for the moved and dirty rigidbodies only, see CatchUpOrigin(). Backends without an origin of their own
+        /// move every object by Rigidbody::ShiftOrigin().
+        virtual void ShiftOrigin(const SR_MATH_NS::FVector3& shift) { }
+
+        /// Moves interpolated rigidbodies between the two last simulated states, alpha is in [0, 1].
+        virtual void Interpolate(float_t alpha) { }
+        /// Puts the interpolated rigidbodies back to their last simulated states, see Rigidbody::Interpolate().
+        virtual void RestoreSimulatedPoses() { }
+
+        void SetInterpolationEnabled(bool enabled) noexcept { m_interpolation = enabled; }
+        SR_NODISCARD bool IsInterpolationEnabled() const noexcept { return m_interpolation; }
+
         virtual bool AddRigidbody(RigidbodyPtr pRigidbody) { return false; }
         virtual bool RemoveRigidbody(RigidbodyPtr pRigidbody) { return false; }
 
+        /// Used by the flush of the physics scene, worlds which can add and remove bodies in bulk override them.
+        virtual bool AddRigidbodies(const std::vector<RigidbodyPtr>& rigidbodies);
+        virtual bool RemoveRigidbodies(const std::vector<RigidbodyPtr>& rigidbodies);
+
+        virtual bool AddCharacterController(CharacterControllerPtr pController) { return false; }
+        virtual bool RemoveCharacterController(CharacterControllerPtr pController) { return false; }
+
+        /// Executes the queued moves of all character controllers in one pass, called once per step before it is started.
+        virtual void MoveCharacterControllers(float_t step) { }
+
         virtual void ForEachRigidbody3D(const SR_HTYPES_NS::Function<void(SR_PTYPES_NS::Rigidbody3D *)> &fun) { }
 
         bool ReAddRigidbody(RigidbodyPtr pRigidbody) {
             return RemoveRigidbody(pRigidbody) && AddRigidbody(pRigidbody);
         }
 
+        /// Queues the rigidbody for the next Synchronize(), which pushes its dirty transform, shape and body to the world.
+        /// Rigidbodies that are not dirtied and not moved by the simulation are not visited by the synchronization.
+        void MarkDirty(RigidbodyPtr pRigidbody);
+        void MarkDirty(const std::vector<RigidbodyPtr>& rigidbodies);
+
+        /// The counters of the backend and the times measured by the world since the last ResetStatistics().
+        SR_NODISCARD virtual PhysicsStatistics GetStatistics() const { return m_statistics; }
+        void ResetStatistics() { m_statistics = PhysicsStatistics(); }
+
+        SR_NODISCARD Raycast2DImpl* GetRaycast2DImpl() const noexcept { return m_raycast2dImpl; }
         SR_NODISCARD Raycast3DImpl* GetRaycast3DImpl() const noexcept { return m_raycast3dImpl; }
 
         template<typename T> SR_NODISCARD T* GetLibrary() const {
@@ -50,10 +96,29 @@ namespace SR_PHYSICS_NS {
             return nullptr;
         }
 
+    protected:
+        SR_NODISCARD std::vector<RigidbodyPtr> TakeDirtyRigidbodies();
+        /// The rigidbodies that keep a simulated state (moved, interpolated) and the dirty ones catch up with
+        /// the shift of the origin, the others do it when they are touched next.
+        void CatchUpOrigin(const std::vector<RigidbodyPtr>& moved, const std::vector<RigidbodyPtr>& previousMoved);
+        /// Must be called by RemoveRigidbody(), the rigidbody can be deleted after it.
+        void UnmarkDirty(RigidbodyPtr pRigidbody);
+
     protected:
         LibraryPtr m_library = nullptr;
         Space m_space = Space::Unknown;
+        Raycast2DImpl* m_raycast2dImpl = nullptr;
         Raycast3DImpl* m_raycast3dImpl = nullptr;
+        bool m_interpolation = false;
+
+        PhysicsStatistics m_statistics;
+
+    private:
+        /// kept by the default BeginStep() until EndStep()
+        std::optional<float_t> m_deferredStep;
+
+        std::mutex m_dirtyMutex;
+        std::unordered_set<RigidbodyPtr> m_dirtyRigidbodies;
 
     };
 }
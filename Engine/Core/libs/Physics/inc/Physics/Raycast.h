@@ -10,6 +10,16 @@
 namespace SR_PHYSICS_NS {
     class PhysicsWorld;
 
+    /// Selects the rigidbodies a ray can hit by the layer and the tag of their game objects.
+    struct RaycastFilter {
+        static constexpr uint32_t AllLayers = std::numeric_limits<uint32_t>::max();
+
+        /// bits of the layer indices, see Raycast3D::GetLayerMask() and Raycast3D::GetCollisionLayerMask()
+        uint32_t layerMask = AllLayers;
+        /// empty means any tag
+        SR_UTILS_NS::StringAtom tag;
+    };
+
     class Raycast {
     public:
         using RaycastHits = std::vector<SR_UTILS_NS::RaycastHit>;
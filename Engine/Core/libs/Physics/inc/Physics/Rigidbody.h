@@ -12,6 +12,7 @@
 #include <Utils/ECS/ComponentManager.h>
 #include <Utils/ECS/Component.h>
 #include <Utils/Types/SafePointer.h>
+#include <Utils/Types/Function.h>
 #include <Utils/Math/Matrix4x4.h>
 
 namespace SR_HTYPES_NS {
@@ -48,7 +49,19 @@ namespace SR_PTYPES_NS {
         virtual void UpdateInertia() { }
         virtual void ClearForces() { }
 
-        virtual void Synchronize() { }
+        /// If "interpolate" is set, the last simulated state is kept for Interpolate() as well.
+        /// The base puts the transform to the last simulated state then, implementations call it at the end.
+        virtual void Synchronize(bool interpolate);
+
+        /// Shows the pose between the two last simulated states, returns false if there is nothing to interpolate.
+        bool Interpolate(float_t alpha);
+        /// Puts the transform back to the last simulated state after Interpolate().
+        void RestoreSimulatedPose();
+
+        /// Moves the object of the backend, for the backends which can't move the origin of their world (Bullet).
+        virtual void ShiftOrigin(const SR_MATH_NS::FVector3& shift) { }
+        /// Moves the cached simulated states, called by Rigidbody::CatchUpOrigin().
+        void ShiftSimulatedState(const SR_MATH_NS::FVector3& shift);
 
         virtual bool InitBody() { return true; }
 
@@ -60,11 +73,21 @@ namespace SR_PTYPES_NS {
             return dynamic_cast<T*>(m_rigidbody);
         }
 
+        void PushInterpolationState(const SR_MATH_NS::FVector3& translation, const SR_MATH_NS::Quaternion& rotation);
+        void ResetInterpolation() { m_isInterpolated = false; }
+
     protected:
         Rigidbody* m_rigidbody = nullptr;
         SR_MATH_NS::Quaternion m_rigidbodyRotation = SR_MATH_NS::InfinityQuaternion;
         SR_MATH_NS::FVector3 m_rigidbodyTranslation = SR_MATH_NS::InfinityFV3;
 
+        /// two last simulated states in the transform space
+        SR_MATH_NS::FVector3 m_previousTranslation;
+        SR_MATH_NS::Quaternion m_previousRotation = SR_MATH_NS::Quaternion::Identity();
+        SR_MATH_NS::FVector3 m_currentTranslation;
+        SR_MATH_NS::Quaternion m_currentRotation = SR_MATH_NS::Quaternion::Identity();
+        bool m_isInterpolated = false;
+
     };
 
     /// ----------------------------------------------------------------------------------------------------------------
@@ -75,12 +98,30 @@ namespace SR_PTYPES_NS {
         using Super = SR_UTILS_NS::Component;
         using LibraryPtr = SR_PHYSICS_NS::LibraryImpl*;
         using PhysicsScenePtr = SR_HTYPES_NS::SafePtr<PhysicsScene>;
+    public:
+        using ShapeCookedCallback = SR_HTYPES_NS::Function<void(Rigidbody*)>;
+
     public:
         ~Rigidbody() override;
 
     public:
         bool UpdateMatrix(bool force = false);
-        void Synchronize();
+        void Synchronize(bool interpolate = false);
+        /// The interpolated pose is only shown: it is put to the transform after the gameplay code of the frame
+        /// and RestoreSimulatedPose() moves the transform back to the simulated pose before the next one.
+        void Interpolate(float_t alpha);
+        void RestoreSimulatedPose();
+        /// Moves the transform to a pose of the simulation, it is not a move of the gameplay and it is not queued.
+        void ApplyPose(const SR_MATH_NS::FVector3& translation, const SR_MATH_NS::Quaternion& rotation);
+
+        /// Moves the object of the backend by the shift of the world origin, see RigidbodyImpl::ShiftOrigin().
+        void ShiftOrigin(const SR_MATH_NS::FVector3& shift);
+        /// The cached poses are moved by the shifts of the origin applied to the physics scene since the last call.
+        /// The worlds call it only for the moved and dirty rigidbodies, the others catch up when they are touched.
+        void CatchUpOrigin();
+        /// Called by the physics scene for the transforms moved while the origin was being shifted.
+        /// Returns false if the transform has moved by more than the requested shift, it has to be synchronized then.
+        SR_NODISCARD bool ResolveOriginShift(const SR_MATH_NS::FVector3& requestedShift);
 
         std::string GetEntityInfo() const override;
 
@@ -98,6 +139,8 @@ namespace SR_PTYPES_NS {
         SR_NODISCARD float_t GetMass() const noexcept;
         SR_NODISCARD bool IsTrigger() const noexcept { return m_isTrigger; }
         SR_NODISCARD bool IsStatic() const noexcept { return m_isStatic; }
+        SR_NODISCARD ContactEventFlags GetContactEvents() const noexcept;
+        SR_NODISCARD SR_UTILS_NS::StringAtom GetCollisionLayer() const;
         SR_NODISCARD bool IsMatrixDirty() const noexcept { return m_isMatrixDirty; }
         SR_NODISCARD bool IsShapeDirty() const noexcept { return m_isShapeDirty; }
         SR_NODISCARD bool IsBodyDirty() const noexcept { return m_isBodyDirty; }
@@ -112,12 +155,21 @@ namespace SR_PTYPES_NS {
         SR_NODISCARD RBUpdShapeRes UpdateShape();
         SR_NODISCARD bool IsShapeSupported(ShapeType type) const;
 
-        void SetMatrixDirty(bool value) { m_isMatrixDirty = value; }
-        void SetShapeDirty(bool value) { m_isShapeDirty = value; }
+        /// Dirty rigidbodies are queued for the synchronization of the physics world.
+        void SetMatrixDirty(bool value);
+        void SetShapeDirty(bool value);
+
+        /// Called from the physics synchronization when the cooked mesh replaces the placeholder of the shape.
+        void SetShapeCookedCallback(ShapeCookedCallback callback) { m_shapeCookedCallback = std::move(callback); }
 
         virtual void SetIsTrigger(bool value);
         virtual void SetIsStatic(bool value);
 
+        /// Stay events are reported only on request, they are sent every step for every touching pair.
+        void SetContactEvents(ContactEventFlags events);
+        /// Layer of the collision matrix (see PhysicsLibrary::GetCollisionMask()), empty means the layer of the game object.
+        void SetCollisionLayer(SR_UTILS_NS::StringAtom layer);
+
         virtual void SetCenter(const SR_MATH_NS::FVector3& center);
         virtual void SetType(ShapeType type);
         void SetMass(float_t mass);
@@ -138,8 +190,14 @@ namespace SR_PTYPES_NS {
             return nullptr;
         }
 
+        /// The worlds of the backends which own the bodies (Box2D) reach their implementation by it.
+        template<typename T> SR_NODISCARD T* GetImpl() const {
+            return dynamic_cast<T*>(m_impl);
+        }
+
     protected:
         bool UpdateShapeInternal();
+        void QueueSynchronization();
 
         void Update(float_t dt) override;
         void Start() override;
@@ -152,9 +210,8 @@ namespace SR_PTYPES_NS {
 
         SR_NODISCARD const PhysicsScenePtr& GetPhysicsScene() const;
 
-        template<typename T> SR_NODISCARD T* GetImpl() const {
-            return dynamic_cast<T*>(m_impl);
-        }
+        /// The transform is in the pose which was synchronized with the simulation last, moved by the offset.
+        SR_NODISCARD bool IsPoseSynchronized(const SR_MATH_NS::FVector3& offset = SR_MATH_NS::FVector3(SR_MATH_NS::Unit(0))) const;
 
     protected:
         /// shape всегда присутствует, но у него может отличаться внутрення реализация
@@ -169,6 +226,13 @@ namespace SR_PTYPES_NS {
 
         SR_MATH_NS::FVector3 m_scale = SR_MATH_NS::FVector3::One();
 
+        /// the pose at the last clearing of the dirty matrix
+        SR_MATH_NS::FVector3 m_synchronizedTranslation = SR_MATH_NS::InfinityFV3;
+        SR_MATH_NS::Quaternion m_synchronizedRotation = SR_MATH_NS::InfinityQuaternion;
+        SR_MATH_NS::FVector3 m_synchronizedScale = SR_MATH_NS::InfinityFV3;
+        /// the origin shift of the physics scene the cached poses are in
+        SR_MATH_NS::FVector3 m_originShift = SR_MATH_NS::FVector3(SR_MATH_NS::Unit(0));
+
         SR_PTYPES_NS::PhysicsMaterial* m_material = nullptr;
 
         /// TODO: move to CollisionShape class
@@ -178,13 +242,25 @@ namespace SR_PTYPES_NS {
 
         SR_MATH_NS::FVector3 m_center;
 
+        ShapeCookedCallback m_shapeCookedCallback;
+
         bool m_isTrigger = false;
         bool m_isStatic = false;
 
+        bool m_hasCollisionEvents = true;
+        bool m_hasCollisionStayEvents = false;
+        bool m_hasTriggerEvents = true;
+
+        SR_UTILS_NS::StringAtom m_collisionLayer;
+
         bool m_isBodyDirty = true;
         bool m_isMatrixDirty = false;
         bool m_isShapeDirty = false;
 
+        bool m_isApplyingPose = false;
+        /// the transform is in the interpolated pose
+        bool m_hasVisualPose = false;
+
         float_t m_mass = 1.f;
 
     };
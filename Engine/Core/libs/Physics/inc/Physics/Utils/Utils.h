@@ -39,6 +39,16 @@ namespace SR_PHYSICS_NS {
          Convex3D,
          Cone3D
     )
+
+    /// Contact events the components of the game object of a rigidbody listen to, the backends do not report the others.
+    SR_ENUM_NS_CLASS_T(ContactEvent, uint8_t,
+         None = 0,
+         Collision = 1 << 0, /// enter and exit
+         CollisionStay = 1 << 1,
+         Trigger = 1 << 2
+    );
+
+    using ContactEventFlags = uint8_t;
 }
 
 namespace SR_PHYSICS_UTILS_NS {
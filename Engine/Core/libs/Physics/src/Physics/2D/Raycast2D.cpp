@@ -0,0 +1,42 @@
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <Physics/2D/Raycast2D.h>
+#include <Physics/2D/Raycast2DImpl.h>
+#include <Physics/PhysicsWorld.h>
+#include <Physics/PhysicsLib.h>
+
+namespace SR_PHYSICS_NS {
+    Raycast2D::RaycastHits Raycast2D::Cast(const SR_MATH_NS::FVector2& origin, const SR_MATH_NS::FVector2& direction, float_t maxDistance, uint32_t maxHits, const RaycastFilter& filter) {
+        if (!m_world || !m_world->GetRaycast2DImpl() || maxHits == 0) {
+            return RaycastHits();
+        }
+
+        return m_world->GetRaycast2DImpl()->Cast(origin, direction, maxDistance, maxHits, filter);
+    }
+
+    Raycast2D::RaycastHits Raycast2D::Cast(const SR_MATH_NS::FVector2& origin, const SR_MATH_NS::FVector2& direction, float_t maxDistance, uint32_t maxHits) {
+        return Cast(origin, direction, maxDistance, maxHits, RaycastFilter());
+    }
+
+    Raycast2D::RaycastHits Raycast2D::Cast(const SR_MATH_NS::FVector2& origin, const SR_MATH_NS::FVector2& direction, float_t maxDistance) {
+        return Cast(origin, direction, maxDistance, 1, RaycastFilter());
+    }
+
+    bool Raycast2D::CastAny(const SR_MATH_NS::FVector2& origin, const SR_MATH_NS::FVector2& direction, float_t maxDistance, const RaycastFilter& filter) {
+        if (!m_world || !m_world->GetRaycast2DImpl()) {
+            return false;
+        }
+
+        return m_world->GetRaycast2DImpl()->CastAny(origin, direction, maxDistance, filter);
+    }
+
+    uint32_t Raycast2D::GetLayerMask(SR_UTILS_NS::StringAtom layer) {
+        return 1u << PhysicsLibrary::GetLayerIndex(layer);
+    }
+
+    uint32_t Raycast2D::GetCollisionLayerMask(SR_UTILS_NS::StringAtom layer) {
+        return PhysicsLibrary::Instance().GetCollisionMask(layer);
+    }
+}
@@ -8,4 +8,74 @@ namespace SR_PTYPES_NS {
     SR_UTILS_NS::Measurement Rigidbody2D::GetMeasurement() const {
         return SR_UTILS_NS::Measurement::Space2D;
     }
+
+    void Rigidbody2D::SetFixedRotation(bool fixedRotation) {
+        m_fixedRotation = fixedRotation;
+        if (auto&& pImpl = GetImpl<Rigidbody2DImpl>()) {
+            pImpl->SetFixedRotation(fixedRotation);
+        }
+    }
+
+    SR_MATH_NS::FVector2 Rigidbody2D::GetLinearVelocity() const {
+        if (auto&& pImpl = GetImpl<Rigidbody2DImpl>()) {
+            return pImpl->GetLinearVelocity();
+        }
+        return SR_MATH_NS::FVector2();
+    }
+
+    float_t Rigidbody2D::GetAngularVelocity() const {
+        if (auto&& pImpl = GetImpl<Rigidbody2DImpl>()) {
+            return pImpl->GetAngularVelocity();
+        }
+        return 0.f;
+    }
+
+    void Rigidbody2D::AddLinearVelocity(const SR_MATH_NS::FVector2& velocity) {
+        if (auto&& pImpl = GetImpl<Rigidbody2DImpl>()) {
+            pImpl->AddLinearVelocity(velocity);
+        }
+    }
+
+    void Rigidbody2D::AddAngularVelocity(float_t velocity) {
+        if (auto&& pImpl = GetImpl<Rigidbody2DImpl>()) {
+            pImpl->AddAngularVelocity(velocity);
+        }
+    }
+
+    void Rigidbody2D::SetLinearVelocity(const SR_MATH_NS::FVector2& velocity) {
+        if (auto&& pImpl = GetImpl<Rigidbody2DImpl>()) {
+            pImpl->SetLinearVelocity(velocity);
+        }
+    }
+
+    void Rigidbody2D::SetAngularVelocity(float_t velocity) {
+        if (auto&& pImpl = GetImpl<Rigidbody2DImpl>()) {
+            pImpl->SetAngularVelocity(velocity);
+        }
+    }
+
+    bool Rigidbody2D::InitializeEntity() noexcept {
+        m_properties.AddStandardProperty("Fixed rotation", &m_fixedRotation)
+            .SetSetter([this](void* pValue) {
+                SetFixedRotation(*reinterpret_cast<bool*>(pValue));
+            });
+
+        m_properties.AddCustomProperty<SR_UTILS_NS::StandardProperty>("Linear velocity")
+            .SetGetter([this](void* pData) {
+                *reinterpret_cast<SR_MATH_NS::FVector2*>(pData) = GetLinearVelocity();
+            })
+            .SetType(SR_UTILS_NS::StandardType::FVector2)
+            .SetReadOnly()
+            .SetDontSave();
+
+        m_properties.AddCustomProperty<SR_UTILS_NS::StandardProperty>("Angular velocity")
+            .SetGetter([this](void* pData) {
+                *reinterpret_cast<float_t*>(pData) = GetAngularVelocity();
+            })
+            .SetType(SR_UTILS_NS::StandardType::Float)
+            .SetReadOnly()
+            .SetDontSave();
+
+        return Rigidbody::InitializeEntity();
+    }
 }
@@ -0,0 +1,310 @@
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <Physics/3D/CharacterController3D.h>
+#include <Physics/LibraryImpl.h>
+#include <Physics/PhysicsScene.h>
+#include <Physics/Rigidbody.h>
+
+#include <Utils/ECS/Transform.h>
+#include <Utils/ECS/GameObject.h>
+#include <Utils/World/Scene.h>
+#include <Utils/Common/CollisionData.h>
+
+namespace SR_PTYPES_NS {
+    CharacterController3D::~CharacterController3D() {
+        if (m_impl) {
+            m_impl->DeInit();
+        }
+
+        SR_SAFE_DELETE_PTR(m_impl);
+    }
+
+    bool CharacterController3D::InitializeEntity() noexcept {
+        m_library = SR_PHYSICS_NS::PhysicsLibrary::Instance().GetActiveLibrary(SR_UTILS_NS::Measurement::Space3D);
+        if (!m_library) {
+            SR_ERROR("CharacterController3D::InitializeEntity() : library not found!");
+            return false;
+        }
+
+        if (!(m_impl = m_library->CreateCharacterController3DImpl())) {
+            SR_ERROR("CharacterController3D::InitializeEntity() : the library does not support character controllers!");
+            return false;
+        }
+
+        m_impl->SetController(this);
+
+        m_properties.AddStandardProperty("Radius", &m_radius)
+            .SetSetter([this](void* pValue) {
+                SetRadius(*reinterpret_cast<float_t*>(pValue));
+            })
+            .SetResetValue(0.5f)
+            .SetDrag(0.01f);
+
+        m_properties.AddStandardProperty("Height", &m_height)
+            .SetSetter([this](void* pValue) {
+                SetHeight(*reinterpret_cast<float_t*>(pValue));
+            })
+            .SetResetValue(1.f)
+            .SetDrag(0.01f);
+
+        m_properties.AddStandardProperty("Slope limit", &m_slopeLimit)
+            .SetSetter([this](void* pValue) {
+                SetSlopeLimit(*reinterpret_cast<float_t*>(pValue));
+            })
+            .SetResetValue(45.f)
+            .SetDrag(0.1f);
+
+        m_properties.AddStandardProperty("Step offset", &m_stepOffset)
+            .SetSetter([this](void* pValue) {
+                SetStepOffset(*reinterpret_cast<float_t*>(pValue));
+            })
+            .SetResetValue(0.3f)
+            .SetDrag(0.01f);
+
+        m_properties.AddStandardProperty("Use gravity", &m_useGravity);
+
+        m_properties.AddStandardProperty("Ride on platforms", &m_rideOnPlatforms)
+            .SetSameLine();
+
+        m_properties.AddStandardProperty("Collision events", &m_hasCollisionEvents);
+
+        m_properties.AddStandardProperty("Stay events", &m_hasCollisionStayEvents)
+            .SetSameLine();
+
+        m_properties.AddCustomProperty<SR_UTILS_NS::StandardProperty>("Velocity")
+            .SetGetter([this](void* pData) {
+                *reinterpret_cast<SR_MATH_NS::FVector3*>(pData) = GetVelocity();
+            })
+            .SetType(SR_UTILS_NS::StandardType::FVector3)
+            .SetReadOnly()
+            .SetDontSave();
+
+        m_properties.AddCustomProperty<SR_UTILS_NS::StandardProperty>("Is grounded")
+            .SetGetter([this](void* pData) {
+                *reinterpret_cast<bool*>(pData) = IsGrounded();
+            })
+            .SetType(SR_UTILS_NS::StandardType::Bool)
+            .SetReadOnly()
+            .SetDontSave();
+
+        return Super::InitializeEntity();
+    }
+
+    void CharacterController3D::Move(const SR_MATH_NS::FVector3& displacement) {
+        m_pendingDisplacement += displacement;
+    }
+
+    void CharacterController3D::SetRadius(float_t radius) {
+        m_radius = SR_MAX(radius, 0.01f);
+        m_isShapeDirty = true;
+    }
+
+    void CharacterController3D::SetHeight(float_t height) {
+        m_height = SR_MAX(height, 0.01f);
+        m_isShapeDirty = true;
+    }
+
+    void CharacterController3D::SetSlopeLimit(float_t degrees) {
+        m_slopeLimit = SR_MAX(0.f, SR_MIN(degrees, 90.f));
+        m_isShapeDirty = true;
+    }
+
+    void CharacterController3D::SetStepOffset(float_t offset) {
+        m_stepOffset = SR_MAX(offset, 0.f);
+        m_isShapeDirty = true;
+    }
+
+    void* CharacterController3D::GetHandle() const noexcept {
+        return m_impl ? m_impl->GetHandle() : nullptr;
+    }
+
+    void CharacterController3D::PrepareMove(float_t step) {
+        if (!m_impl || !m_impl->GetHandle()) {
+            return;
+        }
+
+        if (m_isShapeDirty) {
+            m_impl->UpdateShape();
+            m_isShapeDirty = false;
+        }
+
+        if (auto&& pTransform = GetTransform()) {
+            auto&& translation = pTransform->GetMatrix().GetTranslate();
+
+            if (!m_synchronizedTranslation.IsFinite() || !translation.IsEquals(m_synchronizedTranslation, SR_MATH_NS::Unit(0.001))) {
+                m_impl->SetFootPosition(translation);
+                m_synchronizedTranslation = translation;
+                m_verticalVelocity = 0.f;
+            }
+        }
+
+        SR_MATH_NS::FVector3 displacement = m_pendingDisplacement;
+
+        if (m_useGravity) {
+            /// a grounded controller keeps pushing down a little, otherwise the ground would not be touched by the next move
+            if (m_isGrounded && m_verticalVelocity < 0.f) {
+                m_verticalVelocity = 0.f;
+            }
+
+            m_verticalVelocity -= SR_EARTH_GRAVITY_CONST * step;
+            displacement.y += m_verticalVelocity * step;
+        }
+
+        m_impl->Move(displacement, step);
+
+        m_isGrounded = m_impl->IsGrounded();
+        m_pendingDisplacement = SR_MATH_NS::FVector3(SR_MATH_NS::Unit(0));
+        m_movedTime += step;
+    }
+
+    void CharacterController3D::Synchronize() {
+        if (!m_impl || m_movedTime <= 0.f) {
+            return;
+        }
+
+        auto&& footPosition = m_impl->GetFootPosition();
+
+        if (auto&& pTransform = GetTransform(); pTransform && m_synchronizedTranslation.IsFinite()) {
+            auto&& delta = footPosition - m_synchronizedTranslation;
+
+            m_velocity = delta / m_movedTime;
+
+            if (!delta.IsEquals(SR_MATH_NS::FVector3(SR_MATH_NS::Unit(0)), SR_MATH_NS::Unit(0.00001))) {
+                pTransform->GlobalTranslate(delta);
+            }
+        }
+
+        m_synchronizedTranslation = footPosition;
+        m_isGrounded = m_impl->IsGrounded();
+        m_movedTime = 0.f;
+
+        /// the ceiling stops a jump
+        if (m_verticalVelocity > 0.f && m_velocity.y <= 0.f) {
+            m_verticalVelocity = 0.f;
+        }
+
+        DispatchHits();
+    }
+
+    void CharacterController3D::ShiftOrigin(const SR_MATH_NS::FVector3& shift) {
+        if (m_impl) {
+            m_impl->ShiftOrigin(shift);
+        }
+
+        if (m_synchronizedTranslation.IsFinite()) {
+            m_synchronizedTranslation += shift;
+        }
+    }
+
+    void CharacterController3D::AddHit(Rigidbody* pRigidbody, const SR_MATH_NS::FVector3& point) {
+        if (pRigidbody && m_hasCollisionEvents) {
+            m_hits.try_emplace(pRigidbody, point);
+        }
+    }
+
+    void CharacterController3D::RemoveHits(const std::vector<Rigidbody*>& sortedRigidbodies) {
+        auto&& isRemoved = [&sortedRigidbodies](auto&& pair) {
+            return std::binary_search(sortedRigidbodies.begin(), sortedRigidbodies.end(), pair.first);
+        };
+
+        std::erase_if(m_hits, isRemoved);
+        std::erase_if(m_previousHits, isRemoved);
+    }
+
+    void CharacterController3D::DispatchHits() {
+        SR_TRACY_ZONE;
+
+        auto&& pGameObject = GetGameObject();
+
+        if (!pGameObject || (m_hits.empty() && m_previousHits.empty())) {
+            m_previousHits.swap(m_hits);
+            m_hits.clear();
+            return;
+        }
+
+        auto&& dispatch = [&](Rigidbody* pRigidbody, const SR_MATH_NS::FVector3& point, auto&& function) {
+            SR_UTILS_NS::CollisionData data = { };
+
+            data.point = point;
+            data.pHandler = pRigidbody;
+
+            for (auto&& pComponent : pGameObject->GetComponents()) {
+                if (pComponent != this) {
+                    function(pComponent, data);
+                }
+            }
+        };
+
+        for (auto&& [pRigidbody, point] : m_hits) {
+            if (!m_previousHits.count(pRigidbody)) {
+                dispatch(pRigidbody, point, [](auto&& pComponent, auto&& data) { pComponent->OnCollisionEnter(data); });
+            }
+            else if (m_hasCollisionStayEvents) {
+                dispatch(pRigidbody, point, [](auto&& pComponent, auto&& data) { pComponent->OnCollisionStay(data); });
+            }
+        }
+
+        for (auto&& [pRigidbody, point] : m_previousHits) {
+            if (!m_hits.count(pRigidbody)) {
+                dispatch(pRigidbody, point, [](auto&& pComponent, auto&& data) { pComponent->OnCollisionExit(data); });
+            }
+        }
+
+        m_previousHits.swap(m_hits);
+        m_hits.clear();
+    }
+
+    const CharacterController3D::PhysicsScenePtr& CharacterController3D::GetPhysicsScene() const {
+        if (!m_physicsScene.Valid()) {
+            auto&& pScene = TryGetScene();
+            if (!pScene) {
+                static CharacterController3D::PhysicsScenePtr empty;
+                return empty;
+            }
+
+            m_physicsScene = pScene->GetDataStorage().GetValue<PhysicsScenePtr>();
+        }
+
+        return m_physicsScene;
+    }
+
+    void CharacterController3D::OnEnable() {
+        if (auto&& physicsScene = GetPhysicsScene()) {
+            physicsScene->Register(this);
+        }
+        else {
+            SRHalt("Failed to get physics scene!");
+        }
+
+        Super::OnEnable();
+    }
+
+    void CharacterController3D::OnDisable() {
+        if (auto&& physicsScene = GetPhysicsScene()) {
+            physicsScene->Remove(this);
+        }
+        else {
+            SRHalt("Failed to get physics scene!");
+        }
+
+        Super::OnDisable();
+    }
+
+    void CharacterController3D::OnDestroy() {
+        /// получаем указатель обязательно до OnDestroy
+        PhysicsScenePtr physicsScene = GetPhysicsScene();
+
+        Super::OnDestroy();
+
+        if (physicsScene) {
+            physicsScene->Remove(this);
+        }
+        else {
+            AutoFree([](auto&& pData) {
+                delete pData;
+            });
+        }
+    }
+}
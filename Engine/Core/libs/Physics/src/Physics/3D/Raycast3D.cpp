@@ -4,14 +4,62 @@
 
 #include <Physics/3D/Raycast3D.h>
 #include <Physics/PhysicsWorld.h>
-#include <Physics/PhysX/PhysXRaycast3DImpl.h>
+#include <Physics/3D/Raycast3DImpl.h>
+
+#include <Physics/PhysicsLib.h>
 
 namespace SR_PHYSICS_NS {
+    Raycast3D::RaycastHits Raycast3D::Cast(const SR_MATH_NS::FVector3 &origin, const SR_MATH_NS::FVector3 &direction, float_t maxDistance, uint32_t maxHits, const RaycastFilter& filter) {
+        if (!m_world || !m_world->GetRaycast3DImpl() || maxHits == 0) {
+            return RaycastHits();
+        }
+
+        return m_world->GetRaycast3DImpl()->Cast(origin, direction, maxDistance, maxHits, filter);
+    }
+
     Raycast3D::RaycastHits Raycast3D::Cast(const SR_MATH_NS::FVector3 &origin, const SR_MATH_NS::FVector3 &direction, float_t maxDistance, uint32_t maxHits){
-        return m_world->GetRaycast3DImpl()->Cast(origin, direction, maxDistance, maxHits);
+        return Cast(origin, direction, maxDistance, maxHits, RaycastFilter());
     }
 
     Raycast3D::RaycastHits Raycast3D::Cast(const SR_MATH_NS::FVector3 &origin, const SR_MATH_NS::FVector3 &direction, float_t maxDistance){
-        return m_world->GetRaycast3DImpl()->Cast(origin, direction, maxDistance, 1);
+        return Cast(origin, direction, maxDistance, 1, RaycastFilter());
+    }
+
+    bool Raycast3D::CastAny(const SR_MATH_NS::FVector3 &origin, const SR_MATH_NS::FVector3 &direction, float_t maxDistance, const RaycastFilter& filter) {
+        if (!m_world || !m_world->GetRaycast3DImpl()) {
+            return false;
+        }
+
+        return m_world->GetRaycast3DImpl()->CastAny(origin, direction, maxDistance, filter);
+    }
+
+    bool Raycast3D::Execute(SceneQueryBatch3D& batch) {
+        SR_TRACY_ZONE;
+
+        batch.PrepareResults();
+
+        if (!m_world || !m_world->GetRaycast3DImpl()) {
+            return false;
+        }
+
+        if (batch.GetQueriesCount() == 0) {
+            return true;
+        }
+
+        if (m_parallelFor) {
+            return m_world->GetRaycast3DImpl()->Execute(batch, m_parallelFor);
+        }
+
+        return m_world->GetRaycast3DImpl()->Execute(batch, [](uint32_t count, uint32_t, const SR_HTYPES_NS::Function<void(uint32_t, uint32_t)>& function) {
+            function(0, count);
+        });
+    }
+
+    uint32_t Raycast3D::GetLayerMask(SR_UTILS_NS::StringAtom layer) {
+        return 1u << PhysicsLibrary::GetLayerIndex(layer);
+    }
+
+    uint32_t Raycast3D::GetCollisionLayerMask(SR_UTILS_NS::StringAtom layer) {
+        return PhysicsLibrary::Instance().GetCollisionMask(layer);
     }
-}
\ No newline at end of file
+}
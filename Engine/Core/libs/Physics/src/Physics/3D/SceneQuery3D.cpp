@@ -0,0 +1,86 @@
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <Physics/3D/SceneQuery3D.h>
+
+namespace SR_PHYSICS_NS {
+    SceneQueryGeometry SceneQueryGeometry::Sphere(float_t radius) {
+        SceneQueryGeometry geometry;
+        geometry.shape = SceneQueryShape::Sphere;
+        geometry.radius = radius;
+        return geometry;
+    }
+
+    SceneQueryGeometry SceneQueryGeometry::Capsule(float_t radius, float_t halfHeight) {
+        SceneQueryGeometry geometry;
+        geometry.shape = SceneQueryShape::Capsule;
+        geometry.radius = radius;
+        geometry.halfHeight = halfHeight;
+        return geometry;
+    }
+
+    SceneQueryGeometry SceneQueryGeometry::Box(const SR_MATH_NS::FVector3& halfExtents) {
+        SceneQueryGeometry geometry;
+        geometry.shape = SceneQueryShape::Box;
+        geometry.halfExtents = halfExtents;
+        return geometry;
+    }
+
+    SceneQueryBatch3D::SceneQueryBatch3D(uint32_t maxHitsPerQuery)
+        : SR_UTILS_NS::NonCopyable()
+        , m_maxHitsPerQuery(SR_MAX(maxHitsPerQuery, 1u))
+    { }
+
+    uint32_t SceneQueryBatch3D::AddRaycast(const SR_MATH_NS::FVector3& origin, const SR_MATH_NS::FVector3& direction, float_t maxDistance, const RaycastFilter& filter) {
+        auto&& query = m_queries.emplace_back();
+        query.type = SceneQueryType::Raycast;
+        query.origin = origin;
+        query.direction = direction;
+        query.maxDistance = maxDistance;
+        query.filter = filter;
+        return static_cast<uint32_t>(m_queries.size() - 1);
+    }
+
+    uint32_t SceneQueryBatch3D::AddSweep(const SceneQueryGeometry& geometry, const SR_MATH_NS::FVector3& origin, const SR_MATH_NS::FVector3& direction, float_t maxDistance, const RaycastFilter& filter) {
+        auto&& query = m_queries.emplace_back();
+        query.type = SceneQueryType::Sweep;
+        query.geometry = geometry;
+        query.origin = origin;
+        query.direction = direction;
+        query.maxDistance = maxDistance;
+        query.filter = filter;
+        return static_cast<uint32_t>(m_queries.size() - 1);
+    }
+
+    uint32_t SceneQueryBatch3D::AddOverlap(const SceneQueryGeometry& geometry, const SR_MATH_NS::FVector3& position, const RaycastFilter& filter) {
+        auto&& query = m_queries.emplace_back();
+        query.type = SceneQueryType::Overlap;
+        query.geometry = geometry;
+        query.origin = position;
+        query.filter = filter;
+        return static_cast<uint32_t>(m_queries.size() - 1);
+    }
+
+    void SceneQueryBatch3D::Clear() {
+        m_queries.clear();
+        m_counts.clear();
+    }
+
+    SceneQueryBatch3D::Hits SceneQueryBatch3D::GetHits(uint32_t index) const {
+        if (index >= m_counts.size()) {
+            return Hits();
+        }
+
+        return Hits(m_hits.data() + static_cast<size_t>(index) * m_maxHitsPerQuery, m_counts[index]);
+    }
+
+    void SceneQueryBatch3D::PrepareResults() {
+        const size_t size = m_queries.size() * m_maxHitsPerQuery;
+        if (m_hits.size() < size) {
+            m_hits.resize(size);
+        }
+
+        m_counts.assign(m_queries.size(), 0);
+    }
+}
@@ -0,0 +1,149 @@
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <Physics/Box2D/Box2DCollisionShape.h>
+#include <Physics/Rigidbody.h>
+
+#include <Utils/Types/RawMesh.h>
+
+namespace SR_PTYPES_NS {
+    Box2DCollisionShape::Box2DCollisionShape(LibraryPtr pLibrary)
+        : Super(pLibrary)
+    {
+        if (pLibrary) {
+            SetType(pLibrary->GetDefaultShape());
+        }
+    }
+
+    Box2DCollisionShape::~Box2DCollisionShape() {
+        ReleaseShapes();
+    }
+
+    bool Box2DCollisionShape::UpdateShape() {
+        if (!m_rigidbody->IsUpdatable()) {
+            return false;
+        }
+
+        if (!m_library->IsShapeSupported(m_type)) {
+            SR_WARN("Box2DCollisionShape::UpdateShape() : shape is not supported! Replace to default...");
+            SetType(m_library->GetDefaultShape());
+        }
+
+        std::vector<b2Shape*> shapes;
+
+        if (!MakeShapes(shapes)) {
+            SR_ERROR("Box2DCollisionShape::UpdateShape() : unsupported shape! Type: " + SR_UTILS_NS::EnumReflector::ToString(m_type));
+            return false;
+        }
+
+        ReleaseShapes();
+
+        m_shapes = std::move(shapes);
+        m_shapesScale = GetScale();
+        m_shapesBounds = GetBounds();
+
+        return true;
+    }
+
+    bool Box2DCollisionShape::UpdateMatrix() {
+        if (m_shapes.empty() || !m_rigidbody) {
+            return false;
+        }
+
+        const SR_MATH_NS::Unit tolerance = SR_MATH_NS::Unit(0.0001);
+
+        if (m_shapesScale.IsEquals(GetScale(), tolerance) && m_shapesBounds.IsEquals(GetBounds(), tolerance)) {
+            return true;
+        }
+
+        /// the fixtures are clones of the shapes, the rigidbody recreates them
+        m_rigidbody->SetShapeDirty(true);
+
+        return true;
+    }
+
+    bool Box2DCollisionShape::MakeShapes(std::vector<b2Shape*>& shapes) const {
+        auto&& scale = GetScale();
+
+        switch (m_type) {
+            case ShapeType::Box2D: {
+                auto&& pShape = new b2PolygonShape();
+                pShape->SetAsBox(
+                    SR_MAX(std::abs(GetSize().x * scale.x), b2_linearSlop),
+                    SR_MAX(std::abs(GetSize().y * scale.y), b2_linearSlop)
+                );
+                shapes.emplace_back(pShape);
+                return true;
+            }
+            case ShapeType::Circle2D: {
+                auto&& pShape = new b2CircleShape();
+                pShape->m_radius = SR_MAX(std::abs(GetRadius() * SR_MAX(scale.x, scale.y)), b2_linearSlop);
+                shapes.emplace_back(pShape);
+                return true;
+            }
+            case ShapeType::Edge2D: {
+                const float_t length = GetBounds().x * scale.x;
+                auto&& pShape = new b2EdgeShape();
+                pShape->SetTwoSided(b2Vec2(-length, 0.f), b2Vec2(length, 0.f));
+                shapes.emplace_back(pShape);
+                return true;
+            }
+            case ShapeType::TriangleMesh2D:
+                return MakeTriangleMesh(shapes);
+            default:
+                return false;
+        }
+    }
+
+    bool Box2DCollisionShape::MakeTriangleMesh(std::vector<b2Shape*>& shapes) const {
+        auto&& pRawMesh = m_rigidbody->GetRawMesh();
+        const uint32_t meshId = m_rigidbody->GetMeshId();
+
+        /// a mesh without a source has no collision, the same as the placeholder of PhysX
+        if (!pRawMesh || meshId >= pRawMesh->GetMeshesCount()) {
+            SR_WARN("Box2DCollisionShape::MakeTriangleMesh() : mesh is not set!");
+            auto&& pShape = new b2PolygonShape();
+            pShape->SetAsBox(0.5f, 0.5f);
+            shapes.emplace_back(pShape);
+            return true;
+        }
+
+        auto&& vertices = pRawMesh->GetVertices(meshId);
+        auto&& indices = pRawMesh->GetIndices(meshId);
+        auto&& scale = GetScale();
+
+        for (size_t i = 0; i + 2 < indices.size(); i += 3) {
+            b2Vec2 points[3];
+
+            for (size_t j = 0; j < 3; ++j) {
+                auto&& position = vertices[indices[i + j]].position;
+                points[j] = b2Vec2(position.x * scale.x, position.y * scale.y);
+            }
+
+            /// triangles seen edge-on from the Z axis have no area, Box2D rejects them
+            const float_t area = b2Cross(points[1] - points[0], points[2] - points[0]);
+            if (std::abs(area) < b2_linearSlop * b2_linearSlop) {
+                continue;
+            }
+
+            auto&& pShape = new b2PolygonShape();
+            pShape->Set(points, 3);
+            shapes.emplace_back(pShape);
+        }
+
+        if (shapes.empty()) {
+            SR_WARN("Box2DCollisionShape::MakeTriangleMesh() : mesh has no triangles in the XY plane!");
+        }
+
+        return true;
+    }
+
+    void Box2DCollisionShape::ReleaseShapes() {
+        for (auto&& pShape : m_shapes) {
+            delete pShape;
+        }
+
+        m_shapes.clear();
+    }
+}
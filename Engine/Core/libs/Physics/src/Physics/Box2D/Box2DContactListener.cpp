@@ -0,0 +1,217 @@
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <Physics/Box2D/Box2DContactListener.h>
+#include <Physics/Rigidbody.h>
+
+#include <Utils/ECS/GameObject.h>
+#include <Utils/Common/CollisionData.h>
+
+namespace SR_PHYSICS_NS {
+    namespace {
+        SR_PTYPES_NS::Rigidbody* GetFixtureRigidbody(const b2Fixture* pFixture) {
+            return reinterpret_cast<SR_PTYPES_NS::Rigidbody*>(pFixture->GetBody()->GetUserData().pointer);
+        }
+
+        const Box2DFilterData* GetFilterData(const b2Fixture* pFixture) {
+            return reinterpret_cast<const Box2DFilterData*>(pFixture->GetUserData().pointer);
+        }
+    }
+
+    bool Box2DContactFilter::ShouldCollide(b2Fixture* pFixtureA, b2Fixture* pFixtureB) {
+        auto&& pDataA = GetFilterData(pFixtureA);
+        auto&& pDataB = GetFilterData(pFixtureB);
+
+        /// fixtures without a layer collide with everything
+        if (pDataA && pDataB && pDataA->layer != 0 && pDataB->layer != 0) {
+            if (!(pDataA->layer & pDataB->mask) || !(pDataB->layer & pDataA->mask)) {
+                return false;
+            }
+        }
+
+        if (!m_triggersVsStatic) {
+            const bool isStaticA = pFixtureA->GetBody()->GetType() == b2_staticBody;
+            const bool isStaticB = pFixtureB->GetBody()->GetType() == b2_staticBody;
+
+            if ((pFixtureA->IsSensor() && isStaticB) || (pFixtureB->IsSensor() && isStaticA)) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    void Box2DContactListener::BeginContact(b2Contact* pContact) {
+        AddEvent(pContact, EventType::CollisionEnter, EventType::TriggerEnter);
+    }
+
+    void Box2DContactListener::EndContact(b2Contact* pContact) {
+        AddEvent(pContact, EventType::CollisionExit, EventType::TriggerExit);
+    }
+
+    void Box2DContactListener::EndStep(b2World* pWorld) {
+        SR_TRACY_ZONE;
+
+        for (auto&& pContact = pWorld->GetContactList(); pContact; pContact = pContact->GetNext()) {
+            if (!pContact->IsTouching() || pContact->GetFixtureA()->IsSensor() || pContact->GetFixtureB()->IsSensor()) {
+                continue;
+            }
+
+            auto&& pFirst = GetFixtureRigidbody(pContact->GetFixtureA());
+            auto&& pSecond = GetFixtureRigidbody(pContact->GetFixtureB());
+
+            /// PhysX does not report the pair as staying in the step it was found
+            if (m_keys.count(EventKey { pFirst, pSecond, EventType::CollisionEnter })) {
+                continue;
+            }
+
+            AddEvent(pFirst, pSecond, EventType::CollisionStay, pContact);
+        }
+    }
+
+    void Box2DContactListener::AddEvent(b2Contact* pContact, EventType collisionType, EventType triggerType) {
+        auto&& pFixtureA = pContact->GetFixtureA();
+        auto&& pFixtureB = pContact->GetFixtureB();
+
+        auto&& pRigidbodyA = GetFixtureRigidbody(pFixtureA);
+        auto&& pRigidbodyB = GetFixtureRigidbody(pFixtureB);
+
+        if (!pRigidbodyA || !pRigidbodyB) {
+            return;
+        }
+
+        /// the trigger goes first, the same as in the trigger pairs of PhysX
+        if (pFixtureA->IsSensor()) {
+            AddEvent(pRigidbodyA, pRigidbodyB, triggerType, nullptr);
+        }
+        else if (pFixtureB->IsSensor()) {
+            AddEvent(pRigidbodyB, pRigidbodyA, triggerType, nullptr);
+        }
+        else {
+            /// the contact is already destroyed by the exit, there are no points left
+            AddEvent(pRigidbodyA, pRigidbodyB, collisionType, collisionType == EventType::CollisionExit ? nullptr : pContact);
+        }
+    }
+
+    bool Box2DContactListener::IsListening(const SR_PTYPES_NS::Rigidbody* pRigidbody, EventType type) {
+        if (!pRigidbody) {
+            return false;
+        }
+
+        ContactEvent event = ContactEvent::Trigger;
+
+        switch (type) {
+            case EventType::CollisionEnter:
+            case EventType::CollisionExit:
+                event = ContactEvent::Collision;
+                break;
+            case EventType::CollisionStay:
+                event = ContactEvent::CollisionStay;
+                break;
+            default:
+                break;
+        }
+
+        return pRigidbody->GetContactEvents() & static_cast<ContactEventFlags>(event);
+    }
+
+    void Box2DContactListener::AddEvent(SR_PTYPES_NS::Rigidbody* pFirst, SR_PTYPES_NS::Rigidbody* pSecond, EventType type, b2Contact* pContact) {
+        if (!IsListening(pFirst, type) && !IsListening(pSecond, type)) {
+            return;
+        }
+
+        if (!m_keys.insert(EventKey { pFirst, pSecond, type }).second) {
+            return;
+        }
+
+        auto&& event = m_events.emplace_back();
+        event.pRigidbodies[0] = pFirst;
+        event.pRigidbodies[1] = pSecond;
+        event.type = type;
+
+        if (!pContact) {
+            return;
+        }
+
+        auto&& pManifold = pContact->GetManifold();
+        if (pManifold->pointCount == 0) {
+            return;
+        }
+
+        b2WorldManifold worldManifold;
+        pContact->GetWorldManifold(&worldManifold);
+
+        b2Vec2 point = b2Vec2_zero;
+        float_t normalImpulse = 0.f;
+
+        for (int32_t i = 0; i < pManifold->pointCount; ++i) {
+            point += worldManifold.points[i];
+            normalImpulse += pManifold->points[i].normalImpulse;
+        }
+
+        const float_t count = static_cast<float_t>(pManifold->pointCount);
+
+        event.point = SR_PHYSICS_UTILS_NS::B2V2ToFV3(b2Vec2(point.x / count, point.y / count));
+        /// the impulses are known only after the solver, the enter events have zero ones
+        event.impulse = SR_PHYSICS_UTILS_NS::B2V2ToFV3((normalImpulse / count) * worldManifold.normal);
+    }
+
+    void Box2DContactListener::Dispatch() {
+        SR_TRACY_ZONE;
+
+        if (m_events.empty()) {
+            return;
+        }
+
+        /// the components are free to do anything with the physics here, new events come only from the next step
+        m_dispatched.swap(m_events);
+
+        for (auto&& event : m_dispatched) {
+            Dispatch(event, 0);
+            Dispatch(event, 1);
+        }
+
+        m_dispatched.clear();
+    }
+
+    void Box2DContactListener::Dispatch(const Event& event, uint8_t index) {
+        auto&& pRigidbody = event.pRigidbodies[index];
+        auto&& pOther = event.pRigidbodies[1 - index];
+
+        if (!IsListening(pRigidbody, event.type)) {
+            return;
+        }
+
+        auto&& gameObject = pRigidbody->GetGameObject();
+        if (!gameObject) {
+            return;
+        }
+
+        SR_UTILS_NS::CollisionData data = { };
+
+        data.point = event.point;
+        data.impulse = event.impulse;
+        data.pHandler = pOther;
+
+        for (auto&& pComponent : gameObject->GetComponents()) {
+            if (pComponent == pRigidbody) {
+                continue;
+            }
+
+            switch (event.type) {
+                case EventType::CollisionEnter: pComponent->OnCollisionEnter(data); break;
+                case EventType::CollisionStay: pComponent->OnCollisionStay(data); break;
+                case EventType::CollisionExit: pComponent->OnCollisionExit(data); break;
+                case EventType::TriggerEnter: pComponent->OnTriggerEnter(data); break;
+                case EventType::TriggerExit: pComponent->OnTriggerExit(data); break;
+            }
+        }
+    }
+
+    void Box2DContactListener::Remove(SR_PTYPES_NS::Rigidbody* pRigidbody) {
+        std::erase_if(m_events, [pRigidbody](const Event& event) {
+            return event.pRigidbodies[0] == pRigidbody || event.pRigidbodies[1] == pRigidbody;
+        });
+    }
+}
@@ -2,13 +2,41 @@
 // Created by Monika on 27.11.2022.
 //
 
+#include <Utils/Resources/ResourceManager.h>
+
 #include <Physics/Box2D/Box2DLibraryImpl.h>
 
+#include <Physics/Box2D/Box2DPhysicsWorld.h>
+#include <Physics/Box2D/Box2DCollisionShape.h>
+#include <Physics/Box2D/Box2DRigidbody2D.h>
+
 namespace SR_PHYSICS_NS {
     bool Box2DLibraryImpl::Initialize() {
+        SR_TRACY_ZONE;
+
+        if (!Super::Initialize()) {
+            return false;
+        }
+
+        LoadSettings();
+
         return true;
     }
 
+    void Box2DLibraryImpl::LoadSettings() {
+        auto&& path = SR_UTILS_NS::ResourceManager::Instance().GetResPath().Concat("Engine/Configs/Physics.xml");
+        auto&& document = SR_XML_NS::Document::Load(path);
+        if (!document.Valid()) {
+            SR_WARN("Box2DLibraryImpl::LoadSettings() : failed to load xml document, default settings are used.\n\tPath: " + path.ToString());
+            return;
+        }
+
+        auto&& solverNode = document.Root().GetNode("Physics").TryGetNode("Box2D").TryGetNode("Solver");
+
+        m_velocityIterations = SR_MAX(solverNode.TryGetAttribute("VelocityIterations").ToInt(m_velocityIterations), 1);
+        m_positionIterations = SR_MAX(solverNode.TryGetAttribute("PositionIterations").ToInt(m_positionIterations), 1);
+    }
+
     bool Box2DLibraryImpl::IsShapeSupported(ShapeType type) const {
         switch (type) {
             case ShapeType::Box2D:
@@ -21,15 +49,15 @@ namespace SR_PHYSICS_NS {
         }
     }
 
-    SR_PTYPES_NS::CollisionShape *Box2DLibraryImpl::CreateCollisionShape() {
-        return LibraryImpl::CreateCollisionShape();
+    SR_PTYPES_NS::CollisionShape* Box2DLibraryImpl::CreateCollisionShape() {
+        return new SR_PTYPES_NS::Box2DCollisionShape(this);
     }
 
-    SR_PTYPES_NS::Rigidbody2D *Box2DLibraryImpl::CreateRigidbody2D() {
-        return LibraryImpl::CreateRigidbody2D();
+    SR_PTYPES_NS::Rigidbody2DImpl* Box2DLibraryImpl::CreateRigidbody2DImpl() {
+        return new SR_PTYPES_NS::Box2DRigidbody2DImpl();
     }
 
-    SR_PHYSICS_NS::PhysicsWorld *Box2DLibraryImpl::CreatePhysicsWorld(LibraryImpl::Space space) {
-        return LibraryImpl::CreatePhysicsWorld(space);
+    SR_PHYSICS_NS::PhysicsWorld* Box2DLibraryImpl::CreatePhysicsWorld(Space space) {
+        return new Box2DPhysicsWorld(this, space);
     }
 }
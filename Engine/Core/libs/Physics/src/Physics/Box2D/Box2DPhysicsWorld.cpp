@@ -0,0 +1,320 @@
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <Physics/Box2D/Box2DPhysicsWorld.h>
+#include <Physics/Box2D/Box2DLibraryImpl.h>
+#include <Physics/Box2D/Box2DRigidbody2D.h>
+#include <Physics/Box2D/Box2DRaycast2DImpl.h>
+#include <Physics/Box2D/Box2DContactListener.h>
+
+namespace SR_PHYSICS_NS {
+    Box2DPhysicsWorld::Box2DPhysicsWorld(Super::LibraryPtr pLibrary, Space space)
+        : Super(pLibrary, space)
+    {
+        m_contactListener = new Box2DContactListener();
+        m_contactFilter = new Box2DContactFilter();
+    }
+
+    Box2DPhysicsWorld::~Box2DPhysicsWorld() {
+        if (m_world) {
+            /// the bodies are deleted with the world, the rigidbodies must not destroy them after it
+            for (auto&& pBody = m_world->GetBodyList(); pBody; pBody = pBody->GetNext()) {
+                if (auto&& pImpl = GetImpl(reinterpret_cast<RigidbodyPtr>(pBody->GetUserData().pointer))) {
+                    pImpl->OnWorldDestroyed();
+                }
+            }
+
+            delete m_world;
+            m_world = nullptr;
+        }
+
+        SR_SAFE_DELETE_PTR(m_contactListener);
+        SR_SAFE_DELETE_PTR(m_contactFilter);
+    }
+
+    bool Box2DPhysicsWorld::Initialize() {
+        SR_TRACY_ZONE;
+
+        auto&& pLibrary = GetLibrary<Box2DLibraryImpl>();
+        if (!pLibrary) {
+            return false;
+        }
+
+        m_velocityIterations = pLibrary->GetVelocityIterations();
+        m_positionIterations = pLibrary->GetPositionIterations();
+
+        m_world = new b2World(b2Vec2(0.f, -SR_EARTH_GRAVITY_CONST));
+
+        m_contactFilter->SetTriggersVsStatic(PhysicsLibrary::Instance().IsTriggersVsStaticEnabled());
+
+        m_world->SetContactListener(m_contactListener);
+        m_world->SetContactFilter(m_contactFilter);
+
+        m_raycast2dImpl = new Box2DRaycast2DImpl(this);
+
+        return true;
+    }
+
+    bool Box2DPhysicsWorld::ClearForces() {
+        SR_TRACY_ZONE;
+
+        if (m_world) {
+            m_world->ClearForces();
+        }
+
+        return PhysicsWorld::ClearForces();
+    }
+
+    bool Box2DPhysicsWorld::Synchronize() {
+        SR_TRACY_ZONE;
+        const bool result = SynchronizeActive() && SynchronizeDirty();
+
+        const auto start = std::chrono::steady_clock::now();
+
+        /// the components see the synchronized transforms
+        m_contactListener->Dispatch();
+
+        m_statistics.callbackTime += std::chrono::duration<double_t, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        return result;
+    }
+
+    bool Box2DPhysicsWorld::StepSimulation(float_t step) {
+        SR_TRACY_ZONE;
+
+        if (!m_world) {
+            return false;
+        }
+
+        m_contactListener->BeginStep();
+        m_world->Step(step, m_velocityIterations, m_positionIterations);
+        m_contactListener->EndStep(m_world);
+
+        auto&& profile = m_world->GetProfile();
+        m_statistics.broadPhaseTime += profile.broadphase;
+        m_statistics.narrowPhaseTime += profile.collide;
+        m_statistics.solverTime += profile.solve;
+        m_statistics.hasPhaseTimes = true;
+
+        m_hasNewState = true;
+
+        return true;
+    }
+
+    bool Box2DPhysicsWorld::AddRigidbody(PhysicsWorld::RigidbodyPtr pRigidbody) {
+        if (!pRigidbody) {
+            SRHalt("pRigidbody is nullptr!");
+            return false;
+        }
+
+        auto&& pImpl = GetImpl(pRigidbody);
+        if (!pImpl) {
+            SRHalt("Box2DPhysicsWorld::AddRigidbody() : the rigidbody is not a Box2D one!");
+            return false;
+        }
+
+        /// the body is created in the world, it has to be known before the initialization
+        pImpl->SetWorld(m_world);
+
+        if (pRigidbody->IsBodyDirty()) {
+            pRigidbody->InitBody();
+        }
+        else if (!pRigidbody->GetHandle()) {
+            pImpl->InitBody();
+        }
+
+        /// the transform could be moved while the rigidbody was not in the world
+        MarkDirty(pRigidbody);
+
+        return true;
+    }
+
+    bool Box2DPhysicsWorld::RemoveRigidbody(PhysicsWorld::RigidbodyPtr pRigidbody) {
+        if (!pRigidbody) {
+            SRHalt("pRigidbody is nullptr!");
+            return false;
+        }
+
+        if (auto&& pImpl = GetImpl(pRigidbody)) {
+            pImpl->DestroyBody();
+        }
+
+        UnmarkDirty(pRigidbody);
+        m_contactListener->Remove(pRigidbody);
+        std::erase(m_movedRigidbodies, pRigidbody);
+        std::erase(m_previousMovedRigidbodies, pRigidbody);
+
+        return true;
+    }
+
+    bool Box2DPhysicsWorld::SynchronizeActive() {
+        SR_TRACY_ZONE;
+
+        /// without a new step the awake bodies are the same, the interpolation states must not be pushed twice
+        if (!m_hasNewState.exchange(false)) {
+            return true;
+        }
+
+        const bool isInterpolated = IsInterpolationEnabled();
+
+        /// re-adding of a rigidbody destroys its body, the list of the world can't be walked meanwhile
+        m_awakeBodies.clear();
+
+        for (auto&& pBody = m_world->GetBodyList(); pBody; pBody = pBody->GetNext()) {
+            if (pBody->GetType() != b2_staticBody && pBody->IsAwake()) {
+                m_awakeBodies.emplace_back(pBody);
+            }
+        }
+
+        m_movedRigidbodies.swap(m_previousMovedRigidbodies);
+        m_movedRigidbodies.clear();
+
+        for (auto&& pBody : m_awakeBodies) {
+            auto&& pRigidbody = reinterpret_cast<RigidbodyPtr>(pBody->GetUserData().pointer);
+            if (!SRVerifyFalse(!pRigidbody)) {
+                continue;
+            }
+
+            if (pRigidbody->IsBodyDirty()) {
+                SRVerifyFalse(!ReAddRigidbody(pRigidbody));
+                continue;
+            }
+
+            if (pRigidbody->UpdateShape() == RBUpdShapeRes::Error) {
+                SR_ERROR("Box2DPhysicsWorld::Synchronize() : failed to update shape!");
+                continue;
+            }
+
+            pRigidbody->Synchronize(isInterpolated);
+            m_movedRigidbodies.emplace_back(pRigidbody);
+        }
+
+        if (!isInterpolated) {
+            return true;
+        }
+
+        /// bodies that fell asleep are not interpolated anymore, they are left at their last simulated state
+        std::sort(m_movedRigidbodies.begin(), m_movedRigidbodies.end());
+
+        for (auto&& pRigidbody : m_previousMovedRigidbodies) {
+            if (!std::binary_search(m_movedRigidbodies.begin(), m_movedRigidbodies.end(), pRigidbody)) {
+                pRigidbody->Interpolate(1.f);
+            }
+        }
+
+        return true;
+    }
+
+    bool Box2DPhysicsWorld::SynchronizeDirty() {
+        SR_TRACY_ZONE;
+
+        const bool isInterpolated = IsInterpolationEnabled();
+
+        for (auto&& pRigidbody : TakeDirtyRigidbodies()) {
+            auto&& pBody = (b2Body*)pRigidbody->GetHandle();
+
+            /// registered, but not flushed yet, AddRigidbody() queues it again
+            if (!pBody || pBody->GetWorld() != m_world) {
+                continue;
+            }
+
+            if (pRigidbody->IsBodyDirty()) {
+                SRVerifyFalse(!ReAddRigidbody(pRigidbody));
+                continue;
+            }
+
+            if (pRigidbody->UpdateShape() == RBUpdShapeRes::Error) {
+                SR_ERROR("Box2DPhysicsWorld::Synchronize() : failed to update shape!");
+                continue;
+            }
+
+            if (!pRigidbody->IsMatrixDirty()) {
+                continue;
+            }
+
+            /// the transform was moved by the engine, dynamic bodies are teleported by the synchronization
+            if (pBody->GetType() == b2_dynamicBody) {
+                pRigidbody->Synchronize(isInterpolated);
+            }
+            else {
+                pRigidbody->UpdateMatrix();
+            }
+        }
+
+        return true;
+    }
+
+    void Box2DPhysicsWorld::Interpolate(float_t alpha) {
+        SR_TRACY_ZONE;
+
+        if (!IsInterpolationEnabled()) {
+            return;
+        }
+
+        for (auto&& pRigidbody : m_movedRigidbodies) {
+            pRigidbody->Interpolate(alpha);
+        }
+    }
+
+    void Box2DPhysicsWorld::RestoreSimulatedPoses() {
+        SR_TRACY_ZONE;
+
+        /// the bodies that fell asleep are interpolated to their last state by the synchronization, they are restored too
+        for (auto&& pRigidbody : m_movedRigidbodies) {
+            pRigidbody->RestoreSimulatedPose();
+        }
+
+        for (auto&& pRigidbody : m_previousMovedRigidbodies) {
+            pRigidbody->RestoreSimulatedPose();
+        }
+    }
+
+    void Box2DPhysicsWorld::ShiftOrigin(const SR_MATH_NS::FVector3& shift) {
+        SR_TRACY_ZONE;
+
+        if (!m_world) {
+            return;
+        }
+
+        /// Box2D takes the new origin, the bodies go the opposite way
+        m_world->ShiftOrigin(b2Vec2(-shift.x, -shift.y));
+
+        /// the transforms are shifted by the whole vector, the depth is not simulated
+        CatchUpOrigin(m_movedRigidbodies, m_previousMovedRigidbodies);
+    }
+
+    PhysicsStatistics Box2DPhysicsWorld::GetStatistics() const {
+        PhysicsStatistics statistics = Super::GetStatistics();
+
+        if (!m_world) {
+            return statistics;
+        }
+
+        for (auto&& pBody = m_world->GetBodyList(); pBody; pBody = pBody->GetNext()) {
+            if (pBody->GetType() == b2_staticBody) {
+                ++statistics.staticBodies;
+            }
+            else if (pBody->IsAwake()) {
+                ++statistics.activeBodies;
+            }
+            else {
+                ++statistics.sleepingBodies;
+            }
+        }
+
+        statistics.broadPhasePairs = static_cast<uint32_t>(m_world->GetContactCount());
+
+        for (auto&& pContact = m_world->GetContactList(); pContact; pContact = pContact->GetNext()) {
+            if (pContact->IsTouching()) {
+                ++statistics.contacts;
+            }
+        }
+
+        return statistics;
+    }
+
+    SR_PTYPES_NS::Box2DRigidbody2DImpl* Box2DPhysicsWorld::GetImpl(RigidbodyPtr pRigidbody) {
+        return pRigidbody ? pRigidbody->GetImpl<SR_PTYPES_NS::Box2DRigidbody2DImpl>() : nullptr;
+    }
+}
@@ -0,0 +1,160 @@
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <Physics/Box2D/Box2DRaycast2DImpl.h>
+#include <Physics/Box2D/Box2DPhysicsWorld.h>
+#include <Physics/Rigidbody.h>
+
+namespace SR_PHYSICS_NS {
+    namespace {
+        class Box2DRaycastCallback : public b2RayCastCallback {
+        public:
+            Box2DRaycastCallback(const b2Vec2& origin, float_t maxDistance, uint32_t maxHits, const RaycastFilter& filter)
+                : m_origin(origin)
+                , m_maxDistance(maxDistance)
+                , m_maxHits(maxHits)
+                , m_layerMask(filter.layerMask)
+                , m_tag(Box2DRaycast2DImpl::MakeTagHash(filter.tag))
+            { }
+
+            float ReportFixture(b2Fixture* pFixture, const b2Vec2& point, const b2Vec2& normal, float fraction) override {
+                auto&& pFilterData = reinterpret_cast<const Box2DFilterData*>(pFixture->GetUserData().pointer);
+
+                if (pFilterData) {
+                    if (pFilterData->layer != 0 && (pFilterData->layer & m_layerMask) == 0) {
+                        return -1.f;
+                    }
+
+                    if (m_tag != 0 && pFilterData->tag != m_tag) {
+                        return -1.f;
+                    }
+                }
+
+                auto&& pBody = pFixture->GetBody();
+
+                /// the ray is cast from the center of the body, which would always hit itself
+                if (pBody->GetPosition() == m_origin) {
+                    return -1.f;
+                }
+
+                SR_UTILS_NS::RaycastHit hit;
+                hit.pHandler = reinterpret_cast<SR_PTYPES_NS::Rigidbody*>(pBody->GetUserData().pointer);
+                hit.distance = fraction * m_maxDistance;
+                hit.normal = SR_PHYSICS_UTILS_NS::B2V2ToFV3(normal);
+                hit.position = SR_PHYSICS_UTILS_NS::B2V2ToFV3(point);
+
+                m_hits.emplace_back(hit);
+
+                /// the nearest hit clips the ray, the others are collected until the end of it
+                return m_maxHits == 1 ? fraction : 1.f;
+            }
+
+            SR_NODISCARD Raycast2DImpl::RaycastHits& GetHits() {
+                std::sort(m_hits.begin(), m_hits.end(), [](auto&& a, auto&& b) {
+                    return a.distance < b.distance;
+                });
+
+                /// a triangle mesh has many fixtures, the body is reported once by the nearest of them
+                std::unordered_set<void*> handlers;
+                std::erase_if(m_hits, [&handlers](auto&& hit) {
+                    return !handlers.insert(hit.pHandler).second;
+                });
+
+                if (m_hits.size() > m_maxHits) {
+                    m_hits.resize(m_maxHits);
+                }
+
+                return m_hits;
+            }
+
+        private:
+            b2Vec2 m_origin;
+            float_t m_maxDistance = 0.f;
+            uint32_t m_maxHits = 1;
+            uint32_t m_layerMask = RaycastFilter::AllLayers;
+            uint32_t m_tag = 0;
+            Raycast2DImpl::RaycastHits m_hits;
+
+        };
+
+        class Box2DRaycastAnyCallback : public b2RayCastCallback {
+        public:
+            Box2DRaycastAnyCallback(const b2Vec2& origin, float_t maxDistance, const RaycastFilter& filter)
+                : m_filter(origin, maxDistance, 1, filter)
+            { }
+
+            float ReportFixture(b2Fixture* pFixture, const b2Vec2& point, const b2Vec2& normal, float fraction) override {
+                if (m_filter.ReportFixture(pFixture, point, normal, fraction) < 0.f) {
+                    return -1.f;
+                }
+
+                m_isHit = true;
+
+                return 0.f;
+            }
+
+            SR_NODISCARD bool IsHit() const noexcept { return m_isHit; }
+
+        private:
+            Box2DRaycastCallback m_filter;
+            bool m_isHit = false;
+
+        };
+
+        bool MakeRay(const SR_MATH_NS::FVector2& origin, const SR_MATH_NS::FVector2& direction, float_t maxDistance, b2Vec2& from, b2Vec2& to) {
+            b2Vec2 normalized = SR_PHYSICS_UTILS_NS::FV2ToB2V2(direction);
+
+            /// Box2D asserts on the rays of zero length
+            if (maxDistance <= 0.f || normalized.Normalize() < b2_epsilon) {
+                return false;
+            }
+
+            from = SR_PHYSICS_UTILS_NS::FV2ToB2V2(origin);
+            to = from + maxDistance * normalized;
+
+            return true;
+        }
+    }
+
+    Box2DRaycast2DImpl::RaycastHits Box2DRaycast2DImpl::Cast(const SR_MATH_NS::FVector2& origin, const SR_MATH_NS::FVector2& direction, float_t maxDistance, uint32_t maxHits, const RaycastFilter& filter) {
+        SR_TRACY_ZONE;
+
+        auto&& pWorld = GetB2World();
+        b2Vec2 from, to;
+
+        if (!pWorld || !MakeRay(origin, direction, maxDistance, from, to)) {
+            return RaycastHits();
+        }
+
+        Box2DRaycastCallback callback(from, maxDistance, maxHits, filter);
+        pWorld->RayCast(&callback, from, to);
+
+        return std::move(callback.GetHits());
+    }
+
+    bool Box2DRaycast2DImpl::CastAny(const SR_MATH_NS::FVector2& origin, const SR_MATH_NS::FVector2& direction, float_t maxDistance, const RaycastFilter& filter) {
+        SR_TRACY_ZONE;
+
+        auto&& pWorld = GetB2World();
+        b2Vec2 from, to;
+
+        if (!pWorld || !MakeRay(origin, direction, maxDistance, from, to)) {
+            return false;
+        }
+
+        Box2DRaycastAnyCallback callback(from, maxDistance, filter);
+        pWorld->RayCast(&callback, from, to);
+
+        return callback.IsHit();
+    }
+
+    uint32_t Box2DRaycast2DImpl::MakeTagHash(SR_UTILS_NS::StringAtom tag) {
+        return tag.ToStringRef().empty() ? 0 : SR_MAX(static_cast<uint32_t>(tag.GetHash()), 1u);
+    }
+
+    b2World* Box2DRaycast2DImpl::GetB2World() const {
+        auto&& pWorld = dynamic_cast<Box2DPhysicsWorld*>(m_world);
+        return pWorld ? pWorld->GetB2World() : nullptr;
+    }
+}
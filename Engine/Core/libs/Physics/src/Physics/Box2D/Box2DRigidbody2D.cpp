@@ -0,0 +1,313 @@
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <Physics/Box2D/Box2DRigidbody2D.h>
+#include <Physics/Box2D/Box2DCollisionShape.h>
+#include <Physics/Box2D/Box2DRaycast2DImpl.h>
+#include <Physics/2D/Raycast2D.h>
+#include <Physics/PhysicsMaterial.h>
+
+#include <Utils/ECS/GameObject.h>
+
+namespace SR_PTYPES_NS {
+    Box2DRigidbody2DImpl::~Box2DRigidbody2DImpl() {
+        DestroyBody();
+    }
+
+    void Box2DRigidbody2DImpl::DestroyBody() {
+        if (m_body && m_world) {
+            m_world->DestroyBody(m_body);
+        }
+
+        m_body = nullptr;
+    }
+
+    void Box2DRigidbody2DImpl::OnWorldDestroyed() noexcept {
+        m_body = nullptr;
+        m_world = nullptr;
+    }
+
+    void Box2DRigidbody2DImpl::UpdateInertia() {
+        if (!m_body || m_body->GetType() != b2_dynamicBody) {
+            return;
+        }
+
+        /// the fixtures have the unit density, the mass data is scaled to the mass of the rigidbody
+        m_body->ResetMassData();
+
+        b2MassData massData;
+        m_body->GetMassData(&massData);
+
+        const float_t mass = SR_MAX(m_rigidbody->GetMass(), 0.0001f);
+
+        if (massData.mass > 0.f) {
+            massData.I *= mass / massData.mass;
+        }
+
+        massData.mass = mass;
+
+        m_body->SetMassData(&massData);
+    }
+
+    bool Box2DRigidbody2DImpl::InitBody() {
+        if (!Super::InitBody()) {
+            SRHalt("failed to init base body!");
+            return false;
+        }
+
+        if (!m_world) {
+            SRHalt("Box2DRigidbody2DImpl::InitBody() : the rigidbody is not added to a world!");
+            return false;
+        }
+
+        m_rigidbodyTranslation = m_rigidbody->GetTranslation();
+        m_rigidbodyRotation = m_rigidbody->GetRotation();
+
+        DestroyBody();
+
+        b2BodyDef bodyDef;
+        bodyDef.type = m_rigidbody->IsStatic() ? b2_staticBody : b2_dynamicBody;
+        bodyDef.fixedRotation = GetRigidbody<Rigidbody2D>()->IsFixedRotation();
+        bodyDef.userData.pointer = reinterpret_cast<uintptr_t>(m_rigidbody);
+
+        if (!(m_body = m_world->CreateBody(&bodyDef))) {
+            SR_ERROR("Box2DRigidbody2DImpl::InitBody() : failed to create body!");
+            return false;
+        }
+
+        m_rigidbody->UpdateMatrix(true);
+        m_rigidbody->SetShapeDirty(true);
+
+        if (m_rigidbody->UpdateShape() != RBUpdShapeRes::Updated) {
+            SR_ERROR("Box2DRigidbody2DImpl::InitBody() : shape is not updated!");
+            return false;
+        }
+
+        UpdateInertia();
+
+        return true;
+    }
+
+    void Box2DRigidbody2DImpl::ClearForces() {
+        if (!m_body) {
+            return;
+        }
+
+        /// Box2D clears the forces after every step, only the velocities are left
+        m_body->SetLinearVelocity(b2Vec2_zero);
+        m_body->SetAngularVelocity(0.f);
+
+        Super::ClearForces();
+    }
+
+    void Box2DRigidbody2DImpl::AddLinearVelocity(const SR_MATH_NS::FVector2& velocity) {
+        if (m_body) {
+            m_body->SetLinearVelocity(m_body->GetLinearVelocity() + SR_PHYSICS_UTILS_NS::FV2ToB2V2(velocity));
+        }
+    }
+
+    void Box2DRigidbody2DImpl::AddAngularVelocity(float_t velocity) {
+        if (m_body) {
+            m_body->SetAngularVelocity(m_body->GetAngularVelocity() + velocity);
+        }
+    }
+
+    void Box2DRigidbody2DImpl::SetLinearVelocity(const SR_MATH_NS::FVector2& velocity) {
+        if (m_body) {
+            m_body->SetLinearVelocity(SR_PHYSICS_UTILS_NS::FV2ToB2V2(velocity));
+        }
+    }
+
+    void Box2DRigidbody2DImpl::SetAngularVelocity(float_t velocity) {
+        if (m_body) {
+            m_body->SetAngularVelocity(velocity);
+        }
+    }
+
+    SR_MATH_NS::FVector2 Box2DRigidbody2DImpl::GetLinearVelocity() const {
+        if (!m_body) {
+            return SR_MATH_NS::FVector2();
+        }
+
+        auto&& velocity = m_body->GetLinearVelocity();
+
+        return SR_MATH_NS::FVector2(velocity.x, velocity.y);
+    }
+
+    float_t Box2DRigidbody2DImpl::GetAngularVelocity() const {
+        return m_body ? m_body->GetAngularVelocity() : 0.f;
+    }
+
+    void Box2DRigidbody2DImpl::SetFixedRotation(bool fixedRotation) {
+        if (m_body) {
+            m_body->SetFixedRotation(fixedRotation);
+        }
+    }
+
+    bool Box2DRigidbody2DImpl::UpdateMatrix(bool force) {
+        if (!Super::UpdateMatrix(force) || !m_body) {
+            return false;
+        }
+
+        auto&& translation = m_rigidbody->GetTranslation() + m_rigidbody->GetCenterDirection();
+
+        const b2Vec2 position = SR_PHYSICS_UTILS_NS::FV3ToB2V2(translation);
+        const float_t angle = SR_PHYSICS_UTILS_NS::QuaternionToB2Angle(m_rigidbody->GetRotation());
+
+        /// the synchronization pushes back the pose taken from the body, moving the proxies and waking the body is not needed
+        if (b2DistanceSquared(position, m_body->GetPosition()) < b2_linearSlop * b2_linearSlop && !IsAngleChanged(angle)) {
+            return true;
+        }
+
+        m_body->SetTransform(position, angle);
+
+        /// a teleported body has to fall from the new place
+        if (m_body->GetType() != b2_staticBody) {
+            m_body->SetAwake(true);
+        }
+
+        return true;
+    }
+
+    bool Box2DRigidbody2DImpl::UpdateShapeInternal() {
+        if (!m_body) {
+            SRHalt("m_body is nullptr!");
+            return false;
+        }
+
+        auto&& pShape = dynamic_cast<Box2DCollisionShape*>(m_rigidbody->GetCollisionShape());
+        if (!pShape) {
+            SRHalt("Box2DRigidbody2DImpl::UpdateShapeInternal() : invalid collision shape!");
+            return false;
+        }
+
+        while (auto&& pFixture = m_body->GetFixtureList()) {
+            m_body->DestroyFixture(pFixture);
+        }
+
+        UpdateFilterData();
+
+        b2FixtureDef fixtureDef;
+        fixtureDef.density = 1.f;
+        fixtureDef.isSensor = m_rigidbody->IsTrigger();
+        fixtureDef.userData.pointer = reinterpret_cast<uintptr_t>(&m_filterData);
+
+        auto&& pMaterial = m_rigidbody->GetPhysicsMaterial();
+        if (!pMaterial) {
+            pMaterial = SR_PHYSICS_NS::PhysicsLibrary::Instance().GetDefaultMaterial();
+        }
+
+        /// Box2D has a single friction and mixes the materials by itself, the combine modes are not supported
+        if (pMaterial) {
+            fixtureDef.friction = pMaterial->GetDynamicFriction();
+            fixtureDef.restitution = pMaterial->GetBounciness();
+        }
+
+        for (auto&& pB2Shape : pShape->GetShapes()) {
+            fixtureDef.shape = pB2Shape;
+
+            if (!m_body->CreateFixture(&fixtureDef)) {
+                SR_ERROR("Box2DRigidbody2DImpl::UpdateShapeInternal() : failed to create fixture!");
+                return false;
+            }
+        }
+
+        UpdateInertia();
+
+        return true;
+    }
+
+    void Box2DRigidbody2DImpl::UpdateFilterData() {
+        const SR_UTILS_NS::StringAtom layer = m_rigidbody->GetCollisionLayer();
+
+        m_filterData.layer = SR_PHYSICS_NS::Raycast2D::GetLayerMask(layer);
+        m_filterData.mask = SR_PHYSICS_NS::Raycast2D::GetCollisionLayerMask(layer);
+        m_filterData.events = m_rigidbody->GetContactEvents();
+        m_filterData.tag = 0;
+
+        if (auto&& pGameObject = m_rigidbody->GetGameObject()) {
+            m_filterData.tag = SR_PHYSICS_NS::Box2DRaycast2DImpl::MakeTagHash(pGameObject->GetTag());
+        }
+    }
+
+    void Box2DRigidbody2DImpl::Synchronize(bool interpolate) {
+        if (!m_body || !m_rigidbody->GetTransform()) {
+            return;
+        }
+
+        if (!interpolate) {
+            ResetInterpolation();
+            ApplyBodyPose();
+            Super::Synchronize(interpolate);
+            return;
+        }
+
+        if (!m_isInterpolated) {
+            ApplyBodyPose();
+            PushInterpolationState(m_rigidbody->GetTranslation(), m_rigidbody->GetRotation());
+        }
+        else if (m_rigidbody->IsMatrixDirty()) {
+            /// the transform was moved outside of the simulation, teleport the body without interpolation
+            m_rigidbody->UpdateMatrix(true);
+
+            ResetInterpolation();
+            PushInterpolationState(m_rigidbody->GetTranslation(), m_rigidbody->GetRotation());
+        }
+        else {
+            SR_MATH_NS::FVector3 translation;
+            SR_MATH_NS::Quaternion rotation;
+            GetBodyPose(translation, rotation);
+
+            if (GetRigidbody<Rigidbody2D>()->IsFixedRotation()) {
+                rotation = m_currentRotation;
+            }
+
+            PushInterpolationState(translation - m_rigidbody->GetCenterDirection(), rotation);
+        }
+
+        Super::Synchronize(interpolate);
+    }
+
+    void Box2DRigidbody2DImpl::GetBodyPose(SR_MATH_NS::FVector3& translation, SR_MATH_NS::Quaternion& rotation) const {
+        /// the depth of the body is kept, the simulation does not move it
+        const float_t z = m_rigidbody->GetTranslation().z + m_rigidbody->GetCenterDirection().z;
+
+        translation = SR_PHYSICS_UTILS_NS::B2V2ToFV3(m_body->GetPosition(), z);
+        rotation = SR_PHYSICS_UTILS_NS::B2AngleToQuaternion(m_body->GetAngle());
+    }
+
+    void Box2DRigidbody2DImpl::ApplyBodyPose() {
+        auto&& pTransform = m_rigidbody->GetTransform();
+
+        SR_MATH_NS::FVector3 bodyTranslation;
+        SR_MATH_NS::Quaternion bodyRotation;
+        GetBodyPose(bodyTranslation, bodyRotation);
+
+        SR_MATH_NS::FVector3 deltaTranslation(SR_MATH_NS::Unit(0));
+
+        if (m_rigidbodyTranslation.IsFinite()) {
+            deltaTranslation = (bodyTranslation - m_rigidbody->GetCenterDirection()) - m_rigidbodyTranslation;
+        }
+
+        if (!deltaTranslation.IsEquals(SR_MATH_NS::FVector3(SR_MATH_NS::Unit(0)), SR_MATH_NS::Unit(0.001))) {
+            pTransform->GlobalTranslate(deltaTranslation);
+        }
+
+        if (!GetRigidbody<Rigidbody2D>()->IsFixedRotation()) {
+            if (IsAngleChanged(SR_PHYSICS_UTILS_NS::QuaternionToB2Angle(m_rigidbody->GetRotation()))) {
+                pTransform->SetRotation(bodyRotation);
+            }
+        }
+
+        m_rigidbody->UpdateMatrix(true);
+
+        m_rigidbodyTranslation = m_rigidbody->GetTranslation();
+        m_rigidbodyRotation = m_rigidbody->GetRotation();
+    }
+
+    bool Box2DRigidbody2DImpl::IsAngleChanged(float_t angle) const {
+        /// the angle of the body is not wrapped, the one of the transform is in [-pi, pi]
+        return std::abs(std::remainder(angle - m_body->GetAngle(), 2.f * b2_pi)) > 0.0001f;
+    }
+}
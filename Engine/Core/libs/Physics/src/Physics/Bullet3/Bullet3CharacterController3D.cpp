@@ -0,0 +1,250 @@
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <Physics/Bullet3/Bullet3CharacterController3D.h>
+#include <Physics/Bullet3/Bullet3PhysicsWorld.h>
+#include <Physics/3D/Raycast3D.h>
+#include <Physics/Rigidbody.h>
+
+#include <Utils/ECS/Transform.h>
+#include <Utils/ECS/GameObject.h>
+
+#include <BulletDynamics/Character/btKinematicCharacterController.h>
+
+namespace SR_PTYPES_NS {
+    namespace {
+        /// the ray of the platform must not hit the capsule it is cast from
+        class Bullet3ControllerRayCallback : public btCollisionWorld::ClosestRayResultCallback {
+        public:
+            Bullet3ControllerRayCallback(const btCollisionObject* pSelf, const btVector3& from, const btVector3& to)
+                : btCollisionWorld::ClosestRayResultCallback(from, to)
+                , m_self(pSelf)
+            { }
+
+            bool needsCollision(btBroadphaseProxy* pProxy) const override {
+                if (static_cast<btCollisionObject*>(pProxy->m_clientObject) == m_self) {
+                    return false;
+                }
+
+                return btCollisionWorld::ClosestRayResultCallback::needsCollision(pProxy);
+            }
+
+        private:
+            const btCollisionObject* m_self = nullptr;
+
+        };
+    }
+
+    Bullet3CharacterController3DImpl::Bullet3CharacterController3DImpl(LibraryPtr pLibrary)
+        : Super(pLibrary)
+    { }
+
+    Bullet3CharacterController3DImpl::~Bullet3CharacterController3DImpl() {
+        DeInit();
+    }
+
+    bool Bullet3CharacterController3DImpl::Init(PhysicsWorldPtr pWorld) {
+        auto&& pBulletWorld = dynamic_cast<SR_PHYSICS_NS::Bullet3PhysicsWorld*>(pWorld);
+        if (!pBulletWorld || !pBulletWorld->GetBtWorld()) {
+            SRHalt("Bullet3CharacterController3DImpl::Init() : the world is not a Bullet3 one!");
+            return false;
+        }
+
+        DeInit();
+
+        const float_t radius = m_controller->GetRadius();
+        const float_t height = m_controller->GetHeight();
+
+        m_centerOffset = radius + height * 0.5f;
+
+        btTransform transform;
+        transform.setIdentity();
+
+        if (auto&& pTransform = m_controller->GetTransform()) {
+            auto&& translation = pTransform->GetMatrix().GetTranslate();
+            transform.setOrigin(btVector3(translation.x, translation.y + m_centerOffset, translation.z));
+        }
+
+        m_shape = new btCapsuleShape(radius, height);
+
+        m_ghostObject = new btPairCachingGhostObject();
+        m_ghostObject->setWorldTransform(transform);
+        m_ghostObject->setCollisionShape(m_shape);
+        m_ghostObject->setCollisionFlags(btCollisionObject::CF_CHARACTER_OBJECT);
+        /// it is not a rigidbody, the contact listener and the queries skip it
+        m_ghostObject->setUserPointer(nullptr);
+
+        m_characterController = new btKinematicCharacterController(m_ghostObject, m_shape, m_controller->GetStepOffset(), btVector3(0, 1, 0));
+        m_characterController->setMaxSlope(m_controller->GetSlopeLimitRadians());
+        /// the gravity and the jumps are the vertical velocity of the component
+        m_characterController->setGravity(btVector3(0, 0, 0));
+        m_characterController->setUseGhostSweepTest(true);
+
+        int32_t group = btBroadphaseProxy::CharacterFilter;
+        int32_t mask = btBroadphaseProxy::AllFilter;
+
+        if (auto&& pGameObject = m_controller->GetGameObject()) {
+            const SR_UTILS_NS::StringAtom layer = pGameObject->GetLayer();
+            group = static_cast<int32_t>(SR_PHYSICS_NS::Raycast3D::GetLayerMask(layer));
+            mask = static_cast<int32_t>(SR_PHYSICS_NS::PhysicsLibrary::Instance().GetCollisionMask(layer));
+        }
+
+        m_btWorld = pBulletWorld->GetBtWorld();
+        m_btWorld->addCollisionObject(m_ghostObject, group, mask);
+        m_btWorld->addAction(m_characterController);
+
+        m_world = pWorld;
+        m_isGrounded = false;
+
+        return true;
+    }
+
+    void Bullet3CharacterController3DImpl::DeInit() {
+        if (m_btWorld) {
+            m_btWorld->removeAction(m_characterController);
+            m_btWorld->removeCollisionObject(m_ghostObject);
+            m_btWorld = nullptr;
+        }
+
+        SR_SAFE_DELETE_PTR(m_characterController);
+        SR_SAFE_DELETE_PTR(m_ghostObject);
+        SR_SAFE_DELETE_PTR(m_shape);
+
+        m_world = nullptr;
+        m_isGrounded = false;
+    }
+
+    void Bullet3CharacterController3DImpl::Move(const SR_MATH_NS::FVector3& displacement, float_t step) {
+        if (!m_characterController || step <= 0.f) {
+            return;
+        }
+
+        SR_MATH_NS::FVector3 velocity = displacement / step;
+
+        if (m_isGrounded && m_controller->IsRideOnPlatforms()) {
+            velocity += GetPlatformVelocity();
+        }
+
+        /// the move is done by the action of the controller during the step
+        m_characterController->setVelocityForTimeInterval(SR_PHYSICS_UTILS_NS::FV3ToBtV3(velocity), step);
+    }
+
+    SR_MATH_NS::FVector3 Bullet3CharacterController3DImpl::GetPlatformVelocity() const {
+        const btVector3 from = m_ghostObject->getWorldTransform().getOrigin();
+        const btVector3 to = from - btVector3(0, m_centerOffset + m_controller->GetStepOffset(), 0);
+
+        Bullet3ControllerRayCallback callback(m_ghostObject, from, to);
+
+        if (auto&& pProxy = m_ghostObject->getBroadphaseHandle()) {
+            callback.m_collisionFilterGroup = pProxy->m_collisionFilterGroup;
+            callback.m_collisionFilterMask = pProxy->m_collisionFilterMask;
+        }
+
+        m_btWorld->rayTest(from, to, callback);
+
+        auto&& pBody = callback.hasHit() ? btRigidBody::upcast(callback.m_collisionObject) : nullptr;
+        if (!pBody || pBody->isStaticObject()) {
+            return SR_MATH_NS::FVector3(SR_MATH_NS::Unit(0));
+        }
+
+        /// the kinematic platforms have the velocity of their interpolated motion as well
+        const btVector3 velocity = pBody->getVelocityInLocalPoint(callback.m_hitPointWorld - pBody->getCenterOfMassPosition());
+
+        return SR_PHYSICS_UTILS_NS::BtV33ToFV(velocity);
+    }
+
+    void Bullet3CharacterController3DImpl::SetFootPosition(const SR_MATH_NS::FVector3& position) {
+        if (m_characterController) {
+            m_characterController->warp(btVector3(position.x, position.y + m_centerOffset, position.z));
+        }
+    }
+
+    SR_MATH_NS::FVector3 Bullet3CharacterController3DImpl::GetFootPosition() const {
+        if (!m_ghostObject) {
+            return SR_MATH_NS::FVector3(SR_MATH_NS::Unit(0));
+        }
+
+        const btVector3& origin = m_ghostObject->getWorldTransform().getOrigin();
+
+        return SR_MATH_NS::FVector3(origin.x(), origin.y() - m_centerOffset, origin.z());
+    }
+
+    void Bullet3CharacterController3DImpl::UpdateShape() {
+        if (!m_characterController) {
+            return;
+        }
+
+        auto&& footPosition = GetFootPosition();
+        auto&& pWorld = m_world;
+
+        if (Init(pWorld)) {
+            SetFootPosition(footPosition);
+        }
+    }
+
+    void Bullet3CharacterController3DImpl::ShiftOrigin(const SR_MATH_NS::FVector3& shift) {
+        if (m_characterController) {
+            m_characterController->warp(m_ghostObject->getWorldTransform().getOrigin() + SR_PHYSICS_UTILS_NS::FV3ToBtV3(shift));
+        }
+    }
+
+    void Bullet3CharacterController3DImpl::UpdateContacts() {
+        SR_TRACY_ZONE;
+
+        m_isGrounded = false;
+
+        if (!m_ghostObject || !m_btWorld) {
+            return;
+        }
+
+        auto&& pDispatcher = m_btWorld->getDispatcher();
+
+        /// the same as the recovery of the controller does, the contacts are computed at the position after the step
+        pDispatcher->dispatchAllCollisionPairs(m_ghostObject->getOverlappingPairCache(), m_btWorld->getDispatchInfo(), pDispatcher);
+
+        const float_t minGroundDot = std::cos(m_controller->GetSlopeLimitRadians());
+        auto&& pairs = m_ghostObject->getOverlappingPairCache()->getOverlappingPairArray();
+
+        for (int32_t i = 0; i < pairs.size(); ++i) {
+            auto&& pair = pairs[i];
+
+            if (!pair.m_algorithm) {
+                continue;
+            }
+
+            m_manifolds.resize(0);
+            pair.m_algorithm->getAllContactManifolds(m_manifolds);
+
+            for (int32_t j = 0; j < m_manifolds.size(); ++j) {
+                auto&& pManifold = m_manifolds[j];
+                const bool isFirst = pManifold->getBody0() == m_ghostObject;
+                auto&& pOther = isFirst ? pManifold->getBody1() : pManifold->getBody0();
+
+                if (!pOther->hasContactResponse()) {
+                    continue;
+                }
+
+                for (int32_t k = 0; k < pManifold->getNumContacts(); ++k) {
+                    auto&& point = pManifold->getContactPoint(k);
+
+                    /// the margin of the controller, it touches but does not penetrate
+                    if (point.getDistance() > 0.01f) {
+                        continue;
+                    }
+
+                    /// the normal points from the other object to the capsule
+                    const btVector3 normal = isFirst ? point.m_normalWorldOnB : -point.m_normalWorldOnB;
+
+                    if (normal.y() >= minGroundDot) {
+                        m_isGrounded = true;
+                    }
+
+                    m_controller->AddHit(SR_PHYSICS_UTILS_NS::GetBtObjectRigidbody(pOther), SR_PHYSICS_UTILS_NS::BtV33ToFV(
+                        isFirst ? point.getPositionWorldOnB() : point.getPositionWorldOnA()
+                    ));
+                }
+            }
+        }
+    }
+}
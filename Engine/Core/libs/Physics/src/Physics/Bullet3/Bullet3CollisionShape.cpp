@@ -3,84 +3,122 @@
 //
 
 #include <Physics/Bullet3/Bullet3CollisionShape.h>
+#include <Physics/Rigidbody.h>
+
+#include <Utils/Types/RawMesh.h>
 
 namespace SR_PTYPES_NS {
     Bullet3CollisionShape::Bullet3CollisionShape(LibraryPtr pLibrary)
         : Super(pLibrary)
-    { }
+    {
+        if (pLibrary) {
+            SetType(pLibrary->GetDefaultShape());
+        }
+    }
 
     Bullet3CollisionShape::~Bullet3CollisionShape() {
-        SR_SAFE_DELETE_PTR(m_shape)
+        SR_SAFE_DELETE_PTR(m_shape);
     }
 
     bool Bullet3CollisionShape::UpdateShape() {
-        if (!m_library->IsShapeSupported(m_type)) {
-            SR_WARN("Bullet3CollisionShape::Update() : shape is not supported! Replace to default...");
-            m_type = m_library->GetDefaultShape();
+        if (!m_rigidbody->IsUpdatable()) {
+            return false;
         }
 
-        SR_SAFE_DELETE_PTR(m_shape)
+        if (!m_library->IsShapeSupported(m_type)) {
+            SR_WARN("Bullet3CollisionShape::UpdateShape() : shape is not supported! Replace to default...");
+            SetType(m_library->GetDefaultShape());
+        }
 
-        switch (m_type) {
-            case ShapeType::Plane3D: {
-                m_shape = new btStaticPlaneShape(btVector3(0, 1, 0), 0.f);
-                break;
-            }
-            case ShapeType::Box3D: {
-                m_shape = new btBoxShape(btVector3(1, 1, 1));
-                break;
-            }
-            case ShapeType::Capsule3D: {
-                m_shape = new btCapsuleShape(1.f, 1.f);
-                break;
-            }
-            case ShapeType::Sphere3D: {
-                m_shape = new btSphereShape(1.f);
-                break;
-            }
-            case ShapeType::Cylinder3D: {
-                m_shape = new btCylinderShape(btVector3(1.f, 1.f, 1.f));
-                break;
-            }
-            default:
-                SR_ERROR("Bullet3CollisionShape::Update() : unsupported shape! Type: " + SR_UTILS_NS::EnumReflector::ToString(m_type));
-                return false;
+        auto&& pShape = MakeShape();
+        if (!pShape) {
+            SR_ERROR("Bullet3CollisionShape::UpdateShape() : unsupported shape! Type: " + SR_UTILS_NS::EnumReflector::ToString(m_type));
+            return false;
         }
 
+        /// the body still points to the previous shape, it is replaced by UpdateShapeInternal() right after
+        SR_SAFE_DELETE_PTR(m_shape);
+
+        m_shape = pShape;
+        m_shapeScale = GetScale();
+        m_shapeBounds = GetBounds();
+
         return true;
     }
 
-    SR_MATH_NS::FVector3 Bullet3CollisionShape::CalculateLocalInertia(float_t mass) const {
-        btVector3 inertia;
+    bool Bullet3CollisionShape::UpdateMatrix() {
+        if (!m_shape || !m_rigidbody) {
+            return false;
+        }
 
-        if (m_shape) {
-            m_shape->calculateLocalInertia(mass, inertia);
+        const SR_MATH_NS::Unit tolerance = SR_MATH_NS::Unit(0.0001);
+
+        if (m_shapeScale.IsEquals(GetScale(), tolerance) && m_shapeBounds.IsEquals(GetBounds(), tolerance)) {
+            return true;
         }
 
-        return SR_PHYSICS_UTILS_NS::BtV33ToFV(inertia);
+        /// the local scaling of Bullet is not uniform for the capsules and the spheres, the shape is remade instead
+        m_rigidbody->SetShapeDirty(true);
+
+        return true;
     }
 
-    bool Bullet3CollisionShape::UpdateMatrix() {
-        if (!m_shape) {
-            return false;
-        }
+    btCollisionShape* Bullet3CollisionShape::MakeShape() const {
+        auto&& scale = GetScale();
 
         switch (m_type) {
             case ShapeType::Plane3D:
+                return new btStaticPlaneShape(btVector3(0, 1, 0), 0.f);
             case ShapeType::Box3D:
-                m_shape->setLocalScaling(SR_PHYSICS_UTILS_NS::FV3ToBtV3(GetSize() * GetScale()));
-                break;
-            case ShapeType::Capsule3D:
-            case ShapeType::Cylinder3D:
-                m_shape->setLocalScaling(btVector3(GetRadius(), GetHeight(), GetRadius()));
-                break;
+                return new btBoxShape(SR_PHYSICS_UTILS_NS::FV3ToBtV3(GetSize() * scale));
             case ShapeType::Sphere3D:
-                m_shape->setLocalScaling(btVector3(GetRadius(), GetRadius(), GetRadius()));
-                break;
+                return new btSphereShape(GetRadius() * scale.Max());
+            case ShapeType::Capsule3D: {
+                /// the height of the Bullet capsule is the distance between the centers of the spheres
+                const float_t radius = GetRadius() * SR_MAX(scale.x, scale.z);
+                return new btCapsuleShape(radius, 2.f * GetHeight() * scale.y);
+            }
+            case ShapeType::Cylinder3D: {
+                const float_t radius = GetRadius() * SR_MAX(scale.x, scale.z);
+                return new btCylinderShape(btVector3(radius, GetHeight() * scale.y, radius));
+            }
+            case ShapeType::Convex3D:
+                return MakeConvexHull();
             default:
-                break;
+                return nullptr;
         }
+    }
 
-        return true;
+    btCollisionShape* Bullet3CollisionShape::MakeConvexHull() const {
+        auto&& pRawMesh = m_rigidbody->GetRawMesh();
+        const uint32_t meshId = m_rigidbody->GetMeshId();
+
+        /// convex shape without a mesh, the same as in PhysX
+        if (!pRawMesh || meshId >= pRawMesh->GetMeshesCount()) {
+            SR_WARN("Bullet3CollisionShape::MakeConvexHull() : mesh is not set!");
+            return new btBoxShape(SR_PHYSICS_UTILS_NS::FV3ToBtV3(GetSize()));
+        }
+
+        auto&& scale = GetScale();
+        auto&& pShape = new btConvexHullShape();
+
+        for (auto&& vertex : pRawMesh->GetVertices(meshId)) {
+            pShape->addPoint(btVector3(vertex.position.x * scale.x, vertex.position.y * scale.y, vertex.position.z * scale.z), false);
+        }
+
+        pShape->optimizeConvexHull();
+        pShape->recalcLocalAabb();
+
+        return pShape;
+    }
+
+    SR_MATH_NS::FVector3 Bullet3CollisionShape::CalculateLocalInertia(float_t mass) const {
+        btVector3 inertia(0, 0, 0);
+
+        if (m_shape && mass > 0.f) {
+            m_shape->calculateLocalInertia(mass, inertia);
+        }
+
+        return SR_PHYSICS_UTILS_NS::BtV33ToFV(inertia);
     }
-}
\ No newline at end of file
+}
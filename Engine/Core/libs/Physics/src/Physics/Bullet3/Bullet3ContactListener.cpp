@@ -0,0 +1,204 @@
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <Physics/Bullet3/Bullet3ContactListener.h>
+#include <Physics/Rigidbody.h>
+
+#include <Utils/ECS/GameObject.h>
+#include <Utils/Common/CollisionData.h>
+
+namespace SR_PHYSICS_NS {
+    void Bullet3ContactListener::Update(btDispatcher* pDispatcher) {
+        SR_TRACY_ZONE;
+
+        m_previousPairs.swap(m_pairs);
+        m_pairs.clear();
+
+        const int32_t manifolds = pDispatcher->getNumManifolds();
+
+        for (int32_t i = 0; i < manifolds; ++i) {
+            const btPersistentManifold* pManifold = pDispatcher->getManifoldByIndexInternal(i);
+
+            /// the manifolds live while the bounds overlap, the pair is touching only with a penetrating point
+            bool isTouching = false;
+
+            for (int32_t point = 0; point < pManifold->getNumContacts(); ++point) {
+                if (pManifold->getContactPoint(point).getDistance() <= 0.f) {
+                    isTouching = true;
+                    break;
+                }
+            }
+
+            if (!isTouching) {
+                continue;
+            }
+
+            auto&& pObjectA = pManifold->getBody0();
+            auto&& pObjectB = pManifold->getBody1();
+
+            Pair pair;
+            pair.pFirst = SR_PHYSICS_UTILS_NS::GetBtObjectRigidbody(pObjectA);
+            pair.pSecond = SR_PHYSICS_UTILS_NS::GetBtObjectRigidbody(pObjectB);
+
+            if (!pair.pFirst || !pair.pSecond) {
+                continue;
+            }
+
+            const bool isTriggerA = !pObjectA->hasContactResponse();
+            const bool isTriggerB = !pObjectB->hasContactResponse();
+
+            /// PhysX does not report the trigger-trigger pairs
+            if (isTriggerA && isTriggerB) {
+                continue;
+            }
+
+            /// the trigger goes first, the same as in the trigger pairs of PhysX
+            if (isTriggerB) {
+                std::swap(pair.pFirst, pair.pSecond);
+                std::swap(pObjectA, pObjectB);
+            }
+
+            pair.isTrigger = isTriggerA || isTriggerB;
+
+            if (pair.isTrigger && !m_triggersVsStatic && pObjectB->isStaticObject()) {
+                continue;
+            }
+
+            /// compound shapes have a manifold per a child
+            if (!m_pairs.insert(pair).second) {
+                continue;
+            }
+
+            if (m_previousPairs.count(pair)) {
+                if (!pair.isTrigger) {
+                    AddEvent(pair, EventType::CollisionStay, pManifold);
+                }
+            }
+            else {
+                AddEvent(pair, pair.isTrigger ? EventType::TriggerEnter : EventType::CollisionEnter, pManifold);
+            }
+        }
+
+        for (auto&& pair : m_previousPairs) {
+            if (!m_pairs.count(pair)) {
+                AddEvent(pair, pair.isTrigger ? EventType::TriggerExit : EventType::CollisionExit, nullptr);
+            }
+        }
+    }
+
+    bool Bullet3ContactListener::IsListening(const SR_PTYPES_NS::Rigidbody* pRigidbody, EventType type) {
+        if (!pRigidbody) {
+            return false;
+        }
+
+        ContactEvent event = ContactEvent::Trigger;
+
+        switch (type) {
+            case EventType::CollisionEnter:
+            case EventType::CollisionExit:
+                event = ContactEvent::Collision;
+                break;
+            case EventType::CollisionStay:
+                event = ContactEvent::CollisionStay;
+                break;
+            default:
+                break;
+        }
+
+        return pRigidbody->GetContactEvents() & static_cast<ContactEventFlags>(event);
+    }
+
+    void Bullet3ContactListener::AddEvent(const Pair& pair, EventType type, const btPersistentManifold* pManifold) {
+        if (!IsListening(pair.pFirst, type) && !IsListening(pair.pSecond, type)) {
+            return;
+        }
+
+        auto&& event = m_events.emplace_back();
+        event.pRigidbodies[0] = pair.pFirst;
+        event.pRigidbodies[1] = pair.pSecond;
+        event.type = type;
+
+        /// there are no points left for the exits, the triggers have no impulses
+        if (!pManifold || pair.isTrigger || pManifold->getNumContacts() == 0) {
+            return;
+        }
+
+        btVector3 point(0, 0, 0);
+        btVector3 impulse(0, 0, 0);
+
+        for (int32_t i = 0; i < pManifold->getNumContacts(); ++i) {
+            auto&& contactPoint = pManifold->getContactPoint(i);
+            point += contactPoint.getPositionWorldOnB();
+            impulse += contactPoint.m_normalWorldOnB * contactPoint.getAppliedImpulse();
+        }
+
+        const btScalar count = static_cast<btScalar>(pManifold->getNumContacts());
+
+        event.point = SR_PHYSICS_UTILS_NS::BtV33ToFV(point / count);
+        event.impulse = SR_PHYSICS_UTILS_NS::BtV33ToFV(impulse / count);
+    }
+
+    void Bullet3ContactListener::Dispatch() {
+        SR_TRACY_ZONE;
+
+        if (m_events.empty()) {
+            return;
+        }
+
+        /// the components are free to do anything with the physics here, new events come only from the next step
+        m_dispatched.swap(m_events);
+
+        for (auto&& event : m_dispatched) {
+            Dispatch(event, 0);
+            Dispatch(event, 1);
+        }
+
+        m_dispatched.clear();
+    }
+
+    void Bullet3ContactListener::Dispatch(const Event& event, uint8_t index) {
+        auto&& pRigidbody = event.pRigidbodies[index];
+        auto&& pOther = event.pRigidbodies[1 - index];
+
+        if (!IsListening(pRigidbody, event.type)) {
+            return;
+        }
+
+        auto&& gameObject = pRigidbody->GetGameObject();
+        if (!gameObject) {
+            return;
+        }
+
+        SR_UTILS_NS::CollisionData data = { };
+
+        data.point = event.point;
+        data.impulse = event.impulse;
+        data.pHandler = pOther;
+
+        for (auto&& pComponent : gameObject->GetComponents()) {
+            if (pComponent == pRigidbody) {
+                continue;
+            }
+
+            switch (event.type) {
+                case EventType::CollisionEnter: pComponent->OnCollisionEnter(data); break;
+                case EventType::CollisionStay: pComponent->OnCollisionStay(data); break;
+                case EventType::CollisionExit: pComponent->OnCollisionExit(data); break;
+                case EventType::TriggerEnter: pComponent->OnTriggerEnter(data); break;
+                case EventType::TriggerExit: pComponent->OnTriggerExit(data); break;
+            }
+        }
+    }
+
+    void Bullet3ContactListener::Remove(SR_PTYPES_NS::Rigidbody* pRigidbody) {
+        std::erase_if(m_events, [pRigidbody](const Event& event) {
+            return event.pRigidbodies[0] == pRigidbody || event.pRigidbodies[1] == pRigidbody;
+        });
+
+        /// a removed rigidbody does not get the exit events, the same as in PhysX
+        std::erase_if(m_pairs, [pRigidbody](const Pair& pair) {
+            return pair.pFirst == pRigidbody || pair.pSecond == pRigidbody;
+        });
+    }
+}
@@ -2,38 +2,148 @@
 // Created by Monika on 22.11.2022.
 //
 
+#include <Utils/Resources/ResourceManager.h>
+
 #include <Physics/Bullet3/Bullet3LibraryImpl.h>
 
 #include <Physics/Bullet3/Bullet3CollisionShape.h>
 #include <Physics/Bullet3/Bullet3Rigidbody3D.h>
 #include <Physics/Bullet3/Bullet3PhysicsWorld.h>
+#include <Physics/Bullet3/Bullet3TaskScheduler.h>
+#include <Physics/Bullet3/Bullet3CharacterController3D.h>
 
 namespace SR_PHYSICS_NS {
+    Bullet3LibraryImpl::~Bullet3LibraryImpl() {
+        if (m_taskScheduler && btGetTaskScheduler() == m_taskScheduler) {
+            btSetTaskScheduler(btGetSequentialTaskScheduler());
+        }
+
+        if (m_isTaskSchedulerOwned) {
+            SR_SAFE_DELETE_PTR(m_taskScheduler);
+        }
+    }
+
+    bool Bullet3LibraryImpl::Initialize() {
+        SR_TRACY_ZONE;
+
+        if (!Super::Initialize()) {
+            return false;
+        }
+
+        LoadSettings();
+
+        return true;
+    }
+
+    void Bullet3LibraryImpl::LoadSettings() {
+        auto&& path = SR_UTILS_NS::ResourceManager::Instance().GetResPath().Concat("Engine/Configs/Physics.xml");
+        auto&& document = SR_XML_NS::Document::Load(path);
+        if (!document.Valid()) {
+            SR_WARN("Bullet3LibraryImpl::LoadSettings() : failed to load xml document, default settings are used.\n\tPath: " + path.ToString());
+            return;
+        }
+
+        auto&& bullet3Node = document.Root().GetNode("Physics").TryGetNode("Bullet3");
+
+        auto&& solverNode = bullet3Node.TryGetNode("Solver");
+        m_solverIterations = SR_MAX(solverNode.TryGetAttribute("Iterations").ToInt(m_solverIterations), 1);
+
+        if (auto&& pool = solverNode.TryGetAttribute("Pool").ToString(); !pool.empty() && pool != "auto") {
+            m_solverPoolSize = static_cast<uint32_t>(SR_MAX(std::atoi(pool.c_str()), 0));
+        }
+
+        auto&& schedulerNode = bullet3Node.TryGetNode("TaskScheduler");
+
+        if (auto&& mode = schedulerNode.TryGetAttribute("Mode").ToString(); !mode.empty()) {
+            m_schedulerMode = SR_UTILS_NS::EnumReflector::FromString<Bullet3SchedulerMode>(mode);
+        }
+
+        if (auto&& workers = schedulerNode.TryGetAttribute("Workers").ToString(); !workers.empty() && workers != "auto") {
+            m_schedulerWorkers = static_cast<uint32_t>(SR_MAX(std::atoi(workers.c_str()), 0));
+        }
+    }
+
+    uint32_t Bullet3LibraryImpl::GetSolverPoolSize() const {
+        if (m_solverPoolSize > 0) {
+            return m_solverPoolSize;
+        }
+
+        if (m_taskScheduler) {
+            return static_cast<uint32_t>(SR_MAX(m_taskScheduler->getNumThreads(), 1));
+        }
+
+        return 1;
+    }
+
+    btITaskScheduler* Bullet3LibraryImpl::GetTaskScheduler() {
+        if (m_taskScheduler) {
+            return m_taskScheduler;
+        }
+
+        auto&& physicsLibrary = PhysicsLibrary::Instance();
+
+        const uint32_t cores = std::thread::hardware_concurrency();
+        const uint32_t workers = m_schedulerWorkers > 0 ? m_schedulerWorkers : (cores > 3 ? cores - 2 : 1);
+
+        switch (m_schedulerMode) {
+            case Bullet3SchedulerMode::JobSystem:
+                if (physicsLibrary.GetJobScheduler()) {
+                    m_taskScheduler = new Bullet3TaskScheduler(physicsLibrary.GetJobScheduler(), physicsLibrary.GetJobWorkersCount());
+                    m_isTaskSchedulerOwned = true;
+                    break;
+                }
+
+                SR_WARN("Bullet3LibraryImpl::GetTaskScheduler() : the job system is not set, own Bullet threads are used.");
+                [[fallthrough]];
+            case Bullet3SchedulerMode::Default:
+                /// nullptr if Bullet is built without the multithreading
+                if ((m_taskScheduler = btCreateDefaultTaskScheduler())) {
+                    m_taskScheduler->setNumThreads(static_cast<int>(workers));
+                    m_isTaskSchedulerOwned = true;
+                    break;
+                }
+
+                SR_WARN("Bullet3LibraryImpl::GetTaskScheduler() : Bullet is built without the multithreading, the simulation is sequential.");
+                [[fallthrough]];
+            case Bullet3SchedulerMode::Sequential:
+            default:
+                m_taskScheduler = btGetSequentialTaskScheduler();
+                m_isTaskSchedulerOwned = false;
+                break;
+        }
+
+        SR_LOG("Bullet3LibraryImpl::GetTaskScheduler() : \"{}\" scheduler with {} threads.", m_taskScheduler->getName(), m_taskScheduler->getNumThreads());
+
+        return m_taskScheduler;
+    }
+
     bool Bullet3LibraryImpl::IsShapeSupported(ShapeType type) const {
         switch (type) {
-            case ShapeType::Box2D:
             case ShapeType::Box3D:
             case ShapeType::Cylinder3D:
             case ShapeType::Capsule3D:
             case ShapeType::Sphere3D:
             case ShapeType::Plane3D:
+            case ShapeType::Convex3D:
                 return true;
             default:
                 return false;
         }
     }
 
-    SR_PTYPES_NS::CollisionShape *Bullet3LibraryImpl::CreateCollisionShape() {
+    SR_PTYPES_NS::CollisionShape* Bullet3LibraryImpl::CreateCollisionShape() {
         return new SR_PTYPES_NS::Bullet3CollisionShape(this);
     }
 
-    SR_PTYPES_NS::Rigidbody3D *Bullet3LibraryImpl::CreateRigidbody3D() {
-        auto&& pRigidbody = new SR_PTYPES_NS::Bullet3Rigidbody3D(this);
+    SR_PTYPES_NS::Rigidbody3DImpl* Bullet3LibraryImpl::CreateRigidbody3DImpl() {
+        return new SR_PTYPES_NS::Bullet3Rigidbody3DImpl();
+    }
 
-        return pRigidbody;
+    SR_PTYPES_NS::CharacterController3DImpl* Bullet3LibraryImpl::CreateCharacterController3DImpl() {
+        return new SR_PTYPES_NS::Bullet3CharacterController3DImpl(this);
     }
 
-    SR_PHYSICS_NS::PhysicsWorld *Bullet3LibraryImpl::CreatePhysicsWorld(Space space) {
+    SR_PHYSICS_NS::PhysicsWorld* Bullet3LibraryImpl::CreatePhysicsWorld(Space space) {
         return new SR_PHYSICS_NS::Bullet3PhysicsWorld(this, space);
     }
-}
\ No newline at end of file
+}
@@ -3,90 +3,364 @@
 //
 
 #include <Physics/Bullet3/Bullet3PhysicsWorld.h>
+#include <Physics/Bullet3/Bullet3LibraryImpl.h>
+#include <Physics/Bullet3/Bullet3Rigidbody3D.h>
+#include <Physics/Bullet3/Bullet3ContactListener.h>
+#include <Physics/Bullet3/Bullet3CharacterController3D.h>
+#include <Physics/Bullet3/Bullet3Raycast3DImpl.h>
+#include <Physics/3D/Raycast3D.h>
+
+#include <BulletCollision/CollisionDispatch/btCollisionDispatcherMt.h>
+#include <BulletDynamics/Dynamics/btDiscreteDynamicsWorldMt.h>
+#include <BulletDynamics/ConstraintSolver/btSequentialImpulseConstraintSolverMt.h>
 
 namespace SR_PHYSICS_NS {
     Bullet3PhysicsWorld::Bullet3PhysicsWorld(PhysicsWorld::LibraryPtr pLibrary, Space space)
         : Super(pLibrary, space)
-    { }
+    {
+        m_contactListener = new Bullet3ContactListener();
+        m_raycast3dImpl = new Bullet3Raycast3DImpl(this);
+    }
 
     Bullet3PhysicsWorld::~Bullet3PhysicsWorld() {
+        /// the controllers remove their actions and ghost objects themselves
+        for (auto&& pController : m_characterControllers) {
+            if (auto&& pImpl = pController->GetImpl()) {
+                pImpl->DeInit();
+            }
+        }
+
+        m_characterControllers.clear();
+
+        if (m_dynamicsWorld) {
+            /// the objects are owned by the rigidbodies, they must not remove them from the deleted world
+            auto&& objects = m_dynamicsWorld->getCollisionObjectArray();
+
+            for (int32_t i = objects.size() - 1; i >= 0; --i) {
+                auto&& pObject = objects[i];
+
+                if (auto&& pImpl = GetImpl(SR_PHYSICS_UTILS_NS::GetBtObjectRigidbody(pObject))) {
+                    pImpl->SetWorld(nullptr);
+                }
+
+                m_dynamicsWorld->removeCollisionObject(pObject);
+            }
+        }
+
         SR_SAFE_DELETE_PTR(m_dynamicsWorld);
         SR_SAFE_DELETE_PTR(m_solver);
+        SR_SAFE_DELETE_PTR(m_solverPool);
         SR_SAFE_DELETE_PTR(m_broadPhase);
+        SR_SAFE_DELETE_PTR(m_ghostPairCallback);
         SR_SAFE_DELETE_PTR(m_dispatcher);
         SR_SAFE_DELETE_PTR(m_collisionConfiguration);
+        SR_SAFE_DELETE_PTR(m_contactListener);
     }
 
     bool Bullet3PhysicsWorld::Initialize() {
-        ///collision configuration contains default setup for memory, collision setup
-        m_collisionConfiguration = new btDefaultCollisionConfiguration();
+        SR_TRACY_ZONE;
 
-        //m_collisionConfiguration->setConvexConvexMultipointIterations();
+        auto&& pLibrary = GetLibrary<Bullet3LibraryImpl>();
+        if (!pLibrary) {
+            return false;
+        }
+
+        /// the scheduler must be set before the world, the solver pool takes the count of the threads from it
+        btSetTaskScheduler(pLibrary->GetTaskScheduler());
 
-        ///use the default collision dispatcher. For parallel processing you can use a diffent dispatcher (see Extras/BulletMultiThreaded)
-        m_dispatcher = new btCollisionDispatcher(m_collisionConfiguration);
+        /// the pools are shared by the threads of the narrowphase, the allocations out of them are locked
+        btDefaultCollisionConstructionInfo constructionInfo;
+        constructionInfo.m_defaultMaxPersistentManifoldPoolSize = 80000;
+        constructionInfo.m_defaultMaxCollisionAlgorithmPoolSize = 80000;
 
+        m_collisionConfiguration = new btDefaultCollisionConfiguration(constructionInfo);
+        m_dispatcher = new btCollisionDispatcherMt(m_collisionConfiguration);
         m_broadPhase = new btDbvtBroadphase();
 
-        ///the default constraint solver. For parallel processing you can use a different solver (see Extras/BulletMultiThreaded)
-        m_solver = new btSequentialImpulseConstraintSolver();
+        m_ghostPairCallback = new btGhostPairCallback();
+        m_broadPhase->getOverlappingPairCache()->setInternalGhostPairCallback(m_ghostPairCallback);
+
+        /// islands are solved by the solvers of the pool in parallel, the big islands are split by the Mt solver
+        m_solverPool = new btConstraintSolverPoolMt(static_cast<int>(pLibrary->GetSolverPoolSize()));
+        m_solver = new btSequentialImpulseConstraintSolverMt();
 
-        m_dynamicsWorld = new btDiscreteDynamicsWorld(m_dispatcher, m_broadPhase, m_solver, m_collisionConfiguration);
+        m_dynamicsWorld = new btDiscreteDynamicsWorldMt(m_dispatcher, m_broadPhase, m_solverPool, m_solver, m_collisionConfiguration);
 
         m_dynamicsWorld->setGravity(btVector3(0, -SR_EARTH_GRAVITY, 0));
 
-        m_dynamicsWorld->getSolverInfo().m_deformable_erp = 0.1;
-        m_dynamicsWorld->getSolverInfo().m_deformable_maxErrorReduction = btScalar(20);
-        m_dynamicsWorld->getSolverInfo().m_leastSquaresResidualThreshold = 1e-3;
-        m_dynamicsWorld->getSolverInfo().m_splitImpulse = true;
-        m_dynamicsWorld->getSolverInfo().m_numIterations = 100;
+        auto&& solverInfo = m_dynamicsWorld->getSolverInfo();
+        solverInfo.m_numIterations = pLibrary->GetSolverIterations();
+        solverInfo.m_leastSquaresResidualThreshold = 1e-3;
+        solverInfo.m_splitImpulse = true;
 
-        // m_dynamicsWorld->getDispatchInfo().m_enableSPU = true;
+        m_contactListener->SetTriggersVsStatic(PhysicsLibrary::Instance().IsTriggersVsStaticEnabled());
 
-        m_dynamicsWorld->setInternalTickCallback([](btDynamicsWorld *pWorld, btScalar timeStep) {
-            //std::cout << pWorld->getDispatcher()->getNumManifolds() << std::endl;
-        });
+        SR_LOG("Bullet3PhysicsWorld::Initialize() : {} solver iterations, {} solvers in the pool.",
+            solverInfo.m_numIterations, pLibrary->GetSolverPoolSize()
+        );
 
         return true;
     }
 
+    btDiscreteDynamicsWorld* Bullet3PhysicsWorld::GetBtWorld() const noexcept {
+        return m_dynamicsWorld;
+    }
+
     bool Bullet3PhysicsWorld::ClearForces() {
-        m_dynamicsWorld->clearForces();
-        return true;
+        SR_TRACY_ZONE;
+
+        if (m_dynamicsWorld) {
+            m_dynamicsWorld->clearForces();
+        }
+
+        return PhysicsWorld::ClearForces();
     }
 
     bool Bullet3PhysicsWorld::Synchronize() {
-        const int32_t numManifolds = m_dispatcher->getNumManifolds();
-        for (int32_t i = 0; i < numManifolds; ++i) {
-            const btPersistentManifold* contactManifold = m_dispatcher->getManifoldByIndexInternal(i);
+        SR_TRACY_ZONE;
+        const bool result = SynchronizeActive() && SynchronizeDirty();
+
+        const auto start = std::chrono::steady_clock::now();
+
+        /// the controllers report their hits by the synchronization as well
+        SynchronizeCharacterControllers();
 
-            if (contactManifold->getNumContacts() > 0)
-            {
-                /// Activate triggers here
+        /// the components see the synchronized transforms
+        m_contactListener->Dispatch();
+
+        m_statistics.callbackTime += std::chrono::duration<double_t, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        return result;
+    }
+
+    PhysicsStatistics Bullet3PhysicsWorld::GetStatistics() const {
+        PhysicsStatistics statistics = Super::GetStatistics();
+
+        if (!m_dynamicsWorld) {
+            return statistics;
+        }
+
+        std::unordered_set<int32_t> islands;
+
+        auto&& objects = m_dynamicsWorld->getCollisionObjectArray();
+
+        for (int32_t i = 0; i < objects.size(); ++i) {
+            auto&& pObject = objects[i];
+
+            if (pObject->isStaticObject()) {
+                ++statistics.staticBodies;
+                continue;
             }
-            else
-            {
-                /// Deactivate trigger here
+
+            if (!pObject->isActive()) {
+                ++statistics.sleepingBodies;
+                continue;
+            }
+
+            ++statistics.activeBodies;
+
+            if (pObject->getIslandTag() >= 0) {
+                islands.insert(pObject->getIslandTag());
             }
         }
 
-        uint32_t numCollisionObjects = m_dynamicsWorld->getNumCollisionObjects();
-        for (uint32_t i = 0; i < numCollisionObjects; ++i) {
-            btCollisionObject* colObj = m_dynamicsWorld->getCollisionObjectArray()[i];
-            /// btCollisionShape* collisionShape = colObj->getCollisionShape();
+        statistics.islands = static_cast<uint32_t>(islands.size());
+        statistics.broadPhasePairs = static_cast<uint32_t>(m_broadPhase->getOverlappingPairCache()->getNumOverlappingPairs());
 
-            btRigidBody* body = btRigidBody::upcast(colObj);
-            btTransform trans;
-            if (body && body->getMotionState()) {
-                body->getMotionState()->getWorldTransform(trans);
+        for (int32_t i = 0; i < m_dispatcher->getNumManifolds(); ++i) {
+            if (m_dispatcher->getManifoldByIndexInternal(i)->getNumContacts() > 0) {
+                ++statistics.contacts;
             }
-            else {
-                trans = colObj->getWorldTransform();
+        }
+
+        return statistics;
+    }
+
+    bool Bullet3PhysicsWorld::StepSimulation(float_t step) {
+        SR_TRACY_ZONE;
+
+        if (!m_dynamicsWorld) {
+            return false;
+        }
+
+        /// the step is fixed by the physics scene, the interpolation is done by the engine as well
+        m_dynamicsWorld->stepSimulation(step, 0);
+
+        m_contactListener->Update(m_dispatcher);
+
+        m_hasNewState = true;
+
+        return true;
+    }
+
+    void Bullet3PhysicsWorld::MarkMoved(RigidbodyPtr pRigidbody) {
+        std::lock_guard<std::mutex> lock(m_steppedMutex);
+        m_steppedRigidbodies.emplace_back(pRigidbody);
+    }
+
+    bool Bullet3PhysicsWorld::AddRigidbody(PhysicsWorld::RigidbodyPtr pRigidbody) {
+        if (!pRigidbody) {
+            SRHalt("pRigidbody is nullptr!");
+            return false;
+        }
+
+        auto&& pImpl = GetImpl(pRigidbody);
+        if (!pImpl) {
+            SRHalt("Bullet3PhysicsWorld::AddRigidbody() : the rigidbody is not a Bullet3 one!");
+            return false;
+        }
+
+        if (pRigidbody->IsBodyDirty()) {
+            pRigidbody->InitBody();
+        }
+        else if (!pRigidbody->GetHandle()) {
+            pImpl->InitBody();
+        }
+
+        auto&& pObject = static_cast<btCollisionObject*>(pRigidbody->GetHandle());
+        if (!pObject) {
+            SRHalt("pHandle is nullptr!");
+            return false;
+        }
+
+        const SR_UTILS_NS::StringAtom layer = pRigidbody->GetCollisionLayer();
+        const auto group = static_cast<int32_t>(Raycast3D::GetLayerMask(layer));
+        const auto mask = static_cast<int32_t>(PhysicsLibrary::Instance().GetCollisionMask(layer));
+
+        if (auto&& pBody = btRigidBody::upcast(pObject)) {
+            m_dynamicsWorld->addRigidBody(pBody, group, mask);
+        }
+        else {
+            m_dynamicsWorld->addCollisionObject(pObject, group, mask);
+        }
+
+        pImpl->SetWorld(this);
+
+        /// the transform could be moved while the rigidbody was not in the world
+        MarkDirty(pRigidbody);
+
+        return true;
+    }
+
+    bool Bullet3PhysicsWorld::RemoveRigidbody(PhysicsWorld::RigidbodyPtr pRigidbody) {
+        if (!pRigidbody) {
+            SRHalt("pRigidbody is nullptr!");
+            return false;
+        }
+
+        auto&& pImpl = GetImpl(pRigidbody);
+
+        if (auto&& pObject = static_cast<btCollisionObject*>(pRigidbody->GetHandle()); pObject && pImpl && pImpl->GetWorld() == this) {
+            /// removes the rigid bodies from the constraints and the non-static list too
+            m_dynamicsWorld->removeCollisionObject(pObject);
+            pImpl->SetWorld(nullptr);
+        }
+
+        UnmarkDirty(pRigidbody);
+        m_contactListener->Remove(pRigidbody);
+
+        if (!m_characterControllers.empty()) {
+            const std::vector<RigidbodyPtr> removed = { pRigidbody };
+
+            for (auto&& pController : m_characterControllers) {
+                pController->RemoveHits(removed);
+            }
+        }
+
+        std::erase(m_movedRigidbodies, pRigidbody);
+        std::erase(m_previousMovedRigidbodies, pRigidbody);
+
+        {
+            std::lock_guard<std::mutex> lock(m_steppedMutex);
+            std::erase(m_steppedRigidbodies, pRigidbody);
+        }
+
+        return true;
+    }
+
+    bool Bullet3PhysicsWorld::AddCharacterController(CharacterControllerPtr pController) {
+        if (!pController || !pController->GetImpl()) {
+            SRHalt("Bullet3PhysicsWorld::AddCharacterController() : invalid controller!");
+            return false;
+        }
+
+        if (std::find(m_characterControllers.begin(), m_characterControllers.end(), pController) != m_characterControllers.end()) {
+            return true;
+        }
+
+        if (!pController->GetImpl()->Init(this)) {
+            SR_ERROR("Bullet3PhysicsWorld::AddCharacterController() : failed to initialize controller!");
+            return false;
+        }
+
+        m_characterControllers.emplace_back(pController);
+
+        return true;
+    }
+
+    bool Bullet3PhysicsWorld::RemoveCharacterController(CharacterControllerPtr pController) {
+        auto&& pIt = std::find(m_characterControllers.begin(), m_characterControllers.end(), pController);
+        if (pIt == m_characterControllers.end()) {
+            return false;
+        }
+
+        m_characterControllers.erase(pIt);
+
+        if (auto&& pImpl = pController->GetImpl()) {
+            pImpl->DeInit();
+        }
+
+        return true;
+    }
+
+    void Bullet3PhysicsWorld::MoveCharacterControllers(float_t step) {
+        SR_TRACY_ZONE;
+
+        for (auto&& pController : m_characterControllers) {
+            pController->PrepareMove(step);
+        }
+    }
+
+    void Bullet3PhysicsWorld::SynchronizeCharacterControllers() {
+        SR_TRACY_ZONE;
+
+        for (auto&& pController : m_characterControllers) {
+            if (auto&& pImpl = dynamic_cast<SR_PTYPES_NS::Bullet3CharacterController3DImpl*>(pController->GetImpl())) {
+                pImpl->UpdateContacts();
             }
 
-            auto&& pRigidbody = (RigidbodyPtr)colObj->getUserPointer();
+            pController->Synchronize();
+        }
+    }
+
+    bool Bullet3PhysicsWorld::SynchronizeActive() {
+        SR_TRACY_ZONE;
+
+        /// without a new step the awake bodies are the same, the interpolation states must not be pushed twice
+        if (!m_hasNewState.exchange(false)) {
+            return true;
+        }
+
+        const bool isInterpolated = IsInterpolationEnabled();
+
+        /// re-adding of a rigidbody removes it from the list, it can't be walked meanwhile
+        m_synchronizedRigidbodies.clear();
+
+        {
+            std::lock_guard<std::mutex> lock(m_steppedMutex);
+            m_synchronizedRigidbodies.swap(m_steppedRigidbodies);
+        }
+
+        /// a body is reported by each step since the last synchronization
+        std::sort(m_synchronizedRigidbodies.begin(), m_synchronizedRigidbodies.end());
+        m_synchronizedRigidbodies.erase(std::unique(m_synchronizedRigidbodies.begin(), m_synchronizedRigidbodies.end()), m_synchronizedRigidbodies.end());
 
-            if (!pRigidbody) {
+        m_movedRigidbodies.swap(m_previousMovedRigidbodies);
+        m_movedRigidbodies.clear();
+
+        for (auto&& pRigidbody : m_synchronizedRigidbodies) {
+            if (pRigidbody->IsBodyDirty()) {
+                SRVerifyFalse(!ReAddRigidbody(pRigidbody));
                 continue;
             }
 
@@ -95,45 +369,136 @@ namespace SR_PHYSICS_NS {
                 continue;
             }
 
-            if (pRigidbody->IsMatrixDirty()) {
-                pRigidbody->UpdateMatrix();
+            pRigidbody->Synchronize(isInterpolated);
+            m_movedRigidbodies.emplace_back(pRigidbody);
+        }
+
+        if (!isInterpolated) {
+            return true;
+        }
+
+        /// bodies that fell asleep are not interpolated anymore, they are left at their last simulated state
+        std::sort(m_movedRigidbodies.begin(), m_movedRigidbodies.end());
+
+        for (auto&& pRigidbody : m_previousMovedRigidbodies) {
+            if (!std::binary_search(m_movedRigidbodies.begin(), m_movedRigidbodies.end(), pRigidbody)) {
+                pRigidbody->Interpolate(1.f);
             }
-            else if (auto&& pTransform = pRigidbody->GetTransform()) {
-                btVector3 pos = trans.getOrigin();
-                btQuaternion orn = trans.getRotation();
+        }
 
-                pTransform->SetTranslation(SR_MATH_NS::FVector3(pos.x(), pos.y(), pos.z()) - pRigidbody->GetCenterDirection());
-                pTransform->SetRotation(SR_MATH_NS::Quaternion(orn.x(), orn.y(), orn.z(), orn.w()));
+        return true;
+    }
 
-                pRigidbody->SetMatrixDirty(false);
+    bool Bullet3PhysicsWorld::SynchronizeDirty() {
+        SR_TRACY_ZONE;
+
+        const bool isInterpolated = IsInterpolationEnabled();
+
+        for (auto&& pRigidbody : TakeDirtyRigidbodies()) {
+            auto&& pObject = static_cast<btCollisionObject*>(pRigidbody->GetHandle());
+            auto&& pImpl = GetImpl(pRigidbody);
+
+            /// registered, but not flushed yet, AddRigidbody() queues it again
+            if (!pObject || !pObject->getBroadphaseHandle() || !pImpl || pImpl->GetWorld() != this) {
+                continue;
+            }
+
+            if (pRigidbody->IsBodyDirty()) {
+                SRVerifyFalse(!ReAddRigidbody(pRigidbody));
+                continue;
+            }
+
+            /// the collision layer is a part of the shape state, see Rigidbody::SetCollisionLayer()
+            const bool isShapeDirty = pRigidbody->IsShapeDirty();
+
+            if (isShapeDirty) {
+                UpdateCollisionFilter(pRigidbody, pObject->getBroadphaseHandle());
+                /// the pairs of the old filter are found again by the next step
+                m_broadPhase->getOverlappingPairCache()->cleanProxyFromPairs(pObject->getBroadphaseHandle(), m_dispatcher);
             }
+
+            if (pRigidbody->UpdateShape() == RBUpdShapeRes::Error) {
+                SR_ERROR("Bullet3PhysicsWorld::Synchronize() : failed to update shape!");
+                continue;
+            }
+
+            if (pRigidbody->IsMatrixDirty()) {
+                /// the transform was moved by the engine, dynamic bodies are teleported by the synchronization
+                if (pObject->hasContactResponse() && !pObject->isStaticOrKinematicObject()) {
+                    pRigidbody->Synchronize(isInterpolated);
+                }
+                else {
+                    pRigidbody->UpdateMatrix();
+                }
+            }
+            else if (!isShapeDirty) {
+                continue;
+            }
+
+            /// the bounds of the sleeping and static objects are not updated by the step
+            m_dynamicsWorld->updateSingleAabb(pObject);
         }
 
         return true;
     }
 
-    bool Bullet3PhysicsWorld::AddRigidbody(PhysicsWorld::RigidbodyPtr pRigidbody) {
-        if (auto&& pHandle = pRigidbody->GetHandle()) {
-            m_dynamicsWorld->addRigidBody((btRigidBody*)pHandle);
-            return true;
+    void Bullet3PhysicsWorld::Interpolate(float_t alpha) {
+        SR_TRACY_ZONE;
+
+        if (!IsInterpolationEnabled()) {
+            return;
         }
 
-        SRHalt("pHandle is nullptr!");
-        return false;
+        for (auto&& pRigidbody : m_movedRigidbodies) {
+            pRigidbody->Interpolate(alpha);
+        }
     }
 
-    bool Bullet3PhysicsWorld::RemoveRigidbody(PhysicsWorld::RigidbodyPtr pRigidbody) {
-        if (auto&& pHandle = pRigidbody->GetHandle()) {
-            m_dynamicsWorld->removeRigidBody((btRigidBody *)pHandle);
-            return true;
+    void Bullet3PhysicsWorld::RestoreSimulatedPoses() {
+        SR_TRACY_ZONE;
+
+        /// the bodies that fell asleep are interpolated to their last state by the synchronization, they are restored too
+        for (auto&& pRigidbody : m_movedRigidbodies) {
+            pRigidbody->RestoreSimulatedPose();
         }
 
-        SRHalt("pHandle is nullptr!");
-        return false;
+        for (auto&& pRigidbody : m_previousMovedRigidbodies) {
+            pRigidbody->RestoreSimulatedPose();
+        }
     }
 
-    bool Bullet3PhysicsWorld::StepSimulation(float_t step) {
-        m_dynamicsWorld->stepSimulation(step);
-        return true;
+    void Bullet3PhysicsWorld::ShiftOrigin(const SR_MATH_NS::FVector3& shift) {
+        SR_TRACY_ZONE;
+
+        if (!m_dynamicsWorld) {
+            return;
+        }
+
+        auto&& objects = m_dynamicsWorld->getCollisionObjectArray();
+
+        for (int32_t i = 0; i < objects.size(); ++i) {
+            if (auto&& pRigidbody = SR_PHYSICS_UTILS_NS::GetBtObjectRigidbody(objects[i])) {
+                pRigidbody->ShiftOrigin(shift);
+            }
+        }
+
+        /// the ghost objects of the controllers have no rigidbody
+        for (auto&& pController : m_characterControllers) {
+            pController->ShiftOrigin(shift);
+        }
+
+        /// the world updates the bounds of the sleeping and static objects too, the contact points are refreshed by the next step
+        m_dynamicsWorld->updateAabbs();
+    }
+
+    void Bullet3PhysicsWorld::UpdateCollisionFilter(RigidbodyPtr pRigidbody, btBroadphaseProxy* pProxy) {
+        const SR_UTILS_NS::StringAtom layer = pRigidbody->GetCollisionLayer();
+
+        pProxy->m_collisionFilterGroup = static_cast<int32_t>(Raycast3D::GetLayerMask(layer));
+        pProxy->m_collisionFilterMask = static_cast<int32_t>(PhysicsLibrary::Instance().GetCollisionMask(layer));
+    }
+
+    SR_PTYPES_NS::Bullet3Rigidbody3DImpl* Bullet3PhysicsWorld::GetImpl(RigidbodyPtr pRigidbody) {
+        return pRigidbody ? pRigidbody->GetImpl<SR_PTYPES_NS::Bullet3Rigidbody3DImpl>() : nullptr;
     }
-}
\ No newline at end of file
+}
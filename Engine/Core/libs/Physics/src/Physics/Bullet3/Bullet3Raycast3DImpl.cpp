@@ -0,0 +1,355 @@
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <Physics/Bullet3/Bullet3Raycast3DImpl.h>
+#include <Physics/Bullet3/Bullet3PhysicsWorld.h>
+#include <Physics/Rigidbody.h>
+
+#include <Utils/ECS/GameObject.h>
+
+namespace SR_PHYSICS_NS {
+    namespace {
+        /// The same rules as the pre-filter of PhysX: the layer bit is the group of the proxy, the tag is of the game object.
+        class Bullet3QueryFilter {
+        public:
+            Bullet3QueryFilter(const btVector3& origin, const RaycastFilter& filter, bool skipOrigin)
+                : m_origin(origin)
+                , m_layerMask(filter.layerMask)
+                , m_tag(filter.tag)
+                , m_skipOrigin(skipOrigin)
+            { }
+
+            SR_NODISCARD bool IsPassed(const btBroadphaseProxy* pProxy) const {
+                auto&& pObject = static_cast<const btCollisionObject*>(pProxy->m_clientObject);
+                const auto group = static_cast<uint32_t>(pProxy->m_collisionFilterGroup);
+
+                if (group != 0 && (group & m_layerMask) == 0) {
+                    return false;
+                }
+
+                if (!m_tag.ToStringRef().empty()) {
+                    auto&& pRigidbody = SR_PHYSICS_UTILS_NS::GetBtObjectRigidbody(pObject);
+                    if (!pRigidbody) {
+                        return false;
+                    }
+
+                    auto&& pGameObject = pRigidbody->GetGameObject();
+                    if (!pGameObject || pGameObject->GetTag().GetHash() != m_tag.GetHash()) {
+                        return false;
+                    }
+                }
+
+                /// the ray is cast from the center of the body, which would always hit itself
+                if (m_skipOrigin && pObject->getWorldTransform().getOrigin() == m_origin) {
+                    return false;
+                }
+
+                return true;
+            }
+
+        private:
+            btVector3 m_origin;
+            uint32_t m_layerMask = RaycastFilter::AllLayers;
+            SR_UTILS_NS::StringAtom m_tag;
+            bool m_skipOrigin = true;
+
+        };
+
+        class Bullet3RayCallback : public btCollisionWorld::AllHitsRayResultCallback {
+        public:
+            Bullet3RayCallback(const btVector3& from, const btVector3& to, const RaycastFilter& filter)
+                : btCollisionWorld::AllHitsRayResultCallback(from, to)
+                , m_filter(from, filter, true)
+            { }
+
+            bool needsCollision(btBroadphaseProxy* pProxy) const override {
+                return m_filter.IsPassed(pProxy);
+            }
+
+        private:
+            Bullet3QueryFilter m_filter;
+
+        };
+
+        /// Stops the traversal at the first accepted hit.
+        class Bullet3AnyRayCallback : public btCollisionWorld::RayResultCallback {
+        public:
+            Bullet3AnyRayCallback(const btVector3& from, const RaycastFilter& filter)
+                : m_filter(from, filter, true)
+            { }
+
+            bool needsCollision(btBroadphaseProxy* pProxy) const override {
+                return m_filter.IsPassed(pProxy);
+            }
+
+            btScalar addSingleResult(btCollisionWorld::LocalRayResult& result, bool normalInWorldSpace) override {
+                m_collisionObject = result.m_collisionObject;
+                m_closestHitFraction = 0.f;
+                return 0.f;
+            }
+
+        private:
+            Bullet3QueryFilter m_filter;
+
+        };
+
+        /// Keeps every hit of the sweep, convexSweepTest itself reports the closest one only.
+        class Bullet3SweepCallback : public btCollisionWorld::ConvexResultCallback {
+        public:
+            Bullet3SweepCallback(const btVector3& from, float_t distance, const RaycastFilter& filter)
+                : m_filter(from, filter, true)
+                , m_distance(distance)
+            { }
+
+            bool needsCollision(btBroadphaseProxy* pProxy) const override {
+                return m_filter.IsPassed(pProxy);
+            }
+
+            btScalar addSingleResult(btCollisionWorld::LocalConvexResult& result, bool normalInWorldSpace) override {
+                const btVector3 normal = normalInWorldSpace ? result.m_hitNormalLocal
+                    : result.m_hitCollisionObject->getWorldTransform().getBasis() * result.m_hitNormalLocal;
+
+                auto&& hit = m_hits.emplace_back();
+                hit.pHandler = SR_PHYSICS_UTILS_NS::GetBtObjectRigidbody(result.m_hitCollisionObject);
+                hit.distance = result.m_hitFraction * m_distance;
+                hit.normal = SR_PHYSICS_UTILS_NS::BtV33ToFV(normal);
+                /// the name is misleading, the point is in the world space
+                hit.position = SR_PHYSICS_UTILS_NS::BtV33ToFV(result.m_hitPointLocal);
+
+                return m_closestHitFraction;
+            }
+
+            SR_NODISCARD std::vector<SR_UTILS_NS::RaycastHit>& GetHits() { return m_hits; }
+
+        private:
+            Bullet3QueryFilter m_filter;
+            float_t m_distance = 0.f;
+            std::vector<SR_UTILS_NS::RaycastHit> m_hits;
+
+        };
+
+        /// Collects the objects touched by the temporary object, every object is reported once.
+        class Bullet3OverlapCallback : public btCollisionWorld::ContactResultCallback {
+        public:
+            Bullet3OverlapCallback(const btCollisionObject* pSelf, const RaycastFilter& filter, uint32_t maxHits)
+                : m_filter(pSelf->getWorldTransform().getOrigin(), filter, false)
+                , m_self(pSelf)
+                , m_maxHits(maxHits)
+            { }
+
+            bool needsCollision(btBroadphaseProxy* pProxy) const override {
+                return m_objects.size() < m_maxHits && m_filter.IsPassed(pProxy);
+            }
+
+            btScalar addSingleResult(btManifoldPoint& point, const btCollisionObjectWrapper* pWrapper0, int32_t partId0, int32_t index0,
+                    const btCollisionObjectWrapper* pWrapper1, int32_t partId1, int32_t index1) override
+            {
+                /// the points inside of the contact threshold are reported too
+                if (point.getDistance() > 0.f || m_objects.size() >= m_maxHits) {
+                    return 0.f;
+                }
+
+                auto&& pOther = pWrapper0->getCollisionObject() == m_self ? pWrapper1->getCollisionObject() : pWrapper0->getCollisionObject();
+
+                if (std::find(m_objects.begin(), m_objects.end(), pOther) == m_objects.end()) {
+                    m_objects.emplace_back(pOther);
+                }
+
+                return 0.f;
+            }
+
+            SR_NODISCARD const std::vector<const btCollisionObject*>& GetObjects() const { return m_objects; }
+
+        private:
+            Bullet3QueryFilter m_filter;
+            const btCollisionObject* m_self = nullptr;
+            uint32_t m_maxHits = 1;
+            std::vector<const btCollisionObject*> m_objects;
+
+        };
+
+        void SortBullet3Hits(std::vector<SR_UTILS_NS::RaycastHit>& hits, uint32_t maxHits) {
+            auto&& compare = [](const SR_UTILS_NS::RaycastHit& a, const SR_UTILS_NS::RaycastHit& b) {
+                return a.distance < b.distance;
+            };
+
+            if (hits.size() > maxHits) {
+                std::partial_sort(hits.begin(), hits.begin() + maxHits, hits.end(), compare);
+                hits.resize(maxHits);
+            }
+            else {
+                std::sort(hits.begin(), hits.end(), compare);
+            }
+        }
+
+        std::vector<SR_UTILS_NS::RaycastHit> GetBullet3RayHits(const Bullet3RayCallback& callback, float_t distance) {
+            std::vector<SR_UTILS_NS::RaycastHit> hits;
+            hits.reserve(callback.m_collisionObjects.size());
+
+            for (int32_t i = 0; i < callback.m_collisionObjects.size(); ++i) {
+                auto&& hit = hits.emplace_back();
+                hit.pHandler = SR_PHYSICS_UTILS_NS::GetBtObjectRigidbody(callback.m_collisionObjects[i]);
+                hit.distance = callback.m_hitFractions[i] * distance;
+                hit.normal = SR_PHYSICS_UTILS_NS::BtV33ToFV(callback.m_hitNormalWorld[i].normalized());
+                hit.position = SR_PHYSICS_UTILS_NS::BtV33ToFV(callback.m_hitPointWorld[i]);
+            }
+
+            return hits;
+        }
+
+        std::unique_ptr<btConvexShape> MakeBullet3QueryShape(const SceneQueryGeometry& geometry) {
+            switch (geometry.shape) {
+                case SceneQueryShape::Capsule:
+                    /// Bullet capsules lie along the Y axis and take the full height of the cylindrical part
+                    return std::make_unique<btCapsuleShape>(geometry.radius, geometry.halfHeight * 2.f);
+                case SceneQueryShape::Box:
+                    return std::make_unique<btBoxShape>(SR_PHYSICS_UTILS_NS::FV3ToBtV3(geometry.halfExtents));
+                case SceneQueryShape::Sphere:
+                default:
+                    return std::make_unique<btSphereShape>(geometry.radius);
+            }
+        }
+
+        btTransform MakeBullet3QueryPose(const SceneQueryGeometry& geometry, const SR_MATH_NS::FVector3& position) {
+            return btTransform(SR_PHYSICS_UTILS_NS::QuaternionToBtQ(geometry.rotation), SR_PHYSICS_UTILS_NS::FV3ToBtV3(position));
+        }
+
+        void StoreBullet3Hits(const std::vector<SR_UTILS_NS::RaycastHit>& hits, SceneQueryBatch3D& batch, uint32_t index) {
+            auto&& pHits = batch.GetHitsBuffer(index);
+            const auto count = static_cast<uint32_t>(SR_MIN(hits.size(), static_cast<size_t>(batch.GetMaxHitsPerQuery())));
+
+            for (uint32_t i = 0; i < count; ++i) {
+                pHits[i] = hits[i];
+            }
+
+            batch.SetHitsCount(index, count);
+        }
+    }
+
+    btDiscreteDynamicsWorld* Bullet3Raycast3DImpl::GetBtWorld() const {
+        auto&& pWorld = static_cast<Bullet3PhysicsWorld*>(m_world);
+        return pWorld ? pWorld->GetBtWorld() : nullptr;
+    }
+
+    Bullet3Raycast3DImpl::RaycastHits Bullet3Raycast3DImpl::Cast(const SR_MATH_NS::FVector3 &origin, const SR_MATH_NS::FVector3 &direction, float_t maxDistance, uint32_t maxHits, const RaycastFilter& filter) {
+        SR_TRACY_ZONE;
+
+        auto&& pBtWorld = GetBtWorld();
+
+        btVector3 unitDirection = SR_PHYSICS_UTILS_NS::FV3ToBtV3(direction);
+        if (!pBtWorld || unitDirection.fuzzyZero() || maxDistance <= 0.f) {
+            return RaycastHits();
+        }
+
+        unitDirection.normalize();
+
+        const btVector3 from = SR_PHYSICS_UTILS_NS::FV3ToBtV3(origin);
+        const btVector3 to = from + unitDirection * maxDistance;
+
+        Bullet3RayCallback callback(from, to, filter);
+        pBtWorld->rayTest(from, to, callback);
+
+        auto&& hits = GetBullet3RayHits(callback, maxDistance);
+        SortBullet3Hits(hits, maxHits);
+
+        return hits;
+    }
+
+    bool Bullet3Raycast3DImpl::CastAny(const SR_MATH_NS::FVector3 &origin, const SR_MATH_NS::FVector3 &direction, float_t maxDistance, const RaycastFilter& filter) {
+        SR_TRACY_ZONE;
+
+        auto&& pBtWorld = GetBtWorld();
+
+        btVector3 unitDirection = SR_PHYSICS_UTILS_NS::FV3ToBtV3(direction);
+        if (!pBtWorld || unitDirection.fuzzyZero() || maxDistance <= 0.f) {
+            return false;
+        }
+
+        unitDirection.normalize();
+
+        const btVector3 from = SR_PHYSICS_UTILS_NS::FV3ToBtV3(origin);
+
+        Bullet3AnyRayCallback callback(from, filter);
+        pBtWorld->rayTest(from, from + unitDirection * maxDistance, callback);
+
+        return callback.hasHit();
+    }
+
+    bool Bullet3Raycast3DImpl::Execute(SceneQueryBatch3D& batch, const SceneQueryParallelFor& parallelFor) {
+        SR_TRACY_ZONE;
+
+        auto&& pBtWorld = GetBtWorld();
+        if (!pBtWorld) {
+            return false;
+        }
+
+        const uint32_t maxHits = batch.GetMaxHitsPerQuery();
+
+        /// the queries only read the world, the collision algorithms of the overlaps are allocated out of the locked pools
+        parallelFor(batch.GetQueriesCount(), 16, [&](uint32_t begin, uint32_t end) {
+            for (uint32_t index = begin; index < end; ++index) {
+                auto&& query = batch.GetQuery(index);
+
+                if (query.type == SceneQueryType::Overlap) {
+                    auto&& pShape = MakeBullet3QueryShape(query.geometry);
+
+                    btCollisionObject object;
+                    object.setCollisionShape(pShape.get());
+                    object.setWorldTransform(MakeBullet3QueryPose(query.geometry, query.origin));
+
+                    Bullet3OverlapCallback callback(&object, query.filter, maxHits);
+                    pBtWorld->contactTest(&object, callback);
+
+                    std::vector<SR_UTILS_NS::RaycastHit> hits;
+                    hits.reserve(callback.GetObjects().size());
+
+                    for (auto&& pObject : callback.GetObjects()) {
+                        auto&& hit = hits.emplace_back();
+                        hit.pHandler = SR_PHYSICS_UTILS_NS::GetBtObjectRigidbody(pObject);
+                        hit.distance = 0.f;
+                        hit.position = SR_PHYSICS_UTILS_NS::BtV33ToFV(pObject->getWorldTransform().getOrigin());
+                    }
+
+                    StoreBullet3Hits(hits, batch, index);
+                    continue;
+                }
+
+                btVector3 unitDirection = SR_PHYSICS_UTILS_NS::FV3ToBtV3(query.direction);
+                if (unitDirection.fuzzyZero() || query.maxDistance <= 0.f) {
+                    continue;
+                }
+
+                unitDirection.normalize();
+
+                const btVector3 from = SR_PHYSICS_UTILS_NS::FV3ToBtV3(query.origin);
+                const btVector3 offset = unitDirection * query.maxDistance;
+
+                if (query.type == SceneQueryType::Raycast) {
+                    Bullet3RayCallback callback(from, from + offset, query.filter);
+                    pBtWorld->rayTest(from, from + offset, callback);
+
+                    auto&& hits = GetBullet3RayHits(callback, query.maxDistance);
+                    SortBullet3Hits(hits, maxHits);
+                    StoreBullet3Hits(hits, batch, index);
+                }
+                else {
+                    auto&& pShape = MakeBullet3QueryShape(query.geometry);
+
+                    btTransform fromPose = MakeBullet3QueryPose(query.geometry, query.origin);
+                    btTransform toPose = fromPose;
+                    toPose.setOrigin(from + offset);
+
+                    Bullet3SweepCallback callback(from, query.maxDistance, query.filter);
+                    pBtWorld->convexSweepTest(pShape.get(), fromPose, toPose, callback);
+
+                    auto&& hits = callback.GetHits();
+                    SortBullet3Hits(hits, maxHits);
+                    StoreBullet3Hits(hits, batch, index);
+                }
+            }
+        });
+
+        return true;
+    }
+}
@@ -3,118 +3,366 @@
 //
 
 #include <Physics/Bullet3/Bullet3Rigidbody3D.h>
-#include <Physics/Bullet3/Bullet3PhysicsLib.h>
+#include <Physics/Bullet3/Bullet3PhysicsWorld.h>
 
 namespace SR_PTYPES_NS {
-    Bullet3Rigidbody3D::Bullet3Rigidbody3D(Rigidbody::LibraryPtr pLibrary)
-        : Super(pLibrary)
-    { }
+    namespace {
+        /// Bullet synchronizes the motion states of the active bodies only, the moved ones are collected by it.
+        class Bullet3MotionState final : public btMotionState {
+        public:
+            explicit Bullet3MotionState(Bullet3Rigidbody3DImpl* pImpl)
+                : m_impl(pImpl)
+            {
+                m_transform.setIdentity();
+            }
 
-    Bullet3Rigidbody3D::~Bullet3Rigidbody3D() {
+        public:
+            void getWorldTransform(btTransform& transform) const override {
+                transform = m_transform;
+            }
+
+            /// Called by the step for the active bodies only.
+            void setWorldTransform(const btTransform& transform) override {
+                m_transform = transform;
+                m_impl->OnMoved();
+            }
+
+            /// The transform moved by the engine is already synchronized, it is not a move of the simulation.
+            void SetTransform(const btTransform& transform) {
+                m_transform = transform;
+            }
+
+        private:
+            Bullet3Rigidbody3DImpl* m_impl = nullptr;
+            btTransform m_transform;
+
+        };
+    }
+
+    Bullet3Rigidbody3DImpl::~Bullet3Rigidbody3DImpl() {
+        ReleaseObject();
+    }
+
+    void Bullet3Rigidbody3DImpl::ReleaseObject() {
+        if (m_object && m_world && m_world->GetBtWorld()) {
+            m_world->GetBtWorld()->removeCollisionObject(m_object);
+        }
+
+        SR_SAFE_DELETE_PTR(m_object);
         SR_SAFE_DELETE_PTR(m_motionState);
-        SR_SAFE_DELETE_PTR(m_rigidbody);
     }
 
-    void Bullet3Rigidbody3D::UpdateInertia() {
-        if (m_rigidbody) {
-            auto&& inertia = m_shape ? m_shape->CalculateLocalInertia(m_mass) : SR_MATH_NS::FVector3(0, 0, 0);
-            m_rigidbody->setMassProps(m_mass, SR_PHYSICS_UTILS_NS::FV3ToBtV3(inertia));
+    void Bullet3Rigidbody3DImpl::OnMoved() {
+        if (m_world) {
+            m_world->MarkMoved(m_rigidbody);
+        }
+    }
+
+    void Bullet3Rigidbody3DImpl::UpdateInertia() {
+        auto&& pBody = GetBtRigidBody();
+        if (!pBody || m_rigidbody->IsStatic()) {
+            return;
         }
+
+        auto&& pShape = m_rigidbody->GetCollisionShape();
+        const float_t mass = SR_MAX(m_rigidbody->GetMass(), 0.0001f);
+        auto&& inertia = pShape ? pShape->CalculateLocalInertia(mass) : SR_MATH_NS::FVector3(0, 0, 0);
+
+        pBody->setMassProps(mass, SR_PHYSICS_UTILS_NS::FV3ToBtV3(inertia));
+        pBody->updateInertiaTensor();
     }
 
-    bool Bullet3Rigidbody3D::InitBody() {
+    bool Bullet3Rigidbody3DImpl::InitBody() {
         if (!Super::InitBody()) {
-            SR_ERROR("Bullet3Rigidbody3D::InitBody() : failed to init base body!");
+            SRHalt("failed to init base body!");
             return false;
         }
 
-        SR_SAFE_DELETE_PTR(m_motionState);
-        SR_SAFE_DELETE_PTR(m_rigidbody);
+        m_rigidbodyTranslation = m_rigidbody->GetTranslation();
+        m_rigidbodyRotation = m_rigidbody->GetRotation();
+
+        ReleaseObject();
+
+        /// the shape is set by UpdateShapeInternal(), the objects can't be created without one
+        static btEmptyShape emptyShape;
+
+        if (m_rigidbody->IsTrigger()) {
+            auto&& pGhost = new btGhostObject();
+            pGhost->setCollisionShape(&emptyShape);
+            /// the overlaps are found by the narrowphase, a sleeping ghost would stop to report them
+            pGhost->setActivationState(DISABLE_DEACTIVATION);
+
+            int32_t flags = pGhost->getCollisionFlags() | btCollisionObject::CF_NO_CONTACT_RESPONSE;
 
-        btTransform startTransform;
-        startTransform.setIdentity();
+            if (m_rigidbody->IsStatic()) {
+                flags |= btCollisionObject::CF_STATIC_OBJECT;
+            }
 
-        m_motionState = new btDefaultMotionState(startTransform);
+            pGhost->setCollisionFlags(flags);
 
-        btRigidBody::btRigidBodyConstructionInfo rigidBodyCI(
-                m_mass,        /// mass, in kg. 0 -> Static object, will never move.
+            m_object = pGhost;
+        }
+        else {
+            m_motionState = new Bullet3MotionState(this);
+
+            btRigidBody::btRigidBodyConstructionInfo rigidBodyCI(
+                0.f, /// static until UpdateInertia()
                 m_motionState,
-                (btCollisionShape*)m_shape->GetHandle(), /// collision shape of body
-                btVector3()   /// local inertia
-        );
-        m_rigidbody = new btRigidBody(rigidBodyCI);
+                &emptyShape,
+                btVector3(0, 0, 0)
+            );
 
-        m_rigidbody->setActivationState(DISABLE_DEACTIVATION);
+            auto&& pBody = new btRigidBody(rigidBodyCI);
+
+            /// the bodies fall asleep the same as in PhysX, the sleeping ones are not synchronized
+            pBody->setSleepingThresholds(0.05f, 0.05f);
+
+            m_object = pBody;
+        }
 
-        m_rigidbody->setUserPointer(this);
+        m_object->setUserPointer((void*)m_rigidbody);
+
+        UpdateLocks();
+
+        m_rigidbody->UpdateMatrix(true);
+        m_rigidbody->SetShapeDirty(true);
+
+        if (m_rigidbody->UpdateShape() != RBUpdShapeRes::Updated) {
+            SR_ERROR("Bullet3Rigidbody3D::InitBody() : shape is not updated!");
+            return false;
+        }
+
+        UpdateInertia();
 
         return true;
     }
 
-    void Bullet3Rigidbody3D::AddLinearVelocity(const SR_MATH_NS::FVector3& velocity) {
-        if (m_rigidbody) {
-            m_rigidbody->setLinearVelocity(m_rigidbody->getLinearVelocity() + SR_PHYSICS_UTILS_NS::FV3ToBtV3(velocity));
+    void Bullet3Rigidbody3DImpl::ClearForces() {
+        if (auto&& pBody = GetBtRigidBody()) {
+            pBody->clearForces();
+            pBody->setLinearVelocity(btVector3(0, 0, 0));
+            pBody->setAngularVelocity(btVector3(0, 0, 0));
         }
-        else {
-            SRHalt("m_rigidbody is nullptr!");
+
+        Super::ClearForces();
+    }
+
+    void Bullet3Rigidbody3DImpl::AddLinearVelocity(const SR_MATH_NS::FVector3& velocity) {
+        if (auto&& pBody = GetBtRigidBody()) {
+            pBody->setLinearVelocity(pBody->getLinearVelocity() + SR_PHYSICS_UTILS_NS::FV3ToBtV3(velocity));
+            pBody->activate();
         }
     }
 
-    void Bullet3Rigidbody3D::AddAngularVelocity(const SR_MATH_NS::FVector3& velocity) {
-        if (m_rigidbody) {
-            m_rigidbody->setLinearVelocity(m_rigidbody->getLinearVelocity() + SR_PHYSICS_UTILS_NS::FV3ToBtV3(velocity));
+    void Bullet3Rigidbody3DImpl::AddAngularVelocity(const SR_MATH_NS::FVector3& velocity) {
+        if (auto&& pBody = GetBtRigidBody()) {
+            pBody->setAngularVelocity(pBody->getAngularVelocity() + SR_PHYSICS_UTILS_NS::FV3ToBtV3(velocity));
+            pBody->activate();
         }
-        else {
-            SRHalt("m_rigidbody is nullptr!");
+    }
+
+    void Bullet3Rigidbody3DImpl::SetLinearVelocity(const SR_MATH_NS::FVector3& velocity) {
+        if (auto&& pBody = GetBtRigidBody()) {
+            pBody->setLinearVelocity(SR_PHYSICS_UTILS_NS::FV3ToBtV3(velocity));
+            pBody->activate();
         }
     }
 
-    //void Bullet3Rigidbody3D::SetVelocity(const SR_MATH_NS::FVector3& velocity) {
-    //    if (m_rigidbody) {
-    //        m_rigidbody->setLinearVelocity(SR_PHYSICS_UTILS_NS::FV3ToBtV3(velocity));
-    //    }
-    //    else {
-    //        SRHalt("m_rigidbody is nullptr!");
-    //    }
-    //}
+    void Bullet3Rigidbody3DImpl::SetAngularVelocity(const SR_MATH_NS::FVector3& velocity) {
+        if (auto&& pBody = GetBtRigidBody()) {
+            pBody->setAngularVelocity(SR_PHYSICS_UTILS_NS::FV3ToBtV3(velocity));
+            pBody->activate();
+        }
+    }
 
-    bool Bullet3Rigidbody3D::UpdateMatrix(bool force) {
-        if (!Super::UpdateMatrix(force)) {
-            return false;
+    SR_MATH_NS::FVector3 Bullet3Rigidbody3DImpl::GetLinearVelocity() const {
+        if (auto&& pBody = GetBtRigidBody()) {
+            return SR_PHYSICS_UTILS_NS::BtV33ToFV(pBody->getLinearVelocity());
         }
 
-        auto&& translation = m_translation + GetCenterDirection();
+        return SR_MATH_NS::FVector3();
+    }
 
-        btTransform startTransform;
-        startTransform.setIdentity();
-        startTransform.setOrigin(btVector3(translation.x, translation.y, translation.z));
-        startTransform.setRotation(btQuaternion(m_rotation.X(), m_rotation.Y(), m_rotation.Z(), m_rotation.W()));
+    SR_MATH_NS::FVector3 Bullet3Rigidbody3DImpl::GetAngularVelocity() const {
+        if (auto&& pBody = GetBtRigidBody()) {
+            return SR_PHYSICS_UTILS_NS::BtV33ToFV(pBody->getAngularVelocity());
+        }
 
-        m_rigidbody->setWorldTransform(startTransform);
+        return SR_MATH_NS::FVector3();
+    }
 
-        if (m_rigidbody->getMotionState()) {
-            m_rigidbody->getMotionState()->setWorldTransform(startTransform);
+    bool Bullet3Rigidbody3DImpl::UpdateMatrix(bool force) {
+        if (!Super::UpdateMatrix(force) || !m_object) {
+            return false;
         }
 
-        m_rigidbody->clearForces();
-        m_rigidbody->setAngularVelocity(btVector3(0, 0, 0));
-        m_rigidbody->setLinearVelocity(btVector3(0, 0, 0));
+        auto&& translation = m_rigidbody->GetTranslation() + m_rigidbody->GetCenterDirection();
+
+        btTransform transform;
+        transform.setOrigin(SR_PHYSICS_UTILS_NS::FV3ToBtV3(translation));
+        transform.setRotation(SR_PHYSICS_UTILS_NS::QuaternionToBtQ(m_rigidbody->GetRotation()));
+
+        m_object->setWorldTransform(transform);
+
+        if (auto&& pBody = GetBtRigidBody()) {
+            /// the next step starts from the teleported pose, not from the interpolated one
+            pBody->setInterpolationWorldTransform(transform);
+
+            if (m_motionState) {
+                static_cast<Bullet3MotionState*>(m_motionState)->SetTransform(transform);
+            }
+
+            if (!m_rigidbody->IsStatic()) {
+                pBody->activate();
+            }
+        }
 
         return true;
     }
 
-    bool Bullet3Rigidbody3D::UpdateShapeInternal() {
-        if (!m_rigidbody) {
-            SR_ERROR("Bullet3Rigidbody3D::UpdateShapeInternal() : rigidbody is nullptr!");
+    void Bullet3Rigidbody3DImpl::ShiftOrigin(const SR_MATH_NS::FVector3& shift) {
+        if (!m_object) {
+            return;
+        }
+
+        const btVector3 offset = SR_PHYSICS_UTILS_NS::FV3ToBtV3(shift);
+
+        m_object->getWorldTransform().getOrigin() += offset;
+
+        if (auto&& pBody = GetBtRigidBody()) {
+            /// the bodies keep their velocities and do not wake up, it is not a teleport
+            btTransform interpolationTransform = pBody->getInterpolationWorldTransform();
+            interpolationTransform.getOrigin() += offset;
+            pBody->setInterpolationWorldTransform(interpolationTransform);
+
+            if (m_motionState) {
+                btTransform transform;
+                m_motionState->getWorldTransform(transform);
+                transform.getOrigin() += offset;
+                static_cast<Bullet3MotionState*>(m_motionState)->SetTransform(transform);
+            }
+        }
+    }
+
+    bool Bullet3Rigidbody3DImpl::UpdateShapeInternal() {
+        if (!m_object) {
+            SRHalt("m_object is nullptr!");
+            return false;
+        }
+
+        auto&& pShape = static_cast<btCollisionShape*>(m_rigidbody->GetCollisionShape()->GetHandle());
+        if (!pShape) {
+            SRHalt("Internal shape is nullptr!");
             return false;
         }
 
-        m_rigidbody->setCollisionShape(static_cast<btCollisionShape*>(m_shape->GetHandle()));
+        /// the broadphase proxy keeps the bounds of the previous shape, the world recomputes them with the next step
+        m_object->setCollisionShape(pShape);
+
+        UpdateInertia();
 
         return true;
     }
 
-    void* Bullet3Rigidbody3D::GetHandle() const noexcept {
-        return (void*)m_rigidbody;
+    void Bullet3Rigidbody3DImpl::SetLinearLock(const SR_MATH_NS::BVector3& lock) {
+        Super::SetLinearLock(lock);
+        UpdateLocks();
+    }
+
+    void Bullet3Rigidbody3DImpl::SetAngularLock(const SR_MATH_NS::BVector3& lock) {
+        Super::SetAngularLock(lock);
+        UpdateLocks();
+    }
+
+    void Bullet3Rigidbody3DImpl::UpdateLocks() {
+        auto&& pBody = GetBtRigidBody();
+        if (!pBody) {
+            return;
+        }
+
+        auto&& linearLock = GetRigidbody<Rigidbody3D>()->GetLinearLock();
+        auto&& angularLock = GetRigidbody<Rigidbody3D>()->GetAngularLock();
+
+        pBody->setLinearFactor(btVector3(linearLock.X() ? 0.f : 1.f, linearLock.Y() ? 0.f : 1.f, linearLock.Z() ? 0.f : 1.f));
+        pBody->setAngularFactor(btVector3(angularLock.X() ? 0.f : 1.f, angularLock.Y() ? 0.f : 1.f, angularLock.Z() ? 0.f : 1.f));
+    }
+
+    void Bullet3Rigidbody3DImpl::Synchronize(bool interpolate) {
+        if (!m_object || !m_rigidbody->GetTransform()) {
+            return;
+        }
+
+        if (!interpolate) {
+            ResetInterpolation();
+            ApplyGlobalPose();
+            Super::Synchronize(interpolate);
+            return;
+        }
+
+        if (!m_isInterpolated) {
+            ApplyGlobalPose();
+            PushInterpolationState(m_rigidbody->GetTranslation(), m_rigidbody->GetRotation());
+        }
+        else if (m_rigidbody->IsMatrixDirty()) {
+            /// the transform was moved outside of the simulation, teleport the body without interpolation
+            m_rigidbody->UpdateMatrix(true);
+
+            ResetInterpolation();
+            PushInterpolationState(m_rigidbody->GetTranslation(), m_rigidbody->GetRotation());
+        }
+        else {
+            SR_MATH_NS::FVector3 translation;
+            SR_MATH_NS::Quaternion rotation;
+            GetGlobalPose(translation, rotation);
+
+            if (GetRigidbody<Rigidbody3D>()->GetAngularLock() == SR_MATH_NS::BVector3(true)) {
+                rotation = m_currentRotation;
+            }
+
+            PushInterpolationState(translation - m_rigidbody->GetCenterDirection(), rotation);
+        }
+
+        Super::Synchronize(interpolate);
+    }
+
+    void Bullet3Rigidbody3DImpl::GetGlobalPose(SR_MATH_NS::FVector3& translation, SR_MATH_NS::Quaternion& rotation) const {
+        auto&& transform = m_object->getWorldTransform();
+
+        translation = SR_PHYSICS_UTILS_NS::BtV33ToFV(transform.getOrigin());
+        rotation = SR_PHYSICS_UTILS_NS::BtQToQuaternion(transform.getRotation());
+    }
+
+    void Bullet3Rigidbody3DImpl::ApplyGlobalPose() {
+        auto&& pTransform = m_rigidbody->GetTransform();
+
+        SR_MATH_NS::FVector3 rigidbodyTranslation;
+        SR_MATH_NS::Quaternion rigidbodyRotation;
+        GetGlobalPose(rigidbodyTranslation, rigidbodyRotation);
+
+        SR_MATH_NS::FVector3 deltaTranslation(SR_MATH_NS::Unit(0));
+        SR_MATH_NS::Quaternion deltaQuaternion(SR_MATH_NS::Quaternion::Identity());
+
+        if (m_rigidbodyTranslation.IsFinite()) {
+            deltaTranslation = (rigidbodyTranslation - m_rigidbody->GetCenterDirection()) - m_rigidbodyTranslation;
+        }
+
+        if (!deltaTranslation.IsEquals(SR_MATH_NS::FVector3(SR_MATH_NS::Unit(0)), SR_MATH_NS::Unit(0.001))) {
+            pTransform->GlobalTranslate(deltaTranslation);
+        }
+
+        if (GetRigidbody<Rigidbody3D>()->GetAngularLock() != SR_MATH_NS::BVector3(true)) {
+            if (m_rigidbodyRotation.IsFinite()) {
+                deltaQuaternion = rigidbodyRotation * m_rigidbodyRotation.Inverse();
+            }
+
+            if (!deltaQuaternion.IsEquals(SR_MATH_NS::FVector3(SR_MATH_NS::Unit(0)), SR_MATH_NS::Unit(0.0001))) {
+                pTransform->SetRotation(rigidbodyRotation);
+            }
+        }
+
+        m_rigidbody->UpdateMatrix(true);
+
+        m_rigidbodyTranslation = m_rigidbody->GetTranslation();
+        m_rigidbodyRotation = m_rigidbody->GetRotation();
     }
-}
\ No newline at end of file
+}
@@ -0,0 +1,130 @@
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <Physics/Bullet3/Bullet3TaskScheduler.h>
+
+namespace SR_PHYSICS_NS {
+    /// Shared with the jobs, which may start after the loop is finished.
+    struct Bullet3TaskScheduler::Loop {
+        const btIParallelForBody* pForBody = nullptr;
+        const btIParallelSumBody* pSumBody = nullptr;
+
+        int begin = 0;
+        int end = 0;
+        int grainSize = 1;
+        int ranges = 0;
+
+        std::atomic<int> nextRange = 0;
+        std::atomic<int> doneRanges = 0;
+
+        std::mutex mutex;
+        std::condition_variable condition;
+        btScalar sum = btScalar(0);
+    };
+
+    Bullet3TaskScheduler::Bullet3TaskScheduler(PhysicsLibrary::JobScheduler scheduler, uint32_t workers)
+        : btITaskScheduler("SREngineJobSystem")
+        , m_scheduler(std::move(scheduler))
+        , m_workers(SR_MAX(workers, 1u))
+    {
+        m_threads = getMaxNumThreads();
+    }
+
+    void Bullet3TaskScheduler::setNumThreads(int numThreads) {
+        m_threads = SR_MAX(1, SR_MIN(numThreads, getMaxNumThreads()));
+    }
+
+    void Bullet3TaskScheduler::parallelFor(int iBegin, int iEnd, int grainSize, const btIParallelForBody& body) {
+        btScalar sum = btScalar(0);
+        Run(iBegin, iEnd, grainSize, &body, nullptr, sum);
+    }
+
+    btScalar Bullet3TaskScheduler::parallelSum(int iBegin, int iEnd, int grainSize, const btIParallelSumBody& body) {
+        btScalar sum = btScalar(0);
+        Run(iBegin, iEnd, grainSize, nullptr, &body, sum);
+        return sum;
+    }
+
+    void Bullet3TaskScheduler::Run(int iBegin, int iEnd, int grainSize, const btIParallelForBody* pForBody, const btIParallelSumBody* pSumBody, btScalar& sum) {
+        SR_TRACY_ZONE;
+
+        if (iEnd <= iBegin) {
+            return;
+        }
+
+        grainSize = SR_MAX(grainSize, 1);
+
+        const int ranges = (iEnd - iBegin + grainSize - 1) / grainSize;
+
+        /// a single range is not worth a job
+        if (ranges == 1 || m_threads == 1) {
+            if (pForBody) {
+                pForBody->forLoop(iBegin, iEnd);
+            }
+            else {
+                sum = pSumBody->sumLoop(iBegin, iEnd);
+            }
+            return;
+        }
+
+        auto&& pLoop = std::make_shared<Loop>();
+        pLoop->pForBody = pForBody;
+        pLoop->pSumBody = pSumBody;
+        pLoop->begin = iBegin;
+        pLoop->end = iEnd;
+        pLoop->grainSize = grainSize;
+        pLoop->ranges = ranges;
+
+        const int jobs = SR_MIN(ranges, m_threads) - 1;
+
+        for (int i = 0; i < jobs; ++i) {
+            m_scheduler([pLoop]() {
+                SR_TRACY_ZONE_N("Bullet3 task");
+                RunRanges(*pLoop);
+            });
+        }
+
+        RunRanges(*pLoop);
+
+        {
+            std::unique_lock<std::mutex> lock(pLoop->mutex);
+            pLoop->condition.wait(lock, [&pLoop]() {
+                return pLoop->doneRanges.load() == pLoop->ranges;
+            });
+
+            sum = pLoop->sum;
+        }
+    }
+
+    void Bullet3TaskScheduler::RunRanges(Loop& loop) {
+        btScalar sum = btScalar(0);
+        int done = 0;
+
+        for (int range = loop.nextRange++; range < loop.ranges; range = loop.nextRange++) {
+            const int begin = loop.begin + range * loop.grainSize;
+            const int end = SR_MIN(begin + loop.grainSize, loop.end);
+
+            if (loop.pForBody) {
+                loop.pForBody->forLoop(begin, end);
+            }
+            else {
+                sum += loop.pSumBody->sumLoop(begin, end);
+            }
+
+            ++done;
+        }
+
+        if (done == 0) {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(loop.mutex);
+
+        loop.sum += sum;
+
+        if ((loop.doneRanges += done) == loop.ranges) {
+            loop.condition.notify_all();
+        }
+    }
+}
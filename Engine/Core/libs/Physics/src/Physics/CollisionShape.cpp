@@ -168,6 +168,28 @@ namespace SR_PTYPES_NS {
                     .SetResetValue(1.f)
                     .SetDrag(0.1f);
                 break;
+            case ShapeType::Box2D:
+                m_properties.AddCustomProperty<SR_UTILS_NS::StandardProperty>("Box2D size")
+                    .SetGetter([this](void* pValue) { *reinterpret_cast<SR_MATH_NS::FVector2*>(pValue) = SR_MATH_NS::FVector2(GetSize().x, GetSize().y); })
+                    .SetSetter([this](void* pValue) {
+                        auto&& size = *reinterpret_cast<SR_MATH_NS::FVector2*>(pValue);
+                        SetSize(SR_MATH_NS::FVector3(size.x, size.y, 1.f));
+                    })
+                    .SetType(SR_UTILS_NS::StandardType::FVector2)
+                    .SetResetValue(1.f)
+                    .SetDrag(0.1f);
+                break;
+            case ShapeType::Edge2D:
+                /// the edge lies on the X axis of the rigidbody, from -length to length
+                m_properties.AddCustomProperty<SR_UTILS_NS::StandardProperty>("Edge2D length")
+                    .SetGetter([this](void* pValue) { *reinterpret_cast<float_t*>(pValue) = GetBounds().x; })
+                    .SetSetter([this](void* pValue) {
+                        SetBounds(SR_MATH_NS::FVector3(*reinterpret_cast<float_t*>(pValue), 0.f, 0.f));
+                    })
+                    .SetType(SR_UTILS_NS::StandardType::Float)
+                    .SetResetValue(1.f)
+                    .SetDrag(0.1f);
+                break;
             case ShapeType::Box3D:
                 m_properties.AddCustomProperty<SR_UTILS_NS::StandardProperty>("Box3D size")
                     .SetGetter([this](void* pValue) { *reinterpret_cast<SR_MATH_NS::FVector3*>(pValue) = GetSize(); })
@@ -186,6 +208,7 @@ namespace SR_PTYPES_NS {
                     .SetResetValue(1.f)
                     .SetDrag(0.1f);
                 SR_FALLTHROUGH;
+            case ShapeType::Circle2D:
             case ShapeType::Sphere3D:
                 m_properties.AddCustomProperty<SR_UTILS_NS::StandardProperty>("Radius")
                     .SetGetter([this](void* pValue) { *reinterpret_cast<float_t*>(pValue) = GetRadius(); })
@@ -196,6 +219,7 @@ namespace SR_PTYPES_NS {
                     .SetResetValue(1.f)
                     .SetDrag(0.1f);
                 break;
+            case ShapeType::TriangleMesh2D:
             case ShapeType::Convex3D:
                 m_properties.AddCustomProperty<SR_UTILS_NS::PathProperty>("Mesh path")
                     .SetGetter([this]() { return GetRigidbody()->GetRawMesh() ? GetRigidbody()->GetRawMesh()->GetResourcePath() : SR_UTILS_NS::Path(); })
@@ -0,0 +1,172 @@
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <Physics/PhysX/PhysXCharacterController3D.h>
+#include <Physics/PhysX/PhysXPhysicsWorld.h>
+#include <Physics/PhysX/PhysXLibraryImpl.h>
+#include <Physics/Rigidbody.h>
+
+#include <Utils/ECS/Transform.h>
+#include <Utils/ECS/GameObject.h>
+
+namespace SR_PTYPES_NS {
+    PhysXCharacterController3DImpl::PhysXCharacterController3DImpl(LibraryPtr pLibrary)
+        : Super(pLibrary)
+    { }
+
+    PhysXCharacterController3DImpl::~PhysXCharacterController3DImpl() {
+        DeInit();
+    }
+
+    bool PhysXCharacterController3DImpl::Init(PhysicsWorldPtr pWorld) {
+        auto&& pPhysXWorld = dynamic_cast<SR_PHYSICS_NS::PhysXPhysicsWorld*>(pWorld);
+        if (!pPhysXWorld || !pPhysXWorld->GetControllerManager()) {
+            SRHalt("PhysXCharacterController3DImpl::Init() : the world is not a PhysX one!");
+            return false;
+        }
+
+        DeInit();
+
+        auto&& pLibrary = dynamic_cast<SR_PHYSICS_NS::PhysXLibraryImpl*>(m_library);
+        if (!pLibrary) {
+            SRHalt("PhysXCharacterController3DImpl::Init() : failed to cast library!");
+            return false;
+        }
+
+        physx::PxCapsuleControllerDesc desc;
+
+        desc.radius = m_controller->GetRadius();
+        desc.height = m_controller->GetHeight();
+        desc.slopeLimit = std::cos(m_controller->GetSlopeLimitRadians());
+        desc.stepOffset = m_controller->GetStepOffset();
+        desc.upDirection = physx::PxVec3(0.f, 1.f, 0.f);
+        desc.climbingMode = physx::PxCapsuleClimbingMode::eCONSTRAINED;
+        desc.nonWalkableMode = physx::PxControllerNonWalkableMode::ePREVENT_CLIMBING_AND_FORCE_SLIDING;
+        desc.material = pLibrary->GetShapeCache()->GetDefaultMaterial();
+        desc.reportCallback = this;
+        desc.behaviorCallback = this;
+        desc.userData = this;
+
+        if (auto&& pTransform = m_controller->GetTransform()) {
+            auto&& translation = pTransform->GetMatrix().GetTranslate();
+            desc.position = physx::PxExtendedVec3(translation.x, translation.y + desc.contactOffset + desc.radius + desc.height * 0.5f, translation.z);
+        }
+
+        if (!desc.isValid()) {
+            SR_ERROR("PhysXCharacterController3DImpl::Init() : invalid controller description!");
+            return false;
+        }
+
+        auto&& pController = pPhysXWorld->GetControllerManager()->createController(desc);
+        if (!pController) {
+            SR_ERROR("PhysXCharacterController3DImpl::Init() : failed to create controller!");
+            return false;
+        }
+
+        m_pxController = static_cast<physx::PxCapsuleController*>(pController);
+        m_world = pWorld;
+        m_isGrounded = false;
+
+        return true;
+    }
+
+    void PhysXCharacterController3DImpl::DeInit() {
+        if (m_pxController) {
+            m_pxController->release();
+            m_pxController = nullptr;
+        }
+
+        m_world = nullptr;
+        m_isGrounded = false;
+    }
+
+    void PhysXCharacterController3DImpl::Move(const SR_MATH_NS::FVector3& displacement, float_t step) {
+        if (!m_pxController) {
+            return;
+        }
+
+        if (auto&& pGameObject = m_controller->GetGameObject()) {
+            m_collisionMask = SR_PHYSICS_NS::PhysicsLibrary::Instance().GetCollisionMask(pGameObject->GetLayer());
+        }
+
+        physx::PxControllerFilters filters(nullptr, this, nullptr);
+        filters.mFilterFlags = physx::PxQueryFlag::eSTATIC | physx::PxQueryFlag::eDYNAMIC | physx::PxQueryFlag::ePREFILTER;
+
+        const physx::PxControllerCollisionFlags flags = m_pxController->move(SR_PHYSICS_UTILS_NS::FV3ToPxV3(displacement), 0.0001f, step, filters);
+
+        m_isGrounded = flags & physx::PxControllerCollisionFlag::eCOLLISION_DOWN;
+    }
+
+    void PhysXCharacterController3DImpl::SetFootPosition(const SR_MATH_NS::FVector3& position) {
+        if (m_pxController) {
+            m_pxController->setFootPosition(physx::PxExtendedVec3(position.x, position.y, position.z));
+        }
+    }
+
+    SR_MATH_NS::FVector3 PhysXCharacterController3DImpl::GetFootPosition() const {
+        if (!m_pxController) {
+            return SR_MATH_NS::FVector3(SR_MATH_NS::Unit(0));
+        }
+
+        const physx::PxExtendedVec3 position = m_pxController->getFootPosition();
+
+        return SR_MATH_NS::FVector3(position.x, position.y, position.z);
+    }
+
+    void PhysXCharacterController3DImpl::UpdateShape() {
+        if (!m_pxController) {
+            return;
+        }
+
+        m_pxController->setRadius(m_controller->GetRadius());
+        /// keeps the foot position, unlike setHeight()
+        m_pxController->resize(m_controller->GetHeight());
+        m_pxController->setSlopeLimit(std::cos(m_controller->GetSlopeLimitRadians()));
+        m_pxController->setStepOffset(m_controller->GetStepOffset());
+    }
+
+    void PhysXCharacterController3DImpl::onShapeHit(const physx::PxControllerShapeHit& hit) {
+        auto&& pRigidbody = hit.actor ? static_cast<Rigidbody*>(hit.actor->userData) : nullptr;
+        m_controller->AddHit(pRigidbody, SR_MATH_NS::FVector3(hit.worldPos.x, hit.worldPos.y, hit.worldPos.z));
+    }
+
+    physx::PxControllerBehaviorFlags PhysXCharacterController3DImpl::getBehaviorFlags(const physx::PxShape& shape, const physx::PxActor& actor) {
+        /// the kinematic platforms carry the controller by the motion of their pose, the dynamic ones by this flag
+        if (m_controller->IsRideOnPlatforms()) {
+            return physx::PxControllerBehaviorFlag::eCCT_CAN_RIDE_ON_OBJECT;
+        }
+
+        return physx::PxControllerBehaviorFlags(0);
+    }
+
+    physx::PxControllerBehaviorFlags PhysXCharacterController3DImpl::getBehaviorFlags(const physx::PxController& controller) {
+        /// a crowd does not stand on the heads
+        return physx::PxControllerBehaviorFlag::eCCT_SLIDE;
+    }
+
+    physx::PxControllerBehaviorFlags PhysXCharacterController3DImpl::getBehaviorFlags(const physx::PxObstacle& obstacle) {
+        return physx::PxControllerBehaviorFlags(0);
+    }
+
+    physx::PxQueryHitType::Enum PhysXCharacterController3DImpl::preFilter(const physx::PxFilterData& filterData, const physx::PxShape* pShape,
+            const physx::PxRigidActor* pActor, physx::PxHitFlags& queryFlags)
+    {
+        if (pShape->getFlags() & physx::PxShapeFlag::eTRIGGER_SHAPE) {
+            return physx::PxQueryHitType::eNONE;
+        }
+
+        /// the same rule as in the filter shader, shapes without a layer are hit by everything
+        const physx::PxFilterData shapeData = pShape->getQueryFilterData();
+
+        if (shapeData.word0 != 0 && (shapeData.word0 & m_collisionMask) == 0) {
+            return physx::PxQueryHitType::eNONE;
+        }
+
+        return physx::PxQueryHitType::eBLOCK;
+    }
+
+    physx::PxQueryHitType::Enum PhysXCharacterController3DImpl::postFilter(const physx::PxFilterData& filterData, const physx::PxQueryHit& hit) {
+        return physx::PxQueryHitType::eBLOCK;
+    }
+}
@@ -0,0 +1,172 @@
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <Physics/PhysX/PhysXChunkAggregates.h>
+
+namespace SR_PHYSICS_NS {
+    PhysXChunkAggregates::PhysXChunkAggregates(physx::PxPhysics* pPhysics, physx::PxScene* pScene, const SR_MATH_NS::FVector3& chunkSize, uint32_t maxActors)
+        : m_physics(pPhysics)
+        , m_scene(pScene)
+        , m_chunkSize(chunkSize)
+        , m_maxActors(maxActors)
+    { }
+
+    PhysXChunkAggregates::~PhysXChunkAggregates() {
+        /// the actors are owned by the rigidbodies, a released aggregate would put them back to the scene
+        while (!m_keys.empty()) {
+            auto&& pAggregate = m_keys.begin()->first;
+
+            if (pAggregate->getScene()) {
+                m_scene->removeAggregate(*pAggregate);
+            }
+
+            Release(pAggregate);
+        }
+    }
+
+    void PhysXChunkAggregates::Add(physx::PxRigidActor* pActor) {
+        auto&& pAggregate = GetFreeAggregate(GetChunkKey(pActor->getGlobalPose().p));
+        if (!pAggregate) {
+            SR_WARN("PhysXChunkAggregates::Add() : failed to create an aggregate, the actor is added to the scene directly.");
+            m_scene->addActor(*pActor);
+            return;
+        }
+
+        /// an aggregate which is in the scene already adds the actor to it
+        if (!pAggregate->addActor(*pActor)) {
+            SR_ERROR("PhysXChunkAggregates::Add() : failed to add the actor to the aggregate!");
+            m_scene->addActor(*pActor);
+        }
+    }
+
+    void PhysXChunkAggregates::Commit() {
+        SR_TRACY_ZONE;
+
+        for (auto&& pAggregate : m_pending) {
+            if (!pAggregate->getScene()) {
+                m_scene->addAggregate(*pAggregate);
+            }
+        }
+
+        m_pending.clear();
+    }
+
+    void PhysXChunkAggregates::Remove(const std::vector<physx::PxRigidActor*>& actors) {
+        SR_TRACY_ZONE;
+
+        m_removed.clear();
+
+        for (auto&& pActor : actors) {
+            if (auto&& pAggregate = pActor->getAggregate()) {
+                ++m_removed[pAggregate];
+            }
+            else if (pActor->getScene() == m_scene) {
+                m_scene->removeActor(*pActor);
+            }
+        }
+
+        /// the whole chunk is unloaded, its actors leave the broadphase together
+        for (auto&& [pAggregate, count] : m_removed) {
+            if (count != pAggregate->getNbActors()) {
+                continue;
+            }
+
+            if (pAggregate->getScene()) {
+                m_scene->removeAggregate(*pAggregate);
+            }
+
+            Release(pAggregate);
+        }
+
+        for (auto&& pActor : actors) {
+            auto&& pAggregate = pActor->getAggregate();
+            if (!pAggregate) {
+                continue;
+            }
+
+            pAggregate->removeActor(*pActor);
+
+            /// an aggregate which is in the scene puts the removed actor back to the scene as a standalone one
+            if (pActor->getScene() == m_scene) {
+                m_scene->removeActor(*pActor);
+            }
+
+            if (pAggregate->getNbActors() > 0) {
+                continue;
+            }
+
+            if (pAggregate->getScene()) {
+                m_scene->removeAggregate(*pAggregate);
+            }
+
+            Release(pAggregate);
+        }
+
+        m_removed.clear();
+    }
+
+    uint64_t PhysXChunkAggregates::GetChunkKey(const physx::PxVec3& position) const {
+        constexpr uint64_t mask = (1ull << 21) - 1;
+
+        auto&& toChunk = [](float_t value, float_t size) -> uint64_t {
+            return static_cast<uint64_t>(static_cast<int64_t>(std::floor(value / size))) & mask;
+        };
+
+        const physx::PxVec3 unshifted = position + physx::PxVec3(m_origin.x, m_origin.y, m_origin.z);
+
+        return (toChunk(unshifted.x, m_chunkSize.x) << 42) | (toChunk(unshifted.y, m_chunkSize.y) << 21) | toChunk(unshifted.z, m_chunkSize.z);
+    }
+
+    physx::PxAggregate* PhysXChunkAggregates::GetFreeAggregate(uint64_t key) {
+        auto&& aggregates = m_chunks[key];
+
+        for (auto&& pAggregate : aggregates) {
+            if (pAggregate->getNbActors() < pAggregate->getMaxNbActors()) {
+                return pAggregate;
+            }
+        }
+
+        /// static actors never collide with each other
+        auto&& pAggregate = m_physics->createAggregate(m_maxActors, false);
+        if (!pAggregate) {
+            if (aggregates.empty()) {
+                m_chunks.erase(key);
+            }
+            return nullptr;
+        }
+
+        aggregates.emplace_back(pAggregate);
+        m_keys[pAggregate] = key;
+        m_pending.emplace_back(pAggregate);
+
+        return pAggregate;
+    }
+
+    void PhysXChunkAggregates::Release(physx::PxAggregate* pAggregate) {
+        if (const uint32_t count = pAggregate->getNbActors(); count > 0) {
+            std::vector<physx::PxActor*> aggregated(count);
+            pAggregate->getActors(aggregated.data(), count);
+
+            for (auto&& pActor : aggregated) {
+                pAggregate->removeActor(*pActor);
+            }
+        }
+
+        pAggregate->release();
+
+        if (auto&& pIt = m_keys.find(pAggregate); pIt != m_keys.end()) {
+            if (auto&& pChunkIt = m_chunks.find(pIt->second); pChunkIt != m_chunks.end()) {
+                std::erase(pChunkIt->second, pAggregate);
+
+                if (pChunkIt->second.empty()) {
+                    m_chunks.erase(pChunkIt);
+                }
+            }
+
+            m_keys.erase(pIt);
+        }
+
+        std::erase(m_pending, pAggregate);
+    }
+}
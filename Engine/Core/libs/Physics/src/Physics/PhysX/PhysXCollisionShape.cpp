@@ -4,6 +4,11 @@
 
 #include <Physics/PhysX/PhysXCollisionShape.h>
 #include <Physics/PhysX/PhysXRigidbody3D.h>
+#include <Physics/PhysX/PhysXRaycast3DImpl.h>
+#include <Physics/3D/Raycast3D.h>
+#include <Physics/PhysicsMaterial.h>
+
+#include <Utils/ECS/GameObject.h>
 
 namespace SR_PTYPES_NS {
     PhysXCollisionShape::PhysXCollisionShape(Super::LibraryPtr pLibrary)
@@ -15,11 +20,9 @@ namespace SR_PTYPES_NS {
     }
 
     PhysXCollisionShape::~PhysXCollisionShape() {
-        if (m_shape) {
-            m_shape->userData = nullptr;
-            m_shape->release();
-            m_shape = nullptr;
-        }
+        ReleaseShape();
+        CancelCooking();
+        ReleaseMesh();
     }
 
     bool PhysXCollisionShape::UpdateShape() {
@@ -27,51 +30,32 @@ namespace SR_PTYPES_NS {
             return false;
         }
 
-        auto&& pPhysics = GetLibrary<PhysXLibraryImpl>()->GetPxPhysics();
-
-        if (m_shape) {
-            m_shape->release();
-            m_shape = nullptr;
-        }
-
-        auto&& pMaterial = GetMaterial();
-        bool isDefaultMaterial = false;
-
-        if (!pMaterial) {
-            pMaterial = pPhysics->createMaterial(1.0f, 1.0f, 0.0f);
-            isDefaultMaterial = true;
+        /// the mesh of the previous shape is kept until the new one is acquired, the cache would free it otherwise
+        if (m_type != ShapeType::Convex3D && m_type != ShapeType::TriangleMesh3D) {
+            CancelCooking();
+            ReleaseMesh();
         }
 
         switch (m_type) {
-            case ShapeType::Box3D: {
-                m_shape = pPhysics->createShape(physx::PxBoxGeometry(SR_PHYSICS_UTILS_NS::FV3ToPxV3(GetSize())), *pMaterial, true);
-                break;
-            }
-            case ShapeType::Sphere3D: {
-                m_shape = pPhysics->createShape(physx::PxSphereGeometry(GetRadius()), *pMaterial, true);
-                break;
-            }
-            case ShapeType::Capsule3D: {
-                m_shape = pPhysics->createShape(physx::PxCapsuleGeometry(GetRadius(), GetHeight()), *pMaterial, true);
+            case ShapeType::Box3D:
+            case ShapeType::Sphere3D:
+            case ShapeType::Capsule3D:
                 break;
-            }
             case ShapeType::Convex3D: {
                 SR_HTYPES_NS::RawMesh* rawMesh = GetRigidbody()->GetRawMesh();
 
                 if (!rawMesh) {
                     SR_WARN("PhysXCollisionShape::UpdateShape() : mesh is not set!");
-                    m_shape = pPhysics->createShape(physx::PxBoxGeometry(SR_PHYSICS_UTILS_NS::FV3ToPxV3(GetSize())), *pMaterial, true);
+                    CancelCooking();
+                    ReleaseMesh();
                     break;
                 }
 
-                physx::PxConvexMesh* convexMesh = CreateConvexMesh(rawMesh);
-
-                if (!convexMesh) {
+                if (!PrepareMesh(rawMesh)) {
                     SR_ERROR("PhysXCollisionShape::UpdateShape() : failed to create convex mesh!");
                     return false;
                 }
 
-                m_shape = pPhysics->createShape(physx::PxConvexMeshGeometry(convexMesh), *pMaterial);
                 break;
             }
             case ShapeType::TriangleMesh3D: {
@@ -82,36 +66,26 @@ namespace SR_PTYPES_NS {
                     return false;
                 }
 
-                physx::PxTriangleMesh* triangleMesh = CreateTriangleMesh(rawMesh);
-
-                if (!triangleMesh) {
+                if (!PrepareMesh(rawMesh)) {
                     SR_ERROR("PhysXCollisionShape::UpdateShape() : failed to create triangle mesh!");
                     return false;
                 }
 
-                m_shape = pPhysics->createShape(physx::PxTriangleMeshGeometry(triangleMesh), *pMaterial);
                 break;
             }
             default:
                 SR_ERROR("PhysXCollisionShape::UpdateShape() : unsupported shape! Type: " + SR_UTILS_NS::EnumReflector::ToStringAtom(m_type).ToStringRef());
-
-                if (isDefaultMaterial) {
-                    pMaterial->release();
-                }
-                
                 return false;
         }
 
-        SRAssert(m_shape);
+        SR_PHYSICS_NS::PhysXShapeDesc desc;
 
-        if (m_shape) {
-            m_shape->userData = (void*)dynamic_cast<CollisionShape*>(this);
+        if (!MakeShapeDesc(desc) || !ReplaceShape(desc)) {
+            SR_ERROR("PhysXCollisionShape::UpdateShape() : failed to acquire shape!");
+            return false;
         }
 
-        if (m_rigidbody->IsTrigger()){
-            m_shape->setFlag(physx::PxShapeFlag::eSIMULATION_SHAPE, false);
-            m_shape->setFlag(physx::PxShapeFlag::eTRIGGER_SHAPE, true);
-        }
+        SRAssert(m_shape);
 
         return true;
     }
@@ -121,130 +95,267 @@ namespace SR_PTYPES_NS {
             return false;
         }
 
-        switch (m_type) {
-            case ShapeType::Box3D:
-                m_shape->setGeometry(physx::PxBoxGeometry(SR_PHYSICS_UTILS_NS::FV3ToPxV3(GetSize() * GetScale())));
-                break;
-            case ShapeType::Capsule3D: {
-                auto&& maxXZ = SR_MAX(GetScale().x, GetScale().z);
-                m_shape->setGeometry(physx::PxCapsuleGeometry(GetRadius() * maxXZ, GetHeight() * GetScale().y));
-                break;
+        /// meshes are not scaled, their geometry is set by UpdateShape()
+        if (m_type != ShapeType::Box3D && m_type != ShapeType::Sphere3D && m_type != ShapeType::Capsule3D) {
+            return true;
+        }
+
+        SR_PHYSICS_NS::PhysXShapeDesc desc;
+
+        if (!MakeShapeDesc(desc)) {
+            return false;
+        }
+
+        if (desc.geometry.getType() == m_geometry.getType()) {
+            switch (desc.geometry.getType()) {
+                case physx::PxGeometryType::eBOX:
+                    if (desc.geometry.box().halfExtents == m_geometry.box().halfExtents) {
+                        return true;
+                    }
+                    break;
+                case physx::PxGeometryType::eSPHERE:
+                    if (desc.geometry.sphere().radius == m_geometry.sphere().radius) {
+                        return true;
+                    }
+                    break;
+                case physx::PxGeometryType::eCAPSULE:
+                    if (desc.geometry.capsule().radius == m_geometry.capsule().radius && desc.geometry.capsule().halfHeight == m_geometry.capsule().halfHeight) {
+                        return true;
+                    }
+                    break;
+                default:
+                    break;
             }
-            case ShapeType::Sphere3D:
-                m_shape->setGeometry(physx::PxSphereGeometry(GetRadius() * GetScale().Max()));
-                break;
-            case ShapeType::Convex3D: /// кейс не нужен, геометрия обновляется при создании меша в UpdateShape()
-            default:
-                break;
+        }
+
+        auto&& pPrevious = m_shape;
+        /// the actor holds its own reference, the previous shape is alive until it is detached
+        if (!ReplaceShape(desc)) {
+            return false;
+        }
+
+        auto&& pActor = reinterpret_cast<physx::PxRigidActor*>(m_rigidbody->GetHandle());
+        if (!pActor || pPrevious == m_shape) {
+            return true;
+        }
+
+        std::vector<physx::PxShape*> shapes(pActor->getNbShapes());
+        pActor->getShapes(shapes.data(), static_cast<physx::PxU32>(shapes.size()));
+
+        /// shared shapes can't be changed, the actor gets the scaled one instead
+        if (std::find(shapes.begin(), shapes.end(), pPrevious) != shapes.end()) {
+            pActor->detachShape(*pPrevious);
+            pActor->attachShape(*m_shape);
         }
 
         return true;
     }
 
-    physx::PxConvexMesh* PhysXCollisionShape::CreateConvexMesh(SR_HTYPES_NS::RawMesh* pRawMesh) {
+    bool PhysXCollisionShape::PrepareMesh(SR_HTYPES_NS::RawMesh* pRawMesh) {
         SRAssert(pRawMesh);
 
         const uint32_t meshId = GetRigidbody()->GetMeshId();
         if (meshId >= pRawMesh->GetMeshesCount()) {
-            return nullptr;
+            return false;
         }
 
+        const bool isConvex = m_type == ShapeType::Convex3D;
+
         auto&& vertices = pRawMesh->GetVertices(meshId);
-        auto&& indices = pRawMesh->GetIndices(meshId);
-        std::vector<physx::PxVec3> pxVertices;
-        pxVertices.resize(indices.size());
 
-        for (uint32_t i = 0; i < indices.size(); ++i) {
-            const uint64_t vertexIndex = indices[i];
-            pxVertices[i] = *reinterpret_cast<physx::PxVec3*>(&vertices[vertexIndex].position);
+        std::vector<physx::PxVec3> points;
+        points.resize(vertices.size());
+
+        physx::PxBounds3 bounds = physx::PxBounds3::empty();
+
+        for (uint32_t i = 0; i < vertices.size(); ++i) {
+            points[i] = *reinterpret_cast<const physx::PxVec3*>(&vertices[i].position);
+            bounds.include(points[i]);
         }
 
-        auto&& pPhysics = GetLibrary<PhysXLibraryImpl>()->GetPxPhysics();
+        std::vector<uint32_t> indices;
+        if (!isConvex) {
+            auto&& rawIndices = pRawMesh->GetIndices(meshId);
+            indices.assign(rawIndices.begin(), rawIndices.end());
+        }
 
-        physx::PxTolerancesScale scale = pPhysics->getTolerancesScale();
-        physx::PxCooking* cooking = PxCreateCooking(0, pPhysics->getFoundation(), physx::PxCookingParams(scale)); /// PxU32 /*version*/
+        auto&& pCache = GetLibrary<PhysXLibraryImpl>()->GetMeshCache();
+        const uint64_t hash = isConvex ? pCache->GetConvexMeshHash(points) : pCache->GetTriangleMeshHash(points, indices);
 
-        physx::PxConvexMeshDesc convexDesc;
-        convexDesc.points.count = pRawMesh->GetIndicesCount(meshId);
-        convexDesc.points.stride = sizeof(physx::PxVec3);
-        convexDesc.points.data = &pxVertices[0];
-        convexDesc.flags = physx::PxConvexFlag::eCOMPUTE_CONVEX;
+        /// the source was changed while cooking
+        if (m_cookingTask && m_cookingTask->GetHash() != hash) {
+            CancelCooking();
+        }
 
-        physx::PxConvexMesh* convexMesh = nullptr;
-        physx::PxDefaultMemoryOutputStream buf;
-        if (cooking->cookConvexMesh(convexDesc, buf))
-        {
-            physx::PxDefaultMemoryInputData id(buf.getData(), buf.getSize());
-            convexMesh = pPhysics->createConvexMesh(id);
+        /// the placeholder is replaced by the mesh cooked in the background
+        const bool isWaiting = m_cookingTask != nullptr;
+
+        if (!m_cookingTask) {
+            m_cookingTask = isConvex
+                ? pCache->CookConvexMeshAsync(hash, std::move(points))
+                : pCache->CookTriangleMeshAsync(hash, std::move(points), std::move(indices));
         }
 
-        cooking->release();
+        ReleaseMesh();
+
+        if (!m_cookingTask->IsDone()) {
+            m_placeholderBounds = bounds;
+            return true;
+        }
 
-        return convexMesh;
+        if (isWaiting) {
+            SR_LOG("PhysXCollisionShape::PrepareMesh() : mesh is ready in {} ms.", m_cookingTask->GetTime());
+        }
+
+        m_mesh = m_cookingTask->GetMesh();
+        m_cookingTask.reset();
+
+        return m_mesh != nullptr;
     }
 
-    physx::PxTriangleMesh* PhysXCollisionShape::CreateTriangleMesh(SR_HTYPES_NS::RawMesh* pRawMesh) {
-        SRAssert(pRawMesh);
+    bool PhysXCollisionShape::MakeGeometry(physx::PxGeometryHolder& geometry, physx::PxTransform& localPose) const {
+        switch (m_type) {
+            case ShapeType::Box3D:
+                geometry = physx::PxBoxGeometry(SR_PHYSICS_UTILS_NS::FV3ToPxV3(GetSize() * GetScale()));
+                return true;
+            case ShapeType::Sphere3D:
+                geometry = physx::PxSphereGeometry(GetRadius() * GetScale().Max());
+                return true;
+            case ShapeType::Capsule3D: {
+                auto&& maxXZ = SR_MAX(GetScale().x, GetScale().z);
+                geometry = physx::PxCapsuleGeometry(GetRadius() * maxXZ, GetHeight() * GetScale().y);
+                return true;
+            }
+            case ShapeType::Convex3D:
+            case ShapeType::TriangleMesh3D:
+                break;
+            default:
+                return false;
+        }
 
-        const uint32_t meshId = GetRigidbody()->GetMeshId();
-        if (meshId >= pRawMesh->GetMeshesCount()) {
-            return nullptr;
+        /// box of the mesh bounds until the mesh is cooked
+        if (IsPlaceholder()) {
+            const bool isEmpty = m_placeholderBounds.isEmpty();
+            const physx::PxVec3 halfExtents = isEmpty ? physx::PxVec3(0.5f) : m_placeholderBounds.getExtents().maximum(physx::PxVec3(0.01f));
+
+            geometry = physx::PxBoxGeometry(halfExtents);
+
+            if (!isEmpty) {
+                localPose = physx::PxTransform(m_placeholderBounds.getCenter());
+            }
+
+            return true;
         }
 
-        auto&& vertices = pRawMesh->GetVertices(meshId);
-        auto&& indices = pRawMesh->GetIndices(meshId);
-        std::vector<physx::PxVec3> pxVertices;
-        pxVertices.resize(indices.size());
+        if (!m_mesh) {
+            /// convex shape without a mesh
+            geometry = physx::PxBoxGeometry(SR_PHYSICS_UTILS_NS::FV3ToPxV3(GetSize()));
+            return m_type == ShapeType::Convex3D;
+        }
 
-        for (uint32_t i = 0; i < indices.size(); ++i) {
-            const uint64_t vertexIndex = indices[i];
-            pxVertices[i] = *reinterpret_cast<physx::PxVec3*>(&vertices[vertexIndex].position);
+        if (m_type == ShapeType::Convex3D) {
+            geometry = physx::PxConvexMeshGeometry(static_cast<physx::PxConvexMesh*>(m_mesh));
+        }
+        else {
+            geometry = physx::PxTriangleMeshGeometry(static_cast<physx::PxTriangleMesh*>(m_mesh));
         }
 
-        physx::PxTriangleMeshDesc meshDesc;
-        meshDesc.points.count = pRawMesh->GetIndicesCount(meshId);
-        meshDesc.points.stride = sizeof(physx::PxVec3);
-        meshDesc.points.data = &pxVertices[0];
+        return true;
+    }
 
-        meshDesc.triangles.count = pRawMesh->GetIndicesCount(meshId) / 3;
-        meshDesc.triangles.stride = 3 * sizeof(uint32_t);
-        meshDesc.triangles.data = &indices[0];
+    bool PhysXCollisionShape::MakeShapeDesc(SR_PHYSICS_NS::PhysXShapeDesc& desc) const {
+        if (!MakeGeometry(desc.geometry, desc.localPose)) {
+            return false;
+        }
 
-        auto&& pPhysics = GetLibrary<PhysXLibraryImpl>()->GetPxPhysics();
+        desc.pMaterial = GetMaterial();
+
+        /// bounds of a level geometry would push out everything inside of it, the body has no collision until the mesh is ready
+        if (IsPlaceholder() && m_type == ShapeType::TriangleMesh3D) {
+            desc.flags = physx::PxShapeFlag::eVISUALIZATION;
+        }
+        else if (m_rigidbody->IsTrigger()) {
+            desc.flags = physx::PxShapeFlag::eVISUALIZATION | physx::PxShapeFlag::eSCENE_QUERY_SHAPE | physx::PxShapeFlag::eTRIGGER_SHAPE;
+        }
 
-        physx::PxTriangleMesh* triangleMesh = nullptr;
-        physx::PxDefaultMemoryOutputStream writeBuffer;
+        const SR_UTILS_NS::StringAtom layer = m_rigidbody->GetCollisionLayer();
 
-        physx::PxTolerancesScale scale = pPhysics->getTolerancesScale();
-        physx::PxCooking* cooking = PxCreateCooking(0, pPhysics->getFoundation(), physx::PxCookingParams(scale));
+        /// word0 is the layer bit, word1 is the collision mask and word2 holds the contact events, see contactReportFilterShader()
+        desc.simulationFilterData = physx::PxFilterData(
+            SR_PHYSICS_NS::Raycast3D::GetLayerMask(layer),
+            SR_PHYSICS_NS::PhysicsLibrary::Instance().GetCollisionMask(layer),
+            m_rigidbody->GetContactEvents(),
+            0
+        );
 
-        if (cooking->cookTriangleMesh(meshDesc, writeBuffer))
-        {
-            physx::PxDefaultMemoryInputData id(writeBuffer.getData(), writeBuffer.getSize());
-            triangleMesh = pPhysics->createTriangleMesh(id);
+        if (auto&& pGameObject = m_rigidbody->GetGameObject()) {
+            desc.queryFilterData = SR_PHYSICS_NS::PhysXRaycast3DImpl::MakeQueryFilterData(layer, pGameObject->GetTag());
         }
 
-        cooking->release();
+        return true;
+    }
+
+    bool PhysXCollisionShape::ReplaceShape(const SR_PHYSICS_NS::PhysXShapeDesc& desc) {
+        auto&& pShape = GetLibrary<PhysXLibraryImpl>()->GetShapeCache()->AcquireShape(desc);
+        if (!pShape) {
+            return false;
+        }
+
+        ReleaseShape();
+
+        m_shape = pShape;
+        m_geometry = desc.geometry;
+
+        return true;
+    }
+
+    void PhysXCollisionShape::ReleaseShape() {
+        if (!m_shape) {
+            return;
+        }
+
+        if (auto&& pLibrary = GetLibrary<PhysXLibraryImpl>()) {
+            pLibrary->GetShapeCache()->ReleaseShape(m_shape);
+        }
 
-        return triangleMesh;
+        m_shape = nullptr;
+    }
+
+    void PhysXCollisionShape::CancelCooking() {
+        if (!m_cookingTask) {
+            return;
+        }
+
+        GetLibrary<PhysXLibraryImpl>()->GetMeshCache()->Cancel(m_cookingTask);
+        m_cookingTask.reset();
+    }
+
+    void PhysXCollisionShape::ReleaseMesh() {
+        if (!m_mesh) {
+            return;
+        }
+
+        if (auto&& pLibrary = GetLibrary<PhysXLibraryImpl>()) {
+            pLibrary->GetMeshCache()->Release(m_mesh);
+        }
+
+        m_mesh = nullptr;
     }
 
     physx::PxMaterial* PhysXCollisionShape::GetMaterial() const {
         auto&& pMaterial = GetRigidbody()->GetPhysicsMaterial();
-        if (!pMaterial) {
-            return nullptr;
-        }
 
-        auto&& pMaterialImpl = pMaterial->GetMaterialImpl(LibraryType::PhysX);
-        if (!pMaterialImpl) {
-            return nullptr;
+        /// all rigidbodies without a material share the default one
+        if (!pMaterial) {
+            pMaterial = SR_PHYSICS_NS::PhysicsLibrary::Instance().GetDefaultMaterial();
         }
 
-        auto&& pPxMaterial = pMaterialImpl->GetHandle();
-        if (!pPxMaterial) {
-            return nullptr;
+        if (auto&& pMaterialImpl = pMaterial ? pMaterial->GetMaterialImpl(LibraryType::PhysX) : nullptr) {
+            if (auto&& pPxMaterial = pMaterialImpl->GetHandle()) {
+                return (physx::PxMaterial*)pPxMaterial;
+            }
         }
 
-        return (physx::PxMaterial*)pPxMaterial;
+        return GetLibrary<PhysXLibraryImpl>()->GetShapeCache()->GetDefaultMaterial();
     }
 }
@@ -0,0 +1,22 @@
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <Physics/PhysX/PhysXJobDispatcher.h>
+
+namespace SR_PHYSICS_NS {
+    PhysXJobDispatcher::PhysXJobDispatcher(PhysicsLibrary::JobScheduler scheduler, uint32_t workers)
+        : physx::PxCpuDispatcher()
+        , m_scheduler(std::move(scheduler))
+        , m_workers(SR_MAX(workers, 1u))
+    { }
+
+    void PhysXJobDispatcher::submitTask(physx::PxBaseTask& task) {
+        /// tasks are submitted from the simulating thread and from other tasks, both are allowed by the scheduler
+        m_scheduler([pTask = &task]() {
+            SR_TRACY_ZONE_N("PhysX task");
+            pTask->run();
+            pTask->release();
+        });
+    }
+}
@@ -3,6 +3,7 @@
 //
 
 #include <Utils/Common/Features.h>
+#include <Utils/Resources/ResourceManager.h>
 
 #include <Physics/PhysX/PhysXLibraryImpl.h>
 
@@ -11,6 +12,7 @@
 #include <Physics/PhysX/PhysXRigidbody3D.h>
 #include <Physics/PhysX/PhysXMaterialImpl.h>
 #include <Physics/PhysX/PhysXVehicle4W3D.h>
+#include <Physics/PhysX/PhysXCharacterController3D.h>
 
 namespace SR_PHYSICS_NS {
     bool PhysXLibraryImpl::Initialize() {
@@ -37,6 +39,11 @@ namespace SR_PHYSICS_NS {
             return false;
         }
 
+        LoadSettings();
+
+        m_meshCache = new PhysXMeshCache(m_physics, m_isAsyncCooking ? m_cookingWorkers : 0);
+        m_shapeCache = new PhysXShapeCache(m_physics);
+
         if (IsVehicleSupported()) {
             SR_TRACY_ZONE_N("Init vechicle");
 
@@ -56,6 +63,10 @@ namespace SR_PHYSICS_NS {
             physx::PxCloseVehicleSDK();
         }
 
+        /// shapes reference the meshes
+        SR_SAFE_DELETE_PTR(m_shapeCache);
+        SR_SAFE_DELETE_PTR(m_meshCache);
+
         if (m_physics) {
             m_physics->release();
             m_physics = nullptr;
@@ -80,6 +91,73 @@ namespace SR_PHYSICS_NS {
         SR_SAFE_DELETE_PTR(m_errorCallback);
     }
 
+    void PhysXLibraryImpl::LoadSettings() {
+        auto&& path = SR_UTILS_NS::ResourceManager::Instance().GetResPath().Concat("Engine/Configs/Physics.xml");
+        auto&& document = SR_XML_NS::Document::Load(path);
+        if (!document.Valid()) {
+            SR_WARN("PhysXLibraryImpl::LoadSettings() : failed to load xml document, default settings are used.\n\tPath: " + path.ToString());
+            return;
+        }
+
+        auto&& physXNode = document.Root().GetNode("Physics").TryGetNode("PhysX");
+
+        auto&& cookingNode = physXNode.TryGetNode("Cooking");
+        m_isAsyncCooking = cookingNode.TryGetAttribute("Async").ToBool(m_isAsyncCooking);
+        m_cookingWorkers = static_cast<uint32_t>(SR_MAX(cookingNode.TryGetAttribute("Workers").ToInt(static_cast<int32_t>(m_cookingWorkers)), 1));
+
+        auto&& dispatcherNode = physXNode.TryGetNode("Dispatcher");
+
+        if (auto&& mode = dispatcherNode.TryGetAttribute("Mode").ToString(); !mode.empty()) {
+            m_dispatcherMode = SR_UTILS_NS::EnumReflector::FromString<PhysXDispatcherMode>(mode);
+        }
+
+        if (auto&& workers = dispatcherNode.TryGetAttribute("Workers").ToString(); !workers.empty() && workers != "auto") {
+            m_dispatcherWorkers = static_cast<uint32_t>(SR_MAX(std::atoi(workers.c_str()), 0));
+        }
+
+        auto&& broadPhaseNode = physXNode.TryGetNode("BroadPhase");
+
+        if (auto&& type = broadPhaseNode.TryGetAttribute("Type").ToString(); !type.empty()) {
+            m_broadPhaseType = SR_UTILS_NS::EnumReflector::FromString<PhysXBroadPhaseType>(type);
+        }
+
+        /// PhysX supports up to 256 regions
+        m_broadPhaseRegions = static_cast<uint32_t>(SR_CLAMP(broadPhaseNode.TryGetAttribute("Regions").ToInt(static_cast<int32_t>(m_broadPhaseRegions)), 1, 16));
+
+        auto&& aggregatesNode = physXNode.TryGetNode("Aggregates");
+        m_isChunkAggregates = aggregatesNode.TryGetAttribute("Enabled").ToBool(m_isChunkAggregates);
+        /// the limit of the actors in an aggregate is 128
+        m_aggregateMaxActors = static_cast<uint32_t>(SR_CLAMP(aggregatesNode.TryGetAttribute("MaxActors").ToInt(static_cast<int32_t>(m_aggregateMaxActors)), 1, 128));
+
+        LoadWorldSettings();
+    }
+
+    void PhysXLibraryImpl::LoadWorldSettings() {
+        auto&& path = SR_UTILS_NS::ResourceManager::Instance().GetResPath().Concat("Engine/Configs/World.xml");
+        auto&& document = SR_XML_NS::Document::Load(path);
+        if (!document.Valid()) {
+            SR_WARN("PhysXLibraryImpl::LoadWorldSettings() : failed to load xml document, default grid is used.\n\tPath: " + path.ToString());
+            return;
+        }
+
+        auto&& configsNode = document.Root().GetNode("Configs");
+
+        const float_t chunkWidth = static_cast<float_t>(SR_MAX(configsNode.TryGetNode("DefaultChunkWidth").TryGetAttribute("Value").ToInt(32), 1));
+        const float_t chunkHeight = static_cast<float_t>(SR_MAX(configsNode.TryGetNode("DefaultChunkHeight").TryGetAttribute("Value").ToInt(128), 1));
+
+        m_chunkSize = SR_MATH_NS::FVector3(chunkWidth, chunkHeight, chunkWidth);
+        m_regionWidth = static_cast<uint32_t>(SR_MAX(configsNode.TryGetNode("DefaultRegionWidth").TryGetAttribute("Value").ToInt(32), 1));
+    }
+
+    uint32_t PhysXLibraryImpl::GetDispatcherWorkers() const {
+        if (m_dispatcherWorkers > 0) {
+            return m_dispatcherWorkers;
+        }
+
+        const uint32_t cores = std::thread::hardware_concurrency();
+        return cores > 3 ? cores - 2 : 1;
+    }
+
     bool PhysXLibraryImpl::IsShapeSupported(ShapeType type) const {
         switch (type) {
             case ShapeType::Plane3D:
@@ -113,6 +191,10 @@ namespace SR_PHYSICS_NS {
         return new SR_PTYPES_NS::PhysXVehicle4W3D(this);
     }
 
+    SR_PTYPES_NS::CharacterController3DImpl* PhysXLibraryImpl::CreateCharacterController3DImpl() {
+        return new SR_PTYPES_NS::PhysXCharacterController3DImpl(this);
+    }
+
     void PhysXLibraryImpl::ConnectPVD() {
         SR_TRACY_ZONE_N("Create PVD");
 
@@ -3,19 +3,20 @@
 //
 
 #include <Physics/PhysX/PhysXMaterialImpl.h>
+#include <Physics/PhysX/PhysXLibraryImpl.h>
 
 namespace SR_PTYPES_NS {
     PhysXMaterialImpl::PhysXMaterialImpl(LibraryPtr pLibrary)
         : Super(pLibrary)
     {
-        m_physics = GetLibrary<PhysXLibraryImpl>()->GetPxPhysics();
+        m_shapeCache = GetLibrary<PhysXLibraryImpl>()->GetShapeCache();
     }
 
     PhysXMaterialImpl::~PhysXMaterialImpl() {
         SR_TRACY_ZONE;
 
         if (m_pxMaterial) {
-            m_pxMaterial->release();
+            m_shapeCache->ReleaseMaterial(m_pxMaterial);
             m_pxMaterial = nullptr;
         }
     }
@@ -27,16 +28,16 @@ namespace SR_PTYPES_NS {
             return false;
         }
 
-        m_pxMaterial = m_physics->createMaterial(
-            m_material->GetStaticFriction(),
-            m_material->GetDynamicFriction(),
-            m_material->GetBounciness()
-        );
+        PhysicsMaterialData data;
+        data.staticFriction = m_material->GetStaticFriction();
+        data.dynamicFriction = m_material->GetDynamicFriction();
+        data.bounciness = m_material->GetBounciness();
+        data.frictionCombine = m_material->GetFrictionCombine();
+        data.bounceCombine = m_material->GetBounceCombine();
 
-        m_pxMaterial->setFrictionCombineMode(SR_PHYSICS_UTILS_NS::CombineToPxCombine(m_material->GetFrictionCombine()));
-        m_pxMaterial->setRestitutionCombineMode(SR_PHYSICS_UTILS_NS::CombineToPxCombine(m_material->GetBounceCombine()));
+        m_pxMaterial = m_shapeCache->AcquireMaterial(data);
 
-        return true;
+        return m_pxMaterial != nullptr;
     }
 
     bool PhysXMaterialImpl::ReInit() {
@@ -52,7 +53,7 @@ namespace SR_PTYPES_NS {
         SR_TRACY_ZONE;
 
         if (m_pxMaterial) {
-            m_pxMaterial->release();
+            m_shapeCache->ReleaseMaterial(m_pxMaterial);
             m_pxMaterial = nullptr;
         }
     }
@@ -0,0 +1,492 @@
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <Physics/PhysX/PhysXMeshCache.h>
+
+#include <Utils/Resources/ResourceManager.h>
+
+namespace SR_PHYSICS_NS {
+    namespace {
+        constexpr uint64_t FNVOffsetBasis = 14695981039346656037ull;
+        constexpr uint64_t FNVPrime = 1099511628211ull;
+
+        uint64_t HashBytes(uint64_t hash, const void* pData, size_t size) {
+            auto&& pBytes = static_cast<const uint8_t*>(pData);
+            for (size_t i = 0; i < size; ++i) {
+                hash ^= pBytes[i];
+                hash *= FNVPrime;
+            }
+            return hash;
+        }
+
+        template<typename T> uint64_t HashValue(uint64_t hash, const T& value) {
+            return HashBytes(hash, &value, sizeof(T));
+        }
+    }
+
+    bool PhysXCookingTask::Complete(physx::PxBase* pMesh) {
+        m_mesh = pMesh;
+        m_time = std::chrono::duration<double_t, std::milli>(Clock::now() - m_start).count();
+
+        State expected = State::Pending;
+        if (m_state.compare_exchange_strong(expected, State::Done, std::memory_order_acq_rel)) {
+            return true;
+        }
+
+        m_mesh = nullptr;
+
+        return false;
+    }
+
+    physx::PxBase* PhysXCookingTask::Cancel() {
+        State expected = State::Pending;
+        if (m_state.compare_exchange_strong(expected, State::Cancelled, std::memory_order_acq_rel)) {
+            return nullptr;
+        }
+
+        return expected == State::Done ? m_mesh : nullptr;
+    }
+
+    /// ----------------------------------------------------------------------------------------------------------------
+
+    PhysXMeshCache::PhysXMeshCache(physx::PxPhysics* pPhysics, uint32_t workers)
+        : SR_UTILS_NS::NonCopyable()
+        , m_physics(pPhysics)
+    {
+        /// created once, the cooking functions are safe to call from several threads
+        m_cooking = PxCreateCooking(SR_PHYSX_PHYSICS_VERSION, m_physics->getFoundation(), GetCookingParams());
+        if (!m_cooking) {
+            SR_ERROR("PhysXMeshCache::PhysXMeshCache() : failed to create cooking!");
+        }
+
+        m_workers.resize(workers);
+
+        for (uint32_t i = 0; i < workers; ++i) {
+            SR_HTYPES_NS::Thread::Factory::Instance().Create(m_workers[i], [this]() {
+                WorkerLoop();
+            });
+            m_workers[i]->SetName("PhysX cooking " + std::to_string(i));
+        }
+    }
+
+    PhysXMeshCache::~PhysXMeshCache() {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stopped = true;
+        }
+        m_condition.notify_all();
+
+        for (auto&& pThread : m_workers) {
+            if (pThread && pThread->Joinable()) {
+                pThread->Join();
+            }
+
+            if (pThread) {
+                pThread->Free();
+            }
+        }
+
+        m_workers.clear();
+
+        if (!m_entries.empty()) {
+            SR_WARN("PhysXMeshCache::~PhysXMeshCache() : {} meshes are still in use!", m_entries.size());
+        }
+
+        for (auto&& [hash, entry] : m_entries) {
+            entry.pMesh->release();
+        }
+
+        m_entries.clear();
+        m_hashes.clear();
+
+        if (m_cooking) {
+            m_cooking->release();
+            m_cooking = nullptr;
+        }
+    }
+
+    uint64_t PhysXMeshCache::GetConvexMeshHash(const std::vector<physx::PxVec3>& points) const {
+        const uint64_t hash = HashValue(GetParamsHash(), physx::PxConcreteType::eCONVEX_MESH);
+        return HashBytes(hash, points.data(), points.size() * sizeof(physx::PxVec3));
+    }
+
+    uint64_t PhysXMeshCache::GetTriangleMeshHash(const std::vector<physx::PxVec3>& points, const std::vector<uint32_t>& indices) const {
+        uint64_t hash = HashValue(GetParamsHash(), physx::PxConcreteType::eTRIANGLE_MESH_BVH33);
+        hash = HashBytes(hash, points.data(), points.size() * sizeof(physx::PxVec3));
+        return HashBytes(hash, indices.data(), indices.size() * sizeof(uint32_t));
+    }
+
+    physx::PxConvexMesh* PhysXMeshCache::AcquireConvexMesh(const std::vector<physx::PxVec3>& points) {
+        SR_TRACY_ZONE;
+
+        if (points.empty()) {
+            return nullptr;
+        }
+
+        const uint64_t hash = GetConvexMeshHash(points);
+
+        if (auto&& pMesh = Acquire(hash)) {
+            return static_cast<physx::PxConvexMesh*>(pMesh);
+        }
+
+        return CreateConvexMesh(hash, points);
+    }
+
+    physx::PxTriangleMesh* PhysXMeshCache::AcquireTriangleMesh(const std::vector<physx::PxVec3>& points, const std::vector<uint32_t>& indices) {
+        SR_TRACY_ZONE;
+
+        if (points.empty() || indices.size() < 3) {
+            return nullptr;
+        }
+
+        const uint64_t hash = GetTriangleMeshHash(points, indices);
+
+        if (auto&& pMesh = Acquire(hash)) {
+            return static_cast<physx::PxTriangleMesh*>(pMesh);
+        }
+
+        return CreateTriangleMesh(hash, points, indices);
+    }
+
+    PhysXMeshCache::TaskPtr PhysXMeshCache::CookConvexMeshAsync(uint64_t hash, std::vector<physx::PxVec3> points) {
+        if (points.empty()) {
+            auto&& pTask = std::make_shared<PhysXCookingTask>(hash);
+            pTask->Complete(nullptr);
+            return pTask;
+        }
+
+        return Schedule(hash, [this, hash, points = std::move(points)]() -> physx::PxBase* {
+            return CreateConvexMesh(hash, points);
+        });
+    }
+
+    PhysXMeshCache::TaskPtr PhysXMeshCache::CookTriangleMeshAsync(uint64_t hash, std::vector<physx::PxVec3> points, std::vector<uint32_t> indices) {
+        if (points.empty() || indices.size() < 3) {
+            auto&& pTask = std::make_shared<PhysXCookingTask>(hash);
+            pTask->Complete(nullptr);
+            return pTask;
+        }
+
+        return Schedule(hash, [this, hash, points = std::move(points), indices = std::move(indices)]() -> physx::PxBase* {
+            return CreateTriangleMesh(hash, points, indices);
+        });
+    }
+
+    void PhysXMeshCache::Cancel(const TaskPtr& pTask) {
+        if (!pTask) {
+            return;
+        }
+
+        if (auto&& pMesh = pTask->Cancel()) {
+            Release(pMesh);
+        }
+    }
+
+    PhysXMeshCache::TaskPtr PhysXMeshCache::Schedule(uint64_t hash, std::function<physx::PxBase*()> create) {
+        auto&& pTask = std::make_shared<PhysXCookingTask>(hash);
+
+        if (auto&& pMesh = Acquire(hash)) {
+            pTask->Complete(pMesh);
+            return pTask;
+        }
+
+        if (m_workers.empty()) {
+            pTask->Complete(create());
+            return pTask;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            ++m_statistics.pending;
+
+            m_jobs.emplace_back([this, pTask, create = std::move(create)]() {
+                physx::PxBase* pMesh = create();
+
+                {
+                    std::lock_guard<std::mutex> statisticsLock(m_mutex);
+                    --m_statistics.pending;
+                }
+
+                /// the shape does not wait for the mesh anymore
+                if (!pTask->Complete(pMesh)) {
+                    Release(pMesh);
+                    return;
+                }
+
+                std::lock_guard<std::mutex> statisticsLock(m_mutex);
+                m_statistics.asyncTime += pTask->GetTime();
+                m_statistics.maxAsyncTime = SR_MAX(m_statistics.maxAsyncTime, pTask->GetTime());
+            });
+        }
+
+        m_condition.notify_one();
+
+        return pTask;
+    }
+
+    void PhysXMeshCache::WorkerLoop() {
+        while (true) {
+            std::function<void()> job;
+
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_condition.wait(lock, [this]() {
+                    return m_stopped || !m_jobs.empty();
+                });
+
+                /// the remaining jobs are finished, nobody would release their meshes otherwise
+                if (m_jobs.empty()) {
+                    break;
+                }
+
+                job = std::move(m_jobs.front());
+                m_jobs.pop_front();
+            }
+
+            SR_TRACY_ZONE_N("Cook mesh");
+
+            job();
+        }
+    }
+
+    physx::PxConvexMesh* PhysXMeshCache::CreateConvexMesh(uint64_t hash, const std::vector<physx::PxVec3>& points) {
+        SR_TRACY_ZONE;
+
+        const SR_UTILS_NS::Path path = GetCachePath(hash, "convex");
+
+        physx::PxConvexMesh* pConvexMesh = nullptr;
+        bool isCooked = false;
+        double_t cookingTime = 0.0;
+
+        if (std::vector<uint8_t> data; Load(path, data)) {
+            physx::PxDefaultMemoryInputData input(data.data(), static_cast<physx::PxU32>(data.size()));
+            pConvexMesh = m_physics->createConvexMesh(input);
+
+            if (!pConvexMesh) {
+                SR_WARN("PhysXMeshCache::CreateConvexMesh() : invalid cache, the mesh will be cooked again.\n\tPath: " + path.ToString());
+            }
+        }
+
+        if (!pConvexMesh && m_cooking) {
+            physx::PxConvexMeshDesc convexDesc;
+            convexDesc.points.count = static_cast<physx::PxU32>(points.size());
+            convexDesc.points.stride = sizeof(physx::PxVec3);
+            convexDesc.points.data = points.data();
+            convexDesc.flags = physx::PxConvexFlag::eCOMPUTE_CONVEX;
+
+            physx::PxDefaultMemoryOutputStream buffer;
+
+            const auto start = std::chrono::steady_clock::now();
+            const bool isSucceeded = m_cooking->cookConvexMesh(convexDesc, buffer);
+            cookingTime = std::chrono::duration<double_t, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+            if (isSucceeded) {
+                physx::PxDefaultMemoryInputData input(buffer.getData(), buffer.getSize());
+                pConvexMesh = m_physics->createConvexMesh(input);
+                Save(path, buffer);
+                isCooked = true;
+            }
+        }
+
+        if (!pConvexMesh) {
+            return nullptr;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            ++(isCooked ? m_statistics.cooked : m_statistics.loaded);
+            m_statistics.cookingTime += cookingTime;
+        }
+
+        return static_cast<physx::PxConvexMesh*>(Insert(hash, pConvexMesh));
+    }
+
+    physx::PxTriangleMesh* PhysXMeshCache::CreateTriangleMesh(uint64_t hash, const std::vector<physx::PxVec3>& points, const std::vector<uint32_t>& indices) {
+        SR_TRACY_ZONE;
+
+        const SR_UTILS_NS::Path path = GetCachePath(hash, "trimesh");
+
+        physx::PxTriangleMesh* pTriangleMesh = nullptr;
+        bool isCooked = false;
+        double_t cookingTime = 0.0;
+
+        if (std::vector<uint8_t> data; Load(path, data)) {
+            physx::PxDefaultMemoryInputData input(data.data(), static_cast<physx::PxU32>(data.size()));
+            pTriangleMesh = m_physics->createTriangleMesh(input);
+
+            if (!pTriangleMesh) {
+                SR_WARN("PhysXMeshCache::CreateTriangleMesh() : invalid cache, the mesh will be cooked again.\n\tPath: " + path.ToString());
+            }
+        }
+
+        if (!pTriangleMesh && m_cooking) {
+            physx::PxTriangleMeshDesc meshDesc;
+            meshDesc.points.count = static_cast<physx::PxU32>(points.size());
+            meshDesc.points.stride = sizeof(physx::PxVec3);
+            meshDesc.points.data = points.data();
+
+            meshDesc.triangles.count = static_cast<physx::PxU32>(indices.size() / 3);
+            meshDesc.triangles.stride = 3 * sizeof(uint32_t);
+            meshDesc.triangles.data = indices.data();
+
+            physx::PxDefaultMemoryOutputStream buffer;
+
+            const auto start = std::chrono::steady_clock::now();
+            const bool isSucceeded = m_cooking->cookTriangleMesh(meshDesc, buffer);
+            cookingTime = std::chrono::duration<double_t, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+            if (isSucceeded) {
+                physx::PxDefaultMemoryInputData input(buffer.getData(), buffer.getSize());
+                pTriangleMesh = m_physics->createTriangleMesh(input);
+                Save(path, buffer);
+                isCooked = true;
+            }
+        }
+
+        if (!pTriangleMesh) {
+            return nullptr;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            ++(isCooked ? m_statistics.cooked : m_statistics.loaded);
+            m_statistics.cookingTime += cookingTime;
+        }
+
+        return static_cast<physx::PxTriangleMesh*>(Insert(hash, pTriangleMesh));
+    }
+
+    void PhysXMeshCache::Release(physx::PxBase* pMesh) {
+        if (!pMesh) {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        auto&& hashIt = m_hashes.find(pMesh);
+        if (hashIt == m_hashes.end()) {
+            SRHalt("PhysXMeshCache::Release() : the mesh is not from the cache!");
+            return;
+        }
+
+        auto&& entryIt = m_entries.find(hashIt->second);
+        if (entryIt->second.references > 1) {
+            --entryIt->second.references;
+            return;
+        }
+
+        /// the shapes hold their own references, PhysX frees the mesh after the last shape
+        pMesh->release();
+
+        m_entries.erase(entryIt);
+        m_hashes.erase(hashIt);
+    }
+
+    PhysXMeshCache::Statistics PhysXMeshCache::GetStatistics() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        Statistics statistics = m_statistics;
+        statistics.meshes = static_cast<uint32_t>(m_entries.size());
+
+        return statistics;
+    }
+
+    physx::PxBase* PhysXMeshCache::Acquire(uint64_t hash) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        auto&& pIt = m_entries.find(hash);
+        if (pIt == m_entries.end()) {
+            return nullptr;
+        }
+
+        ++pIt->second.references;
+
+        return pIt->second.pMesh;
+    }
+
+    physx::PxBase* PhysXMeshCache::Insert(uint64_t hash, physx::PxBase* pMesh) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        auto&& [pIt, inserted] = m_entries.try_emplace(hash);
+        ++pIt->second.references;
+
+        /// the same mesh was cooked by another thread meanwhile, the duplicate is not needed
+        if (!inserted) {
+            pMesh->release();
+            return pIt->second.pMesh;
+        }
+
+        pIt->second.pMesh = pMesh;
+        m_hashes[pMesh] = hash;
+
+        return pMesh;
+    }
+
+    physx::PxCookingParams PhysXMeshCache::GetCookingParams() const {
+        return physx::PxCookingParams(m_physics->getTolerancesScale());
+    }
+
+    uint64_t PhysXMeshCache::GetParamsHash() const {
+        const physx::PxTolerancesScale scale = m_physics->getTolerancesScale();
+
+        uint64_t hash = HashValue(FNVOffsetBasis, static_cast<uint32_t>(SR_PHYSX_PHYSICS_VERSION));
+        hash = HashValue(hash, scale.length);
+        hash = HashValue(hash, scale.speed);
+
+        return hash;
+    }
+
+    SR_UTILS_NS::Path PhysXMeshCache::GetCachePath(uint64_t hash, const char* extension) const {
+        return SR_UTILS_NS::ResourceManager::Instance().GetCachePath()
+            .Concat("PhysX/Meshes")
+            .Concat(SR_FORMAT("{:016x}", hash))
+            .ConcatExt(extension);
+    }
+
+    bool PhysXMeshCache::Load(const SR_UTILS_NS::Path& path, std::vector<uint8_t>& data) {
+        if (!path.Exists(SR_UTILS_NS::Path::Type::File)) {
+            return false;
+        }
+
+        std::ifstream file(path.ToString(), std::ios::binary | std::ios::ate);
+        if (!file.is_open()) {
+            return false;
+        }
+
+        const auto size = static_cast<size_t>(file.tellg());
+        file.seekg(0, std::ios::beg);
+
+        data.resize(size);
+
+        return size > 0 && file.read(reinterpret_cast<char*>(data.data()), static_cast<std::streamsize>(size));
+    }
+
+    void PhysXMeshCache::Save(const SR_UTILS_NS::Path& path, const physx::PxDefaultMemoryOutputStream& stream) {
+        if (!path.GetFolder().CreateIfNotExists()) {
+            SR_ERROR("PhysXMeshCache::Save() : failed to create folder!\n\tPath: " + path.GetFolder().ToString());
+            return;
+        }
+
+        /// written to a temporary file first, a concurrent run never reads a half-written stream
+        const std::string temporary = path.ToString() + ".tmp";
+
+        {
+            std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+            if (!file.is_open()) {
+                SR_ERROR("PhysXMeshCache::Save() : failed to open file!\n\tPath: " + temporary);
+                return;
+            }
+
+            file.write(reinterpret_cast<const char*>(stream.getData()), static_cast<std::streamsize>(stream.getSize()));
+        }
+
+        std::error_code error;
+        std::filesystem::rename(temporary, path.ToString(), error);
+
+        if (error) {
+            SR_ERROR("PhysXMeshCache::Save() : failed to save the mesh!\n\tPath: " + path.ToString() + "\n\tError: " + error.message());
+        }
+    }
+}
@@ -6,28 +6,84 @@
 #include <Physics/PhysX/PhysXLibraryImpl.h>
 #include <Physics/PhysX/PhysXSimulationCallback.h>
 #include <Physics/PhysX/PhysXRaycast3DImpl.h>
+#include <Physics/PhysX/PhysXJobDispatcher.h>
+#include <Physics/PhysX/PhysXChunkAggregates.h>
+#include <Physics/PhysX/PhysXMeshCache.h>
+#include <Physics/3D/CharacterController3D.h>
 
 namespace SR_PHYSICS_NS {
+    /// copied by PhysX into the scene, passed to the shader as the constant block
+    struct FilterShaderData {
+        bool triggersVsStatic = true;
+    };
+
+    /// word0 of the filter data is the layer bit, word1 is the collision mask of the layer, see PhysicsLibrary::GetCollisionMask(),
+    /// word2 holds the contact events of the rigidbody, pairs without listeners are not reported
     physx::PxFilterFlags contactReportFilterShader(physx::PxFilterObjectAttributes attributes0, physx::PxFilterData filterData0,
                                                    physx::PxFilterObjectAttributes attributes1, physx::PxFilterData filterData1,
                                                    physx::PxPairFlags& pairFlags, const void* constantBlock, physx::PxU32 constantBlockSize)
     {
-        PX_UNUSED(attributes0);
-        PX_UNUSED(attributes1);
-        PX_UNUSED(filterData0);
-        PX_UNUSED(filterData1);
-        PX_UNUSED(constantBlockSize);
-        PX_UNUSED(constantBlock);
-
-
-        pairFlags = physx::PxPairFlag::eSOLVE_CONTACT | physx::PxPairFlag::eDETECT_DISCRETE_CONTACT
-                    | physx::PxPairFlag::eNOTIFY_TOUCH_FOUND
-                    | physx::PxPairFlag::eNOTIFY_TOUCH_PERSISTS
-                    | physx::PxPairFlag::eNOTIFY_CONTACT_POINTS
-                    | physx::PxPairFlag::eNOTIFY_TOUCH_LOST;
+        /// shapes without a layer (vehicles, controllers) collide with everything
+        if (filterData0.word0 != 0 && filterData1.word0 != 0) {
+            if (!(filterData0.word0 & filterData1.word1) || !(filterData1.word0 & filterData0.word1)) {
+                return physx::PxFilterFlag::eKILL;
+            }
+        }
+
+        const bool isTrigger0 = physx::PxFilterObjectIsTrigger(attributes0);
+        const bool isTrigger1 = physx::PxFilterObjectIsTrigger(attributes1);
+
+        if (constantBlockSize == sizeof(FilterShaderData) && !static_cast<const FilterShaderData*>(constantBlock)->triggersVsStatic) {
+            const bool isStatic0 = physx::PxGetFilterObjectType(attributes0) == physx::PxFilterObjectType::eRIGID_STATIC;
+            const bool isStatic1 = physx::PxGetFilterObjectType(attributes1) == physx::PxFilterObjectType::eRIGID_STATIC;
+
+            if ((isTrigger0 && isStatic1) || (isTrigger1 && isStatic0)) {
+                return physx::PxFilterFlag::eKILL;
+            }
+        }
+
+        const ContactEventFlags events = filterData0.word2 | filterData1.word2;
+
+        if (isTrigger0 || isTrigger1) {
+            if (!(events & static_cast<ContactEventFlags>(ContactEvent::Trigger))) {
+                return physx::PxFilterFlag::eSUPPRESS;
+            }
+
+            pairFlags = physx::PxPairFlag::eTRIGGER_DEFAULT;
+            return physx::PxFilterFlag::eDEFAULT;
+        }
+
+        pairFlags = physx::PxPairFlag::eSOLVE_CONTACT | physx::PxPairFlag::eDETECT_DISCRETE_CONTACT;
+
+        if (events & static_cast<ContactEventFlags>(ContactEvent::Collision)) {
+            pairFlags |= physx::PxPairFlag::eNOTIFY_TOUCH_FOUND
+                    | physx::PxPairFlag::eNOTIFY_TOUCH_LOST
+                    | physx::PxPairFlag::eNOTIFY_CONTACT_POINTS;
+        }
+
+        if (events & static_cast<ContactEventFlags>(ContactEvent::CollisionStay)) {
+            pairFlags |= physx::PxPairFlag::eNOTIFY_TOUCH_PERSISTS
+                    | physx::PxPairFlag::eNOTIFY_CONTACT_POINTS;
+        }
+
         return physx::PxFilterFlag::eDEFAULT;
     }
 
+    namespace {
+        /// Actors out of the MBP regions are not in the broadphase, they don't collide until they are back.
+        /// The regions cover the world grid around the origin only, large worlds without the origin shift need ABP.
+        class PhysXBroadPhaseCallback final : public physx::PxBroadPhaseCallback {
+        public:
+            void onObjectOutOfBounds(physx::PxShape& shape, physx::PxActor& actor) override {
+                SR_WARN("PhysXBroadPhaseCallback::onObjectOutOfBounds() : an actor is out of the broadphase regions!");
+            }
+
+            void onObjectOutOfBounds(physx::PxAggregate& aggregate) override {
+                SR_WARN("PhysXBroadPhaseCallback::onObjectOutOfBounds() : an aggregate is out of the broadphase regions!");
+            }
+        };
+    }
+
     PhysXPhysicsWorld::PhysXPhysicsWorld(Super::LibraryPtr pLibrary, Space space)
         : Super(pLibrary, space)
     {
@@ -35,15 +91,40 @@ namespace SR_PHYSICS_NS {
     }
 
     PhysXPhysicsWorld::~PhysXPhysicsWorld() {
+        /// the scene can't be released while the workers are simulating it
+        EndStep();
+
+        /// aggregates are objects of the physics, not of the scene
+        SR_SAFE_DELETE_PTR(m_aggregates);
+
+        /// the manager releases the controllers, the components must not release them after it
+        for (auto&& pController : m_characterControllers) {
+            if (auto&& pImpl = pController->GetImpl()) {
+                pImpl->DeInit();
+            }
+        }
+
+        m_characterControllers.clear();
+
+        if (m_controllerManager) {
+            m_controllerManager->release();
+            m_controllerManager = nullptr;
+        }
+
         if (m_scene) {
             m_scene->release();
             m_scene = nullptr;
         }
 
+        SR_SAFE_DELETE_PTR(m_broadPhaseCallback);
+
         if (m_cpuDispatcher) {
             m_cpuDispatcher->release();
             m_cpuDispatcher = nullptr;
         }
+
+        SR_SAFE_DELETE_PTR(m_jobDispatcher);
+
         if (m_contactCallback) {
             delete m_contactCallback;
             m_contactCallback = nullptr;
@@ -53,7 +134,8 @@ namespace SR_PHYSICS_NS {
     bool PhysXPhysicsWorld::Initialize() {
         SR_TRACY_ZONE;
 
-        auto&& pPhysics = GetLibrary<PhysXLibraryImpl>()->GetPxPhysics();
+        auto&& pLibrary = GetLibrary<PhysXLibraryImpl>();
+        auto&& pPhysics = pLibrary->GetPxPhysics();
 
         m_raycast3dImpl = new PhysXRaycast3DImpl(this);
 
@@ -62,11 +144,40 @@ namespace SR_PHYSICS_NS {
         sceneDesc.kineKineFilteringMode = physx::PxPairFilteringMode::eKEEP;
         sceneDesc.staticKineFilteringMode = physx::PxPairFilteringMode::eKEEP;
 
+        auto&& physicsLibrary = PhysicsLibrary::Instance();
+
+        FilterShaderData filterShaderData;
+        filterShaderData.triggersVsStatic = physicsLibrary.IsTriggersVsStaticEnabled();
+
         sceneDesc.filterShader	= contactReportFilterShader;
+        sceneDesc.filterShaderData = &filterShaderData;
+        sceneDesc.filterShaderDataSize = sizeof(FilterShaderData);
+        /// only the moved actors are synchronized, see SynchronizeActive()
+        sceneDesc.flags |= physx::PxSceneFlag::eENABLE_ACTIVE_ACTORS;
         sceneDesc.simulationEventCallback = m_contactCallback;
 
+        switch (pLibrary->GetBroadPhaseType()) {
+            case PhysXBroadPhaseType::SAP:
+                sceneDesc.broadPhaseType = physx::PxBroadPhaseType::eSAP;
+                break;
+            case PhysXBroadPhaseType::MBP:
+                sceneDesc.broadPhaseType = physx::PxBroadPhaseType::eMBP;
+                m_broadPhaseCallback = new PhysXBroadPhaseCallback();
+                sceneDesc.broadPhaseCallback = m_broadPhaseCallback;
+                break;
+            case PhysXBroadPhaseType::ABP:
+            default:
+                sceneDesc.broadPhaseType = physx::PxBroadPhaseType::eABP;
+                break;
+        }
+
+        if (pLibrary->GetDispatcherMode() == PhysXDispatcherMode::JobSystem && physicsLibrary.GetJobScheduler()) {
+            m_jobDispatcher = new PhysXJobDispatcher(physicsLibrary.GetJobScheduler(), physicsLibrary.GetJobWorkersCount());
+            sceneDesc.cpuDispatcher = m_jobDispatcher;
+        }
+
         if (!sceneDesc.cpuDispatcher) {
-            m_cpuDispatcher = physx::PxDefaultCpuDispatcherCreate(1);
+            m_cpuDispatcher = physx::PxDefaultCpuDispatcherCreate(pLibrary->GetDispatcherWorkers());
             sceneDesc.cpuDispatcher = m_cpuDispatcher;
         }
 
@@ -85,6 +196,25 @@ namespace SR_PHYSICS_NS {
 
         m_scene->setGravity(physx::PxVec3(0.f, -SR_EARTH_GRAVITY_CONST, 0.f));
 
+        if (pLibrary->GetBroadPhaseType() == PhysXBroadPhaseType::MBP) {
+            UpdateBroadPhaseRegions();
+
+            const SR_MATH_NS::FVector3 regionSize = pLibrary->GetRegionSize();
+            SR_LOG("PhysXPhysicsWorld::Initialize() : {} MBP regions of {}x{} units.", m_broadPhaseRegions.size(), regionSize.x, regionSize.z);
+        }
+
+        if (pLibrary->IsChunkAggregatesEnabled()) {
+            m_aggregates = new PhysXChunkAggregates(pPhysics, m_scene, pLibrary->GetChunkSize(), pLibrary->GetAggregateMaxActors());
+        }
+
+        if (!(m_controllerManager = PxCreateControllerManager(*m_scene))) {
+            SR_ERROR("PhysXPhysicsWorld::Initialize() : failed to create controller manager!");
+            return false;
+        }
+
+        /// the controllers of a crowd push each other apart instead of getting stuck
+        m_controllerManager->setOverlapRecoveryModule(true);
+
         physx::PxPvdSceneClient* pPvdClient = m_scene->getScenePvdClient();
         
         if (pPvdClient) {
@@ -103,56 +233,302 @@ namespace SR_PHYSICS_NS {
 
     bool PhysXPhysicsWorld::Synchronize() {
         SR_TRACY_ZONE;
-        return SynchronizeDynamic() && SynchronizeStatic();
+        const bool result = SynchronizeActive() && SynchronizeDirty();
+
+        const auto start = std::chrono::steady_clock::now();
+
+        /// the controllers report their hits by the synchronization as well
+        SynchronizeCharacterControllers();
+
+        /// the components see the synchronized transforms
+        m_contactCallback->Dispatch();
+
+        m_statistics.callbackTime += std::chrono::duration<double_t, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        return result;
+    }
+
+    PhysicsStatistics PhysXPhysicsWorld::GetStatistics() const {
+        PhysicsStatistics statistics = Super::GetStatistics();
+
+        if (!m_scene || m_isSimulating) {
+            return statistics;
+        }
+
+        physx::PxSimulationStatistics simulationStatistics;
+        m_scene->getSimulationStatistics(simulationStatistics);
+
+        statistics.activeBodies = simulationStatistics.nbActiveDynamicBodies + simulationStatistics.nbActiveKinematicBodies;
+        statistics.staticBodies = simulationStatistics.nbStaticBodies;
+        statistics.sleepingBodies = simulationStatistics.nbDynamicBodies - simulationStatistics.nbActiveDynamicBodies;
+        statistics.broadPhasePairs = simulationStatistics.nbDiscreteContactPairsTotal;
+        statistics.contacts = simulationStatistics.nbDiscreteContactPairsWithContacts;
+        statistics.islands = simulationStatistics.nbPartitions;
+
+        if (auto&& pMeshCache = GetLibrary<PhysXLibraryImpl>()->GetMeshCache()) {
+            const double_t cookingTime = pMeshCache->GetStatistics().cookingTime;
+            statistics.cookingTime = SR_MAX(cookingTime - m_cookingTime, 0.0);
+            m_cookingTime = cookingTime;
+        }
+
+        return statistics;
     }
 
     bool PhysXPhysicsWorld::StepSimulation(float_t step) {
         SR_TRACY_ZONE;
+        return BeginStep(step) && EndStep();
+    }
+
+    bool PhysXPhysicsWorld::BeginStep(float_t step) {
+        SR_TRACY_ZONE;
 
         if (!m_scene) {
             return false;
         }
 
-        m_scene->simulate(step);
+        if (m_isSimulating) {
+            SRHalt("PhysXPhysicsWorld::BeginStep() : the previous step is not ended!");
+            EndStep();
+        }
 
-        if (!m_scene->fetchResults(true)) {
-            SR_ERROR("PhysXPhysicsWorld::StepSimulation() : failed to fetch results!");
+        if (!m_scene->simulate(step)) {
+            SR_ERROR("PhysXPhysicsWorld::BeginStep() : failed to start simulation!");
             return false;
         }
 
+        m_isSimulating = true;
+
+        return true;
+    }
+
+    bool PhysXPhysicsWorld::EndStep() {
+        SR_TRACY_ZONE;
+
+        if (!m_isSimulating) {
+            return true;
+        }
+
+        /// queries may run concurrently with simulate(), but not with fetchResults()
+        {
+            std::unique_lock<std::shared_mutex> lock(m_queryMutex);
+
+            m_contactCallback->BeginStep();
+
+            if (!m_scene->fetchResults(true)) {
+                SR_ERROR("PhysXPhysicsWorld::EndStep() : failed to fetch results!");
+                return false;
+            }
+        }
+
+        m_isSimulating = false;
+        m_hasNewState = true;
+
         return true;
     }
 
     bool PhysXPhysicsWorld::AddRigidbody(PhysicsWorld::RigidbodyPtr pRigidbody) {
-        if (!pRigidbody) {
-            SRHalt("pRigidbody is nullptr!");
-            return false;
+        return AddRigidbodies({ pRigidbody });
+    }
+
+    bool PhysXPhysicsWorld::RemoveRigidbody(PhysicsWorld::RigidbodyPtr pRigidbody) {
+        return RemoveRigidbodies({ pRigidbody });
+    }
+
+    bool PhysXPhysicsWorld::AddRigidbodies(const std::vector<RigidbodyPtr>& rigidbodies) {
+        SR_TRACY_ZONE;
+
+        m_batchActors.clear();
+
+        for (auto&& pRigidbody : rigidbodies) {
+            if (!pRigidbody) {
+                SRHalt("pRigidbody is nullptr!");
+                continue;
+            }
+
+            if (pRigidbody->IsBodyDirty()) {
+                pRigidbody->InitBody();
+            }
+
+            if (auto&& pActor = (physx::PxActor*)(pRigidbody->GetHandle())) {
+                if (auto&& pStatic = pActor->is<physx::PxRigidStatic>(); pStatic && m_aggregates) {
+                    m_aggregates->Add(pStatic);
+                }
+                else {
+                    m_batchActors.emplace_back(pActor);
+                }
+            }
+
+            /// the transform could be moved while the rigidbody was not in the world
+            MarkDirty(pRigidbody);
         }
 
-        if (pRigidbody->IsBodyDirty()) {
-            pRigidbody->InitBody();
+        if (!m_batchActors.empty()) {
+            m_scene->addActors(m_batchActors.data(), static_cast<physx::PxU32>(m_batchActors.size()));
+            m_batchActors.clear();
         }
 
-        if (auto&& pActor = (physx::PxActor*)(pRigidbody->GetHandle())) {
-            m_scene->addActor(*pActor);
+        if (m_aggregates) {
+            m_aggregates->Commit();
         }
 
         return true;
     }
 
-    bool PhysXPhysicsWorld::RemoveRigidbody(PhysicsWorld::RigidbodyPtr pRigidbody) {
-        if (!pRigidbody) {
-            SRHalt("pRigidbody is nullptr!");
-            return false;
+    bool PhysXPhysicsWorld::RemoveRigidbodies(const std::vector<RigidbodyPtr>& rigidbodies) {
+        SR_TRACY_ZONE;
+
+        m_batchActors.clear();
+        m_batchAggregated.clear();
+        m_batchRigidbodies.clear();
+
+        for (auto&& pRigidbody : rigidbodies) {
+            if (!pRigidbody) {
+                SRHalt("pRigidbody is nullptr!");
+                continue;
+            }
+
+            if (auto&& pActor = (physx::PxActor*)(pRigidbody->GetHandle())) {
+                if (pActor->getAggregate() && m_aggregates) {
+                    m_batchAggregated.emplace_back(pActor->is<physx::PxRigidActor>());
+                }
+                else if (pActor->getScene() == m_scene) {
+                    m_batchActors.emplace_back(pActor);
+                }
+            }
+
+            UnmarkDirty(pRigidbody);
+            m_contactCallback->Remove(pRigidbody);
+            m_batchRigidbodies.emplace_back(pRigidbody);
+        }
+
+        if (!m_batchActors.empty()) {
+            m_scene->removeActors(m_batchActors.data(), static_cast<physx::PxU32>(m_batchActors.size()));
+            m_batchActors.clear();
+        }
+
+        if (!m_batchAggregated.empty()) {
+            m_aggregates->Remove(m_batchAggregated);
+            m_batchAggregated.clear();
         }
 
-        if (auto&& pActor = (physx::PxActor*)(pRigidbody->GetHandle())) {
-            m_scene->removeActor(*pActor);
+        /// a single pass over the moved rigidbodies for the whole batch
+        std::sort(m_batchRigidbodies.begin(), m_batchRigidbodies.end());
+
+        auto&& isRemoved = [this](RigidbodyPtr pRigidbody) {
+            return std::binary_search(m_batchRigidbodies.begin(), m_batchRigidbodies.end(), pRigidbody);
+        };
+
+        std::erase_if(m_movedRigidbodies, isRemoved);
+        std::erase_if(m_previousMovedRigidbodies, isRemoved);
+
+        for (auto&& pController : m_characterControllers) {
+            pController->RemoveHits(m_batchRigidbodies);
         }
 
+        m_batchRigidbodies.clear();
+
         return true;
     }
 
+    void PhysXPhysicsWorld::UpdateBroadPhaseRegions() {
+        auto&& pLibrary = GetLibrary<PhysXLibraryImpl>();
+
+        const SR_MATH_NS::FVector3 regionSize = pLibrary->GetRegionSize();
+        const int32_t regions = static_cast<int32_t>(pLibrary->GetBroadPhaseRegions());
+
+        /// the cell of the local origin in the unshifted grid
+        const int32_t firstX = static_cast<int32_t>(std::floor(-m_broadPhaseShift.x / regionSize.x)) - regions / 2;
+        const int32_t firstZ = static_cast<int32_t>(std::floor(-m_broadPhaseShift.z / regionSize.z)) - regions / 2;
+
+        auto&& makeKey = [](int32_t x, int32_t z) -> uint64_t {
+            return (static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32) | static_cast<uint64_t>(static_cast<uint32_t>(z));
+        };
+
+        /// PhysX limits the count of the regions, the ones left behind are removed first
+        for (auto pIt = m_broadPhaseRegions.begin(); pIt != m_broadPhaseRegions.end(); ) {
+            const auto x = static_cast<int32_t>(static_cast<uint32_t>(pIt->first >> 32));
+            const auto z = static_cast<int32_t>(static_cast<uint32_t>(pIt->first));
+
+            if (x >= firstX && x < firstX + regions && z >= firstZ && z < firstZ + regions) {
+                ++pIt;
+                continue;
+            }
+
+            m_scene->removeBroadPhaseRegion(pIt->second);
+            pIt = m_broadPhaseRegions.erase(pIt);
+        }
+
+        for (int32_t x = firstX; x < firstX + regions; ++x) {
+            for (int32_t z = firstZ; z < firstZ + regions; ++z) {
+                const uint64_t key = makeKey(x, z);
+
+                if (m_broadPhaseRegions.count(key) > 0) {
+                    continue;
+                }
+
+                physx::PxBroadPhaseRegion region;
+
+                region.bounds = physx::PxBounds3(
+                    physx::PxVec3(static_cast<float_t>(x) * regionSize.x, -regionSize.y, static_cast<float_t>(z) * regionSize.z),
+                    physx::PxVec3(static_cast<float_t>(x + 1) * regionSize.x, regionSize.y, static_cast<float_t>(z + 1) * regionSize.z)
+                );
+                region.bounds.minimum += SR_PHYSICS_UTILS_NS::FV3ToPxV3(m_broadPhaseShift);
+                region.bounds.maximum += SR_PHYSICS_UTILS_NS::FV3ToPxV3(m_broadPhaseShift);
+                region.userData = nullptr;
+
+                /// the actors already in the scene are put into the new region, otherwise they stay out of the broadphase
+                const uint32_t handle = m_scene->addBroadPhaseRegion(region, true);
+                if (handle == 0xffffffff) {
+                    SR_ERROR("PhysXPhysicsWorld::UpdateBroadPhaseRegions() : failed to add a region!");
+                    return;
+                }
+
+                m_broadPhaseRegions[key] = handle;
+            }
+        }
+    }
+
+    void PhysXPhysicsWorld::ShiftOrigin(const SR_MATH_NS::FVector3& shift) {
+        SR_TRACY_ZONE;
+
+        if (!m_scene) {
+            return;
+        }
+
+        if (m_isSimulating) {
+            SRHalt("PhysXPhysicsWorld::ShiftOrigin() : the step is not ended!");
+            EndStep();
+        }
+
+        {
+            std::unique_lock<std::shared_mutex> lock(m_queryMutex);
+
+            /// PhysX moves the origin itself, the objects go the opposite way
+            m_scene->shiftOrigin(physx::PxVec3(-shift.x, -shift.y, -shift.z));
+
+            /// the controllers keep their positions apart from the kinematic actors
+            if (m_controllerManager) {
+                m_controllerManager->shiftOrigin(physx::PxVec3(-shift.x, -shift.y, -shift.z));
+            }
+
+            if (!m_broadPhaseRegions.empty()) {
+                m_broadPhaseShift += shift;
+                UpdateBroadPhaseRegions();
+            }
+        }
+
+        if (m_aggregates) {
+            m_aggregates->ShiftOrigin(shift);
+        }
+
+        /// the static and the sleeping actors are moved by PhysX and are not visited at all
+        CatchUpOrigin(m_movedRigidbodies, m_previousMovedRigidbodies);
+
+        for (auto&& pController : m_characterControllers) {
+            pController->ShiftOrigin(shift);
+        }
+    }
+
     void PhysXPhysicsWorld::Flush() {
         SR_TRACY_ZONE;
 
@@ -160,29 +536,34 @@ namespace SR_PHYSICS_NS {
         PhysicsWorld::Flush();
     }
 
-    bool PhysXPhysicsWorld::SynchronizeStatic() {
+    bool PhysXPhysicsWorld::SynchronizeActive() {
         SR_TRACY_ZONE;
 
-        const uint32_t count = m_scene->getNbActors(physx::PxActorTypeFlag::Enum::eRIGID_STATIC);
-        if (count == 0) {
+        /// without a new step the active actors are the same, the interpolation states must not be pushed twice
+        if (!m_hasNewState.exchange(false)) {
             return true;
         }
 
-        if (m_staticActors.size() < count) {
-            m_staticActors.resize(count);
-        }
+        const bool isInterpolated = IsInterpolationEnabled();
 
-        auto&& pActors = m_staticActors.data();
-        m_scene->getActors(physx::PxActorTypeFlag::Enum::eRIGID_STATIC, pActors, count);
+        uint32_t count = 0;
+        auto&& pActiveActors = m_scene->getActiveActors(count);
 
-        for (uint32_t i = 0; i < count; ++i) {
-            auto&& pRigidActor = pActors[i]->is<physx::PxRigidActor>();
-            if (!SRVerifyFalse(!pRigidActor)) {
+        /// the buffer of the scene is invalidated by re-adding of an actor
+        m_activeActors.assign(pActiveActors, pActiveActors + count);
+
+        m_movedRigidbodies.swap(m_previousMovedRigidbodies);
+        m_movedRigidbodies.clear();
+
+        for (auto&& pActor : m_activeActors) {
+            auto&& pRigidActor = pActor->is<physx::PxRigidActor>();
+            if (!pRigidActor) {
                 continue;
             }
 
+            /// the kinematic actors of the controllers have no rigidbody, see SynchronizeCharacterControllers()
             auto&& pRigidbody = (SR_PTYPES_NS::Rigidbody*)pRigidActor->userData;
-            if (!SRVerifyFalse(!pRigidbody)) {
+            if (!pRigidbody) {
                 continue;
             }
 
@@ -196,37 +577,36 @@ namespace SR_PHYSICS_NS {
                 continue;
             }
 
-            if (pRigidbody->IsMatrixDirty()) {
-                pRigidbody->UpdateMatrix();
+            pRigidbody->Synchronize(isInterpolated);
+            m_movedRigidbodies.emplace_back(pRigidbody);
+        }
+
+        if (!isInterpolated) {
+            return true;
+        }
+
+        /// bodies that fell asleep are not interpolated anymore, they are left at their last simulated state
+        std::sort(m_movedRigidbodies.begin(), m_movedRigidbodies.end());
+
+        for (auto&& pRigidbody : m_previousMovedRigidbodies) {
+            if (!std::binary_search(m_movedRigidbodies.begin(), m_movedRigidbodies.end(), pRigidbody)) {
+                pRigidbody->Interpolate(1.f);
             }
         }
 
         return true;
     }
 
-    bool PhysXPhysicsWorld::SynchronizeDynamic() {
+    bool PhysXPhysicsWorld::SynchronizeDirty() {
         SR_TRACY_ZONE;
 
-        const uint32_t count = m_scene->getNbActors(physx::PxActorTypeFlag::Enum::eRIGID_DYNAMIC);
-        if (count == 0) {
-            return true;
-        }
-
-        if (m_dynamicActors.size() < count) {
-            m_dynamicActors.resize(count);
-        }
+        const bool isInterpolated = IsInterpolationEnabled();
 
-        auto&& pActors = m_dynamicActors.data();
-        m_scene->getActors(physx::PxActorTypeFlag::Enum::eRIGID_DYNAMIC, pActors, count);
+        for (auto&& pRigidbody : TakeDirtyRigidbodies()) {
+            auto&& pActor = (physx::PxActor*)pRigidbody->GetHandle();
 
-        for (uint32_t i = 0; i < count; ++i) {
-            auto&& pRigidActor = pActors[i]->is<physx::PxRigidActor>();
-            if (!SRVerifyFalse(!pRigidActor)) {
-                continue;
-            }
-
-            auto&& pRigidbody = (SR_PTYPES_NS::Rigidbody*)pRigidActor->userData;
-            if (!SRVerifyFalse(!pRigidbody)) {
+            /// registered, but not flushed yet, AddRigidbody() queues it again
+            if (!pActor || pActor->getScene() != m_scene) {
                 continue;
             }
 
@@ -240,12 +620,123 @@ namespace SR_PHYSICS_NS {
                 continue;
             }
 
-            pRigidbody->Synchronize();
+            if (!pRigidbody->IsMatrixDirty()) {
+                continue;
+            }
+
+            /// the transform was moved by the engine, dynamic bodies are teleported by the synchronization
+            if (pActor->is<physx::PxRigidDynamic>()) {
+                pRigidbody->Synchronize(isInterpolated);
+            }
+            else {
+                pRigidbody->UpdateMatrix();
+            }
         }
 
         return true;
     }
 
+    bool PhysXPhysicsWorld::AddCharacterController(CharacterControllerPtr pController) {
+        if (!pController || !pController->GetImpl()) {
+            SRHalt("PhysXPhysicsWorld::AddCharacterController() : invalid controller!");
+            return false;
+        }
+
+        if (std::find(m_characterControllers.begin(), m_characterControllers.end(), pController) != m_characterControllers.end()) {
+            return true;
+        }
+
+        /// creating a controller adds its actor to the scene
+        if (m_isSimulating) {
+            SRHalt("PhysXPhysicsWorld::AddCharacterController() : the step is not ended!");
+            EndStep();
+        }
+
+        if (!pController->GetImpl()->Init(this)) {
+            SR_ERROR("PhysXPhysicsWorld::AddCharacterController() : failed to initialize controller!");
+            return false;
+        }
+
+        m_characterControllers.emplace_back(pController);
+
+        return true;
+    }
+
+    bool PhysXPhysicsWorld::RemoveCharacterController(CharacterControllerPtr pController) {
+        auto&& pIt = std::find(m_characterControllers.begin(), m_characterControllers.end(), pController);
+        if (pIt == m_characterControllers.end()) {
+            return false;
+        }
+
+        if (m_isSimulating) {
+            SRHalt("PhysXPhysicsWorld::RemoveCharacterController() : the step is not ended!");
+            EndStep();
+        }
+
+        m_characterControllers.erase(pIt);
+
+        if (auto&& pImpl = pController->GetImpl()) {
+            pImpl->DeInit();
+        }
+
+        return true;
+    }
+
+    void PhysXPhysicsWorld::MoveCharacterControllers(float_t step) {
+        SR_TRACY_ZONE;
+
+        if (m_characterControllers.empty()) {
+            return;
+        }
+
+        if (m_isSimulating) {
+            SRHalt("PhysXPhysicsWorld::MoveCharacterControllers() : the step is not ended!");
+            EndStep();
+        }
+
+        /// the moves are sweeps of the scene and writes of the kinematic actors
+        std::unique_lock<std::shared_mutex> lock(m_queryMutex);
+
+        m_controllerManager->computeInteractions(step);
+
+        for (auto&& pController : m_characterControllers) {
+            pController->PrepareMove(step);
+        }
+    }
+
+    void PhysXPhysicsWorld::SynchronizeCharacterControllers() {
+        SR_TRACY_ZONE;
+
+        for (auto&& pController : m_characterControllers) {
+            pController->Synchronize();
+        }
+    }
+
+    void PhysXPhysicsWorld::Interpolate(float_t alpha) {
+        SR_TRACY_ZONE;
+
+        if (!IsInterpolationEnabled()) {
+            return;
+        }
+
+        for (auto&& pRigidbody : m_movedRigidbodies) {
+            pRigidbody->Interpolate(alpha);
+        }
+    }
+
+    void PhysXPhysicsWorld::RestoreSimulatedPoses() {
+        SR_TRACY_ZONE;
+
+        /// the bodies that fell asleep are interpolated to their last state by the synchronization, they are restored too
+        for (auto&& pRigidbody : m_movedRigidbodies) {
+            pRigidbody->RestoreSimulatedPose();
+        }
+
+        for (auto&& pRigidbody : m_previousMovedRigidbodies) {
+            pRigidbody->RestoreSimulatedPose();
+        }
+    }
+
     void PhysXPhysicsWorld::ForEachRigidbody3D(const SR_HTYPES_NS::Function<void(SR_PTYPES_NS::Rigidbody3D *)> &fun) {
         static const physx::PxActorTypeFlags flags =
                 physx::PxActorTypeFlag::Enum::eRIGID_DYNAMIC |
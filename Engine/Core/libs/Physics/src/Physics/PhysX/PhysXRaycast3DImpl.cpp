@@ -3,62 +3,298 @@
 //
 
 #include <Physics/PhysX/PhysXRaycast3DImpl.h>
+#include <Physics/PhysX/PhysXPhysicsWorld.h>
+#include <Physics/3D/Raycast3D.h>
 
 #include <Utils/ECS/GameObject.h>
 
 namespace SR_PHYSICS_NS {
-    PhysXRaycast3DImpl::RaycastHits PhysXRaycast3DImpl::Cast(const SR_MATH_NS::FVector3 &origin, const SR_MATH_NS::FVector3 &direction, float_t maxDistance, uint32_t maxHits) {
-        RaycastHits hits;
-        hits.reserve(maxHits);
+    namespace {
+        /// touches are processed by blocks of this size, the nearest maxHits of them are kept
+        constexpr uint32_t RaycastTouchesBlock = 32;
 
-        m_world->ForEachRigidbody3D([&](SR_PTYPES_NS::Rigidbody3D* pRigidbody){
-            if (hits.size() == maxHits){
-                return;
-            }
+        uint32_t GetTagHash(SR_UTILS_NS::StringAtom tag) {
+            /// zero is reserved for "no filter data", shapes created before the filter data was set pass any tag filter
+            return tag.ToStringRef().empty() ? 0 : SR_MAX(static_cast<uint32_t>(tag.GetHash()), 1u);
+        }
+
+        class PhysXRaycastFilterCallback : public physx::PxQueryFilterCallback {
+        public:
+            PhysXRaycastFilterCallback(const physx::PxVec3& origin, const RaycastFilter& filter, physx::PxQueryHitType::Enum hitType, bool skipOrigin = true)
+                : m_origin(origin)
+                , m_layerMask(filter.layerMask)
+                , m_tag(GetTagHash(filter.tag))
+                , m_hitType(hitType)
+                , m_skipOrigin(skipOrigin)
+            { }
+
+            physx::PxQueryHitType::Enum preFilter(const physx::PxFilterData& filterData, const physx::PxShape* pShape,
+                    const physx::PxRigidActor* pActor, physx::PxHitFlags& queryFlags) override
+            {
+                const physx::PxFilterData shapeData = pShape->getQueryFilterData();
+
+                if (shapeData.word0 != 0 && (shapeData.word0 & m_layerMask) == 0) {
+                    return physx::PxQueryHitType::eNONE;
+                }
 
-            physx::PxTransform pose = ((physx::PxRigidActor*)pRigidbody->GetHandle())->getGlobalPose();
+                if (m_tag != 0 && shapeData.word1 != m_tag) {
+                    return physx::PxQueryHitType::eNONE;
+                }
+
+                /// the ray is cast from the center of the body, which would always hit itself
+                if (m_skipOrigin && pActor->getGlobalPose().p == m_origin) {
+                    return physx::PxQueryHitType::eNONE;
+                }
+
+                return m_hitType;
+            }
 
-            if (pose.p == SR_PHYSICS_UTILS_NS::FV3ToPxV3(origin)){
-                return;
+            physx::PxQueryHitType::Enum postFilter(const physx::PxFilterData& filterData, const physx::PxQueryHit& hit) override {
+                return m_hitType;
             }
 
-            physx::PxShape* pShape = ((physx::PxShape*)pRigidbody->GetCollisionShape()->GetHandle());
+        private:
+            physx::PxVec3 m_origin;
+            uint32_t m_layerMask = RaycastFilter::AllLayers;
+            uint32_t m_tag = 0;
+            physx::PxQueryHitType::Enum m_hitType = physx::PxQueryHitType::eTOUCH;
+            bool m_skipOrigin = true;
 
-            if (!pShape) {
-                if (auto&& gameObject = pRigidbody->GetGameObject()) {
-                    SRHaltOnce("PhysXRaycast3DImpl::Cast() : " + gameObject->GetName().ToStringRef() + " does not have a collision shape!");
+        };
+
+        /// Keeps the nearest hits only, PhysX reports touches in the order of the traversal. Overlaps have no distance and keep the first ones.
+        template<typename HitType> class PhysXHitCollector : public physx::PxHitCallback<HitType> {
+            using Super = physx::PxHitCallback<HitType>;
+        public:
+            explicit PhysXHitCollector(uint32_t maxHits)
+                : Super(m_block.data(), RaycastTouchesBlock)
+                , m_maxHits(maxHits)
+            { }
+
+            physx::PxAgain processTouches(const HitType* pBuffer, physx::PxU32 count) override {
+                for (physx::PxU32 i = 0; i < count; ++i) {
+                    m_hits.emplace_back(pBuffer[i]);
+                }
+
+                SortAndShrink();
+
+                if constexpr (std::is_same_v<HitType, physx::PxOverlapHit>) {
+                    return m_hits.size() < m_maxHits;
                 }
                 else {
-                    SRHaltOnce("PhysXRaycast3DImpl::Cast() : rigidbody does not have a collision shape!");
+                    return true;
                 }
-                return;
             }
 
-            physx::PxRaycastHit pxHit;
-            physx::PxU32 hitCount = physx::PxGeometryQuery::raycast(
-                    SR_PHYSICS_UTILS_NS::FV3ToPxV3(origin),
-                    SR_PHYSICS_UTILS_NS::FV3ToPxV3(direction),
-                    pShape->getGeometry().any(),
-                    pose,
-                    maxDistance,
-                    physx::PxHitFlag::eDEFAULT,
-                    1,
-                    &pxHit
-            );
-
-            if (hitCount == 0){
-                return;
+            SR_NODISCARD std::vector<HitType>& GetHits() {
+                SortAndShrink();
+                return m_hits;
             }
 
+        private:
+            void SortAndShrink() {
+                if constexpr (std::is_same_v<HitType, physx::PxOverlapHit>) {
+                    if (m_hits.size() > m_maxHits) {
+                        m_hits.resize(m_maxHits);
+                    }
+                }
+                else {
+                    auto&& compare = [](const HitType& a, const HitType& b) {
+                        return a.distance < b.distance;
+                    };
+
+                    if (m_hits.size() > m_maxHits) {
+                        std::partial_sort(m_hits.begin(), m_hits.begin() + m_maxHits, m_hits.end(), compare);
+                        m_hits.resize(m_maxHits);
+                    }
+                    else {
+                        std::sort(m_hits.begin(), m_hits.end(), compare);
+                    }
+                }
+            }
+
+        private:
+            std::array<HitType, RaycastTouchesBlock> m_block;
+            std::vector<HitType> m_hits;
+            uint32_t m_maxHits = 1;
+
+        };
+
+        using PhysXRaycastCollector = PhysXHitCollector<physx::PxRaycastHit>;
+
+        SR_UTILS_NS::RaycastHit ToRaycastHit(const physx::PxLocationHit& pxHit) {
             SR_UTILS_NS::RaycastHit hit;
-            hit.pHandler = dynamic_cast<SR_PTYPES_NS::Rigidbody*>(pRigidbody);
+            hit.pHandler = pxHit.actor ? static_cast<SR_PTYPES_NS::Rigidbody*>(pxHit.actor->userData) : nullptr;
             hit.distance = pxHit.distance;
             hit.normal = SR_PHYSICS_UTILS_NS::PxV3ToFV3(pxHit.normal);
             hit.position = SR_PHYSICS_UTILS_NS::PxV3ToFV3(pxHit.position);
+            return hit;
+        }
 
-            hits.emplace_back(hit);
-        });
+        SR_UTILS_NS::RaycastHit ToRaycastHit(const physx::PxOverlapHit& pxHit) {
+            SR_UTILS_NS::RaycastHit hit;
+            hit.pHandler = pxHit.actor ? static_cast<SR_PTYPES_NS::Rigidbody*>(pxHit.actor->userData) : nullptr;
+            hit.distance = 0.f;
+            hit.position = pxHit.actor ? SR_PHYSICS_UTILS_NS::PxV3ToFV3(pxHit.actor->getGlobalPose().p) : SR_MATH_NS::FVector3();
+            return hit;
+        }
+
+        physx::PxGeometryHolder ToPxGeometry(const SceneQueryGeometry& geometry) {
+            switch (geometry.shape) {
+                case SceneQueryShape::Capsule:
+                    return physx::PxGeometryHolder(physx::PxCapsuleGeometry(geometry.radius, geometry.halfHeight));
+                case SceneQueryShape::Box:
+                    return physx::PxGeometryHolder(physx::PxBoxGeometry(SR_PHYSICS_UTILS_NS::FV3ToPxV3(geometry.halfExtents)));
+                case SceneQueryShape::Sphere:
+                default:
+                    return physx::PxGeometryHolder(physx::PxSphereGeometry(geometry.radius));
+            }
+        }
+
+        physx::PxTransform ToPxPose(const SceneQueryGeometry& geometry, const SR_MATH_NS::FVector3& position) {
+            /// PhysX capsules lie along the X axis, the same rotation as for the capsule colliders
+            SR_MATH_NS::Quaternion q = geometry.rotation;
+            if (geometry.shape == SceneQueryShape::Capsule) {
+                q = q.RotateZ(90);
+            }
+
+            return physx::PxTransform(SR_PHYSICS_UTILS_NS::FV3ToPxV3(position), physx::PxQuat(q.X(), q.Y(), q.Z(), q.W()));
+        }
+
+        template<typename HitType> void StoreHits(PhysXHitCollector<HitType>& collector, SceneQueryBatch3D& batch, uint32_t index) {
+            auto&& pxHits = collector.GetHits();
+            auto&& pHits = batch.GetHitsBuffer(index);
+            const auto count = static_cast<uint32_t>(SR_MIN(pxHits.size(), static_cast<size_t>(batch.GetMaxHitsPerQuery())));
+
+            for (uint32_t i = 0; i < count; ++i) {
+                pHits[i] = ToRaycastHit(pxHits[i]);
+            }
+
+            batch.SetHitsCount(index, count);
+        }
+    }
+
+    PhysXRaycast3DImpl::RaycastHits PhysXRaycast3DImpl::Cast(const SR_MATH_NS::FVector3 &origin, const SR_MATH_NS::FVector3 &direction, float_t maxDistance, uint32_t maxHits, const RaycastFilter& filter) {
+        SR_TRACY_ZONE;
+
+        RaycastHits hits;
+
+        auto&& pWorld = static_cast<PhysXPhysicsWorld*>(m_world);
+        auto&& pScene = pWorld->GetPxScene();
+
+        const physx::PxVec3 unitDirection = SR_PHYSICS_UTILS_NS::FV3ToPxV3(direction).getNormalized();
+        if (!pScene || unitDirection.isZero() || maxDistance <= 0.f) {
+            return hits;
+        }
+
+        const physx::PxVec3 pxOrigin = SR_PHYSICS_UTILS_NS::FV3ToPxV3(origin);
+
+        /// every hit is a touch, so PhysX does not stop at the first blocking shape
+        PhysXRaycastFilterCallback filterCallback(pxOrigin, filter, physx::PxQueryHitType::eTOUCH);
+        PhysXRaycastCollector collector(maxHits);
+
+        const physx::PxQueryFilterData filterData(physx::PxQueryFlag::eSTATIC | physx::PxQueryFlag::eDYNAMIC | physx::PxQueryFlag::ePREFILTER);
+
+        {
+            std::shared_lock<std::shared_mutex> lock(pWorld->GetQueryMutex());
+            pScene->raycast(pxOrigin, unitDirection, maxDistance, collector, physx::PxHitFlag::eDEFAULT, filterData, &filterCallback);
+        }
+
+        auto&& pxHits = collector.GetHits();
+        hits.reserve(pxHits.size());
+
+        for (auto&& pxHit : pxHits) {
+            hits.emplace_back(ToRaycastHit(pxHit));
+        }
 
         return hits;
     }
-}
\ No newline at end of file
+
+    bool PhysXRaycast3DImpl::CastAny(const SR_MATH_NS::FVector3 &origin, const SR_MATH_NS::FVector3 &direction, float_t maxDistance, const RaycastFilter& filter) {
+        SR_TRACY_ZONE;
+
+        auto&& pWorld = static_cast<PhysXPhysicsWorld*>(m_world);
+        auto&& pScene = pWorld->GetPxScene();
+
+        const physx::PxVec3 unitDirection = SR_PHYSICS_UTILS_NS::FV3ToPxV3(direction).getNormalized();
+        if (!pScene || unitDirection.isZero() || maxDistance <= 0.f) {
+            return false;
+        }
+
+        const physx::PxVec3 pxOrigin = SR_PHYSICS_UTILS_NS::FV3ToPxV3(origin);
+
+        PhysXRaycastFilterCallback filterCallback(pxOrigin, filter, physx::PxQueryHitType::eBLOCK);
+        physx::PxRaycastBuffer buffer;
+
+        const physx::PxQueryFilterData filterData(physx::PxQueryFlag::eSTATIC | physx::PxQueryFlag::eDYNAMIC |
+            physx::PxQueryFlag::ePREFILTER | physx::PxQueryFlag::eANY_HIT);
+
+        std::shared_lock<std::shared_mutex> lock(pWorld->GetQueryMutex());
+
+        return pScene->raycast(pxOrigin, unitDirection, maxDistance, buffer, physx::PxHitFlag::eDEFAULT, filterData, &filterCallback);
+    }
+
+    bool PhysXRaycast3DImpl::Execute(SceneQueryBatch3D& batch, const SceneQueryParallelFor& parallelFor) {
+        SR_TRACY_ZONE;
+
+        auto&& pWorld = static_cast<PhysXPhysicsWorld*>(m_world);
+        auto&& pScene = pWorld->GetPxScene();
+
+        if (!pScene) {
+            return false;
+        }
+
+        const uint32_t maxHits = batch.GetMaxHitsPerQuery();
+
+        const physx::PxQueryFilterData filterData(physx::PxQueryFlag::eSTATIC | physx::PxQueryFlag::eDYNAMIC | physx::PxQueryFlag::ePREFILTER);
+
+        /// PxScene queries are safe to run concurrently while nothing writes to the scene, the lock keeps fetchResults() away
+        std::shared_lock<std::shared_mutex> lock(pWorld->GetQueryMutex());
+
+        parallelFor(batch.GetQueriesCount(), 16, [&](uint32_t begin, uint32_t end) {
+            for (uint32_t index = begin; index < end; ++index) {
+                auto&& query = batch.GetQuery(index);
+
+                const physx::PxVec3 pxOrigin = SR_PHYSICS_UTILS_NS::FV3ToPxV3(query.origin);
+
+                if (query.type == SceneQueryType::Overlap) {
+                    PhysXRaycastFilterCallback filterCallback(pxOrigin, query.filter, physx::PxQueryHitType::eTOUCH, false);
+                    PhysXHitCollector<physx::PxOverlapHit> collector(maxHits);
+
+                    pScene->overlap(ToPxGeometry(query.geometry).any(), ToPxPose(query.geometry, query.origin), collector, filterData, &filterCallback);
+
+                    StoreHits(collector, batch, index);
+                    continue;
+                }
+
+                const physx::PxVec3 unitDirection = SR_PHYSICS_UTILS_NS::FV3ToPxV3(query.direction).getNormalized();
+                if (unitDirection.isZero() || query.maxDistance <= 0.f) {
+                    continue;
+                }
+
+                PhysXRaycastFilterCallback filterCallback(pxOrigin, query.filter, physx::PxQueryHitType::eTOUCH);
+
+                if (query.type == SceneQueryType::Raycast) {
+                    PhysXRaycastCollector collector(maxHits);
+                    pScene->raycast(pxOrigin, unitDirection, query.maxDistance, collector, physx::PxHitFlag::eDEFAULT, filterData, &filterCallback);
+                    StoreHits(collector, batch, index);
+                }
+                else {
+                    PhysXHitCollector<physx::PxSweepHit> collector(maxHits);
+                    pScene->sweep(ToPxGeometry(query.geometry).any(), ToPxPose(query.geometry, query.origin), unitDirection, query.maxDistance,
+                        collector, physx::PxHitFlag::eDEFAULT, filterData, &filterCallback);
+                    StoreHits(collector, batch, index);
+                }
+            }
+        });
+
+        return true;
+    }
+
+    physx::PxFilterData PhysXRaycast3DImpl::MakeQueryFilterData(SR_UTILS_NS::StringAtom layer, SR_UTILS_NS::StringAtom tag) {
+        physx::PxFilterData filterData;
+        filterData.word0 = Raycast3D::GetLayerMask(layer);
+        filterData.word1 = GetTagHash(tag);
+        return filterData;
+    }
+}
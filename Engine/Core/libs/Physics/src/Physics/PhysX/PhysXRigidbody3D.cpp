@@ -190,7 +190,10 @@ namespace SR_PTYPES_NS {
             return false;
         }
 
-        if (!m_rigidActor->attachShape(*(physx::PxShape*)m_rigidbody->GetCollisionShape()->GetHandle())) {
+        auto&& pShape = (physx::PxShape*)m_rigidbody->GetCollisionShape()->GetHandle();
+
+        /// the shape is shared and immutable, the filter data is a part of it, see PhysXCollisionShape::MakeShapeDesc()
+        if (!m_rigidActor->attachShape(*pShape)) {
             SRHalt("PhysXRigidbody3D::UpdateShapeInternal() : failed to attach shape!");
             return false;
         }
@@ -242,24 +245,61 @@ namespace SR_PTYPES_NS {
         Super::ClearForces();
     }
 
-    void PhysXRigidbody3DImpl::Synchronize() {
-        if (!m_rigidActor) {
+    void PhysXRigidbody3DImpl::Synchronize(bool interpolate) {
+        if (!m_rigidActor || !m_rigidbody->GetTransform()) {
             return;
         }
 
-        auto&& pTransform = m_rigidbody->GetTransform();
-        if (!pTransform) {
+        if (!interpolate) {
+            ResetInterpolation();
+            ApplyGlobalPose();
+            Super::Synchronize(interpolate);
             return;
         }
 
+        if (!m_isInterpolated) {
+            ApplyGlobalPose();
+            PushInterpolationState(m_rigidbody->GetTranslation(), m_rigidbody->GetRotation());
+        }
+        else if (m_rigidbody->IsMatrixDirty()) {
+            /// the transform was moved outside of the simulation, teleport the body without interpolation
+            m_rigidbody->UpdateMatrix(true);
+
+            ResetInterpolation();
+            PushInterpolationState(m_rigidbody->GetTranslation(), m_rigidbody->GetRotation());
+        }
+        else {
+            SR_MATH_NS::FVector3 translation;
+            SR_MATH_NS::Quaternion rotation;
+            GetGlobalPose(translation, rotation);
+
+            if (GetRigidbody<Rigidbody3D>()->GetAngularLock() == SR_MATH_NS::BVector3(true)) {
+                rotation = m_currentRotation;
+            }
+
+            PushInterpolationState(translation - m_rigidbody->GetCenterDirection(), rotation);
+        }
+
+        Super::Synchronize(interpolate);
+    }
+
+    void PhysXRigidbody3DImpl::GetGlobalPose(SR_MATH_NS::FVector3& translation, SR_MATH_NS::Quaternion& rotation) const {
         auto&& globalPose = m_rigidActor->getGlobalPose();
 
-        auto&& rigidbodyTranslation = SR_MATH_NS::FVector3(globalPose.p.x, globalPose.p.y, globalPose.p.z);
-        auto&& rigidbodyRotation = SR_MATH_NS::Quaternion(globalPose.q.x, globalPose.q.y, globalPose.q.z, globalPose.q.w);
+        translation = SR_MATH_NS::FVector3(globalPose.p.x, globalPose.p.y, globalPose.p.z);
+        rotation = SR_MATH_NS::Quaternion(globalPose.q.x, globalPose.q.y, globalPose.q.z, globalPose.q.w);
 
         if (m_rigidbody->GetType() == ShapeType::Capsule3D) {
-            rigidbodyRotation = rigidbodyRotation.RotateZ(-90);
+            rotation = rotation.RotateZ(-90);
         }
+    }
+
+    void PhysXRigidbody3DImpl::ApplyGlobalPose() {
+        auto&& pTransform = m_rigidbody->GetTransform();
+
+        SR_MATH_NS::FVector3 rigidbodyTranslation;
+        SR_MATH_NS::Quaternion rigidbodyRotation;
+        GetGlobalPose(rigidbodyTranslation, rigidbodyRotation);
 
         /// ------------------------------------------------------------------------------------------------------------
 
@@ -291,7 +331,5 @@ namespace SR_PTYPES_NS {
 
         m_rigidbodyTranslation = m_rigidbody->GetTranslation();
         m_rigidbodyRotation = m_rigidbody->GetRotation();
-
-        Super::Synchronize();
     }
 }
@@ -0,0 +1,279 @@
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <Physics/PhysX/PhysXShapeCache.h>
+
+namespace SR_PHYSICS_NS {
+    namespace {
+        template<typename T> void CombineShapeCacheHash(size_t& hash, const T& value) {
+            hash ^= std::hash<T>()(value) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+        }
+
+        void CombineShapeCacheHash(size_t& hash, const physx::PxVec3& value) {
+            CombineShapeCacheHash(hash, value.x);
+            CombineShapeCacheHash(hash, value.y);
+            CombineShapeCacheHash(hash, value.z);
+        }
+
+        void CombineShapeCacheHash(size_t& hash, const physx::PxQuat& value) {
+            CombineShapeCacheHash(hash, value.x);
+            CombineShapeCacheHash(hash, value.y);
+            CombineShapeCacheHash(hash, value.z);
+            CombineShapeCacheHash(hash, value.w);
+        }
+
+        void CombineShapeCacheHash(size_t& hash, const physx::PxFilterData& value) {
+            CombineShapeCacheHash(hash, value.word0);
+            CombineShapeCacheHash(hash, value.word1);
+            CombineShapeCacheHash(hash, value.word2);
+            CombineShapeCacheHash(hash, value.word3);
+        }
+    }
+
+    bool PhysXShapeCache::MaterialKey::operator==(const MaterialKey& other) const noexcept {
+        return staticFriction == other.staticFriction
+            && dynamicFriction == other.dynamicFriction
+            && restitution == other.restitution
+            && frictionCombine == other.frictionCombine
+            && restitutionCombine == other.restitutionCombine;
+    }
+
+    bool PhysXShapeCache::ShapeKey::operator==(const ShapeKey& other) const noexcept {
+        return type == other.type
+            && dimensions == other.dimensions
+            && pMesh == other.pMesh
+            && meshScale.scale == other.meshScale.scale
+            && meshScale.rotation == other.meshScale.rotation
+            && pMaterial == other.pMaterial
+            && localPose == other.localPose
+            && flags == other.flags
+            && simulationFilterData == other.simulationFilterData
+            && queryFilterData == other.queryFilterData;
+    }
+
+    size_t PhysXShapeCache::KeyHash::operator()(const MaterialKey& key) const noexcept {
+        size_t hash = 0;
+        CombineShapeCacheHash(hash, key.staticFriction);
+        CombineShapeCacheHash(hash, key.dynamicFriction);
+        CombineShapeCacheHash(hash, key.restitution);
+        CombineShapeCacheHash(hash, static_cast<uint32_t>(key.frictionCombine));
+        CombineShapeCacheHash(hash, static_cast<uint32_t>(key.restitutionCombine));
+        return hash;
+    }
+
+    size_t PhysXShapeCache::KeyHash::operator()(const ShapeKey& key) const noexcept {
+        size_t hash = 0;
+        CombineShapeCacheHash(hash, static_cast<uint32_t>(key.type));
+        CombineShapeCacheHash(hash, key.dimensions);
+        CombineShapeCacheHash(hash, key.pMesh);
+        CombineShapeCacheHash(hash, key.meshScale.scale);
+        CombineShapeCacheHash(hash, key.meshScale.rotation);
+        CombineShapeCacheHash(hash, static_cast<const void*>(key.pMaterial));
+        CombineShapeCacheHash(hash, key.localPose.p);
+        CombineShapeCacheHash(hash, key.localPose.q);
+        CombineShapeCacheHash(hash, key.flags);
+        CombineShapeCacheHash(hash, key.simulationFilterData);
+        CombineShapeCacheHash(hash, key.queryFilterData);
+        return hash;
+    }
+
+    PhysXShapeCache::PhysXShapeCache(physx::PxPhysics* pPhysics)
+        : SR_UTILS_NS::NonCopyable()
+        , m_physics(pPhysics)
+    {
+        m_defaultMaterial = m_physics->createMaterial(1.0f, 1.0f, 0.0f);
+    }
+
+    PhysXShapeCache::~PhysXShapeCache() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if (!m_shapes.empty() || !m_materials.empty()) {
+            SR_WARN("PhysXShapeCache::~PhysXShapeCache() : {} shapes and {} materials are not released!", m_shapes.size(), m_materials.size());
+        }
+
+        for (auto&& [key, entry] : m_shapes) {
+            entry.pObject->release();
+        }
+
+        for (auto&& [key, entry] : m_materials) {
+            entry.pObject->release();
+        }
+
+        m_shapes.clear();
+        m_shapeKeys.clear();
+        m_materials.clear();
+        m_materialKeys.clear();
+
+        if (m_defaultMaterial) {
+            m_defaultMaterial->release();
+            m_defaultMaterial = nullptr;
+        }
+    }
+
+    physx::PxMaterial* PhysXShapeCache::AcquireMaterial(const SR_PTYPES_NS::PhysicsMaterialData& data) {
+        SR_TRACY_ZONE;
+
+        MaterialKey key;
+        key.staticFriction = data.staticFriction;
+        key.dynamicFriction = data.dynamicFriction;
+        key.restitution = data.bounciness;
+        key.frictionCombine = SR_PHYSICS_UTILS_NS::CombineToPxCombine(data.frictionCombine);
+        key.restitutionCombine = SR_PHYSICS_UTILS_NS::CombineToPxCombine(data.bounceCombine);
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if (auto&& pIt = m_materials.find(key); pIt != m_materials.end()) {
+            ++pIt->second.references;
+            return pIt->second.pObject;
+        }
+
+        auto&& pMaterial = m_physics->createMaterial(key.staticFriction, key.dynamicFriction, key.restitution);
+        if (!pMaterial) {
+            SR_ERROR("PhysXShapeCache::AcquireMaterial() : failed to create material!");
+            return nullptr;
+        }
+
+        pMaterial->setFrictionCombineMode(key.frictionCombine);
+        pMaterial->setRestitutionCombineMode(key.restitutionCombine);
+
+        m_materials[key] = Entry<physx::PxMaterial> { pMaterial, 1 };
+        m_materialKeys[pMaterial] = key;
+
+        return pMaterial;
+    }
+
+    void PhysXShapeCache::ReleaseMaterial(physx::PxMaterial* pMaterial) {
+        if (!pMaterial) {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        auto&& pKeyIt = m_materialKeys.find(pMaterial);
+        if (pKeyIt == m_materialKeys.end()) {
+            SRHalt("PhysXShapeCache::ReleaseMaterial() : material is not found!");
+            return;
+        }
+
+        auto&& pIt = m_materials.find(pKeyIt->second);
+        if (--pIt->second.references > 0) {
+            return;
+        }
+
+        /// the shapes keep their references, PhysX frees the material with the last one
+        pMaterial->release();
+
+        m_materials.erase(pIt);
+        m_materialKeys.erase(pKeyIt);
+    }
+
+    physx::PxShape* PhysXShapeCache::AcquireShape(const PhysXShapeDesc& desc) {
+        SR_TRACY_ZONE;
+
+        if (!desc.pMaterial) {
+            SRHalt("PhysXShapeCache::AcquireShape() : material is nullptr!");
+            return nullptr;
+        }
+
+        const ShapeKey key = MakeShapeKey(desc);
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if (auto&& pIt = m_shapes.find(key); pIt != m_shapes.end()) {
+            ++pIt->second.references;
+            return pIt->second.pObject;
+        }
+
+        auto&& pShape = m_physics->createShape(desc.geometry.any(), *desc.pMaterial, false, desc.flags);
+        if (!pShape) {
+            SR_ERROR("PhysXShapeCache::AcquireShape() : failed to create shape!");
+            return nullptr;
+        }
+
+        /// the shape is writable until it is attached to an actor
+        pShape->setLocalPose(desc.localPose);
+        pShape->setSimulationFilterData(desc.simulationFilterData);
+        pShape->setQueryFilterData(desc.queryFilterData);
+
+        m_shapes[key] = Entry<physx::PxShape> { pShape, 1 };
+        m_shapeKeys[pShape] = key;
+
+        return pShape;
+    }
+
+    void PhysXShapeCache::ReleaseShape(physx::PxShape* pShape) {
+        if (!pShape) {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        auto&& pKeyIt = m_shapeKeys.find(pShape);
+        if (pKeyIt == m_shapeKeys.end()) {
+            SRHalt("PhysXShapeCache::ReleaseShape() : shape is not found!");
+            return;
+        }
+
+        auto&& pIt = m_shapes.find(pKeyIt->second);
+        if (--pIt->second.references > 0) {
+            return;
+        }
+
+        /// the actors keep their references, PhysX frees the shape when the last actor detaches it
+        pShape->release();
+
+        m_shapes.erase(pIt);
+        m_shapeKeys.erase(pKeyIt);
+    }
+
+    PhysXShapeCache::Statistics PhysXShapeCache::GetStatistics() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        Statistics statistics;
+        statistics.materials = static_cast<uint32_t>(m_materials.size());
+        statistics.shapes = static_cast<uint32_t>(m_shapes.size());
+
+        for (auto&& [key, entry] : m_shapes) {
+            statistics.shapeReferences += entry.references;
+        }
+
+        return statistics;
+    }
+
+    PhysXShapeCache::ShapeKey PhysXShapeCache::MakeShapeKey(const PhysXShapeDesc& desc) {
+        ShapeKey key;
+
+        key.type = desc.geometry.getType();
+        key.pMaterial = desc.pMaterial;
+        key.localPose = desc.localPose;
+        key.flags = static_cast<uint8_t>(desc.flags);
+        key.simulationFilterData = desc.simulationFilterData;
+        key.queryFilterData = desc.queryFilterData;
+
+        switch (key.type) {
+            case physx::PxGeometryType::eBOX:
+                key.dimensions = desc.geometry.box().halfExtents;
+                break;
+            case physx::PxGeometryType::eSPHERE:
+                key.dimensions = physx::PxVec3(desc.geometry.sphere().radius, 0.f, 0.f);
+                break;
+            case physx::PxGeometryType::eCAPSULE:
+                key.dimensions = physx::PxVec3(desc.geometry.capsule().radius, desc.geometry.capsule().halfHeight, 0.f);
+                break;
+            case physx::PxGeometryType::eCONVEXMESH:
+                key.pMesh = desc.geometry.convexMesh().convexMesh;
+                key.meshScale = desc.geometry.convexMesh().scale;
+                break;
+            case physx::PxGeometryType::eTRIANGLEMESH:
+                key.pMesh = desc.geometry.triangleMesh().triangleMesh;
+                key.meshScale = desc.geometry.triangleMesh().scale;
+                break;
+            default:
+                SRHalt("PhysXShapeCache::MakeShapeKey() : unsupported geometry!");
+                break;
+        }
+
+        return key;
+    }
+}
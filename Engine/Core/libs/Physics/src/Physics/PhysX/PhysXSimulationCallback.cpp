@@ -8,161 +8,193 @@
 #include <Utils/Common/CollisionData.h>
 
 namespace SR_PHYSICS_NS {
+    namespace {
+        /// shapes are shared between the actors, only the actor knows its rigidbody
+        SR_PTYPES_NS::Rigidbody* GetRigidbody(const physx::PxRigidActor* pActor) {
+            return pActor ? static_cast<SR_PTYPES_NS::Rigidbody*>(pActor->userData) : nullptr;
+        }
+    }
+
     /**
-    This method handles only RigidBody-RigidBody collisions and calls the OnCollisionEnter/OnCollisionStay/OnCollisionExit method as appropriate.
+    This method handles only RigidBody-RigidBody collisions and buffers the OnCollisionEnter/OnCollisionStay/OnCollisionExit events.
      */
-    void ContactReportCallback::onContact(const physx::PxContactPairHeader& pairHeader, const physx::PxContactPair* pairs, physx::PxU32 nbPairs)
-    {
-        const physx::PxU32 bufferSize = 64;
-        physx::PxContactPairPoint contacts[bufferSize];
+    void ContactReportCallback::onContact(const physx::PxContactPairHeader& pairHeader, const physx::PxContactPair* pairs, physx::PxU32 nbPairs) {
+        if (pairHeader.flags & (physx::PxContactPairHeaderFlag::eREMOVED_ACTOR_0 | physx::PxContactPairHeaderFlag::eREMOVED_ACTOR_1)) {
+            return;
+        }
 
-        auto point = physx::PxVec3(0);
-        auto impulse  = physx::PxVec3(0);
+        auto&& pRigidbody1 = GetRigidbody(pairHeader.actors[0]);
+        auto&& pRigidbody2 = GetRigidbody(pairHeader.actors[1]);
 
-        for (physx::PxU32 i = 0; i < nbPairs; i++)
-        {
-            physx::PxU32 nbContacts = pairs[i].extractContacts(contacts, bufferSize);
+        if (!pRigidbody1 || !pRigidbody2) {
+            return;
+        }
 
-            for(physx::PxU32 j=0; j < nbContacts; j++)
-            {
-                point += contacts[j].position;
-                impulse += contacts[j].impulse;
+        for (physx::PxU32 i = 0; i < nbPairs; ++i) {
+            const physx::PxContactPair& cp = pairs[i];
+
+            if (cp.flags & (physx::PxContactPairFlag::eREMOVED_SHAPE_0 | physx::PxContactPairFlag::eREMOVED_SHAPE_1)) {
+                continue;
             }
 
-            point /= nbContacts > 0 ? nbContacts : 1.f;
-            impulse /= nbContacts > 0 ? nbContacts : 1.f;
+            if (cp.events & physx::PxPairFlag::eNOTIFY_TOUCH_FOUND) {
+                AddEvent(pRigidbody1, pRigidbody2, EventType::CollisionEnter, &cp);
+            }
 
-            const physx::PxContactPair& cp = pairs[i];
+            if (cp.events & physx::PxPairFlag::eNOTIFY_TOUCH_PERSISTS) {
+                AddEvent(pRigidbody1, pRigidbody2, EventType::CollisionStay, &cp);
+            }
 
-            auto shape1 = reinterpret_cast<SR_PTYPES_NS::CollisionShape*>(cp.shapes[0]->userData);
-            auto shape2 = reinterpret_cast<SR_PTYPES_NS::CollisionShape*>(cp.shapes[1]->userData);
+            if (cp.events & physx::PxPairFlag::eNOTIFY_TOUCH_LOST) {
+                AddEvent(pRigidbody1, pRigidbody2, EventType::CollisionExit, nullptr);
+            }
+        }
+    }
 
-            SR_PTYPES_NS::Rigidbody* rigidbody1 = shape1->GetRigidbody();
-            SR_PTYPES_NS::Rigidbody* rigidbody2 = shape2->GetRigidbody();
+    /**
+    This method handles only RigidBody-Trigger collisions and buffers the OnTriggerEnter/OnTriggerExit events.
+     */
+    void ContactReportCallback::onTrigger(physx::PxTriggerPair* pairs, physx::PxU32 count) {
+        for (physx::PxU32 i = 0; i < count; ++i) {
+            const physx::PxTriggerPair& tp = pairs[i];
 
-            SR_UTILS_NS::CollisionData data = { };
+            // ignore pairs when shapes have been deleted
+            if (tp.flags & (physx::PxTriggerPairFlag::eREMOVED_SHAPE_TRIGGER | physx::PxTriggerPairFlag::eREMOVED_SHAPE_OTHER)) {
+                continue;
+            }
 
-            auto&& gameObject1 = rigidbody1->GetGameObject();
-            auto&& gameObject2 = rigidbody2->GetGameObject();
+            auto&& pTriggerRigidbody = GetRigidbody(tp.triggerActor);
+            auto&& pRigidbody = GetRigidbody(tp.otherActor);
 
-            if (!gameObject1 || !gameObject2) {
-                SRHalt0();
+            if (!pTriggerRigidbody || !pRigidbody) {
                 continue;
             }
 
-            data.point = SR_PHYSICS_UTILS_NS::PxV3ToFV3(point);
-            data.impulse = SR_PHYSICS_UTILS_NS::PxV3ToFV3(impulse);
-            data.pHandler = rigidbody2;
-
-            for (auto&& pComponent : gameObject1->GetComponents()){
-                if (pComponent == rigidbody1){
-                    continue;
-                }
-                else {
-                    if (cp.events & physx::PxPairFlag::eNOTIFY_TOUCH_FOUND)
-                    {
-                        pComponent->OnCollisionEnter(data);
-                    }
-                    if (cp.events & physx::PxPairFlag::eNOTIFY_TOUCH_PERSISTS)
-                    {
-                        pComponent->OnCollisionStay(data);
-                    }
-                    if (cp.events & physx::PxPairFlag::eNOTIFY_TOUCH_LOST)
-                    {
-                        pComponent->OnCollisionExit(data);
-                    }
-                }
+            if (tp.status & physx::PxPairFlag::eNOTIFY_TOUCH_FOUND) {
+                AddEvent(pTriggerRigidbody, pRigidbody, EventType::TriggerEnter, nullptr);
             }
 
-            data.pHandler = rigidbody1;
-
-            for (auto&& pComponent : gameObject2->GetComponents()){
-                if (pComponent == rigidbody2){
-                    continue;
-                }
-                else {
-                    if (cp.events & physx::PxPairFlag::eNOTIFY_TOUCH_FOUND)
-                    {
-                        pComponent->OnCollisionEnter(data);
-                    }
-                    if (cp.events & physx::PxPairFlag::eNOTIFY_TOUCH_PERSISTS)
-                    {
-                        pComponent->OnCollisionStay(data);
-                    }
-                    if (cp.events & physx::PxPairFlag::eNOTIFY_TOUCH_LOST)
-                    {
-                        pComponent->OnCollisionExit(data);
-                    }
-                }
+            if (tp.status & physx::PxPairFlag::eNOTIFY_TOUCH_LOST) {
+                AddEvent(pTriggerRigidbody, pRigidbody, EventType::TriggerExit, nullptr);
             }
         }
     }
-    /**
-    This method handles only RigidBody-Trigger collisions and calls the OnTriggerEnter/OnTriggerExit method as appropriate.
-     */
-    void ContactReportCallback::onTrigger(physx::PxTriggerPair *pairs, physx::PxU32 count)
-    {
-        for(physx::PxU32 i=0; i < count; i++)
-        {
-            // ignore pairs when shapes have been deleted
-            if (pairs[i].flags & (physx::PxTriggerPairFlag::eREMOVED_SHAPE_TRIGGER |
-                                  physx::PxTriggerPairFlag::eREMOVED_SHAPE_OTHER)) {
-                continue;
-            }
 
-            const physx::PxTriggerPair& tp = pairs[i];
+    bool ContactReportCallback::IsListening(const SR_PTYPES_NS::Rigidbody* pRigidbody, EventType type) {
+        if (!pRigidbody) {
+            return false;
+        }
 
-            auto triggerShape = reinterpret_cast<SR_PTYPES_NS::CollisionShape*>(tp.triggerShape[0].userData);
-            auto otherShape = reinterpret_cast<SR_PTYPES_NS::CollisionShape*>(tp.otherShape[0].userData);
+        ContactEvent event = ContactEvent::Trigger;
+
+        switch (type) {
+            case EventType::CollisionEnter:
+            case EventType::CollisionExit:
+                event = ContactEvent::Collision;
+                break;
+            case EventType::CollisionStay:
+                event = ContactEvent::CollisionStay;
+                break;
+            default:
+                break;
+        }
 
-            SR_PTYPES_NS::Rigidbody* triggerRigidBody = triggerShape->GetRigidbody();
-            SR_PTYPES_NS::Rigidbody* rigidbody = otherShape->GetRigidbody();
+        return pRigidbody->GetContactEvents() & static_cast<ContactEventFlags>(event);
+    }
 
-            SR_UTILS_NS::CollisionData data = { };
+    void ContactReportCallback::AddEvent(SR_PTYPES_NS::Rigidbody* pFirst, SR_PTYPES_NS::Rigidbody* pSecond, EventType type, const physx::PxContactPair* pPair) {
+        if (!IsListening(pFirst, type) && !IsListening(pSecond, type)) {
+            return;
+        }
 
-            auto&& triggerGameObject = triggerRigidBody->GetGameObject();
-            auto&& gameObject = rigidbody->GetGameObject();
+        if (!m_keys.insert(EventKey { pFirst, pSecond, type }).second) {
+            return;
+        }
 
-            if (!triggerGameObject || !gameObject) {
-                SRHalt0();
-                continue;
-            }
+        auto&& event = m_events.emplace_back();
+        event.pRigidbodies[0] = pFirst;
+        event.pRigidbodies[1] = pSecond;
+        event.type = type;
+
+        if (!pPair || pPair->contactCount == 0) {
+            return;
+        }
+
+        const physx::PxU32 bufferSize = 64;
+        physx::PxContactPairPoint contacts[bufferSize];
+
+        auto point = physx::PxVec3(0);
+        auto impulse = physx::PxVec3(0);
 
-            data.pHandler = rigidbody;
-
-            for (auto&& pComponent : triggerGameObject->GetComponents()){
-                if (pComponent == triggerRigidBody){
-                    continue;
-                }
-                else {
-                    if (tp.status & physx::PxPairFlag::eNOTIFY_TOUCH_FOUND)
-                    {
-                        pComponent->OnCollisionEnter(data);
-                    }
-                    if (tp.status & physx::PxPairFlag::eNOTIFY_TOUCH_LOST)
-                    {
-                        pComponent->OnCollisionExit(data);
-                    }
-                }
+        const physx::PxU32 nbContacts = pPair->extractContacts(contacts, bufferSize);
+
+        for (physx::PxU32 j = 0; j < nbContacts; ++j) {
+            point += contacts[j].position;
+            impulse += contacts[j].impulse;
+        }
+
+        point /= nbContacts > 0 ? static_cast<float_t>(nbContacts) : 1.f;
+        impulse /= nbContacts > 0 ? static_cast<float_t>(nbContacts) : 1.f;
+
+        event.point = SR_PHYSICS_UTILS_NS::PxV3ToFV3(point);
+        event.impulse = SR_PHYSICS_UTILS_NS::PxV3ToFV3(impulse);
+    }
+
+    void ContactReportCallback::Dispatch() {
+        SR_TRACY_ZONE;
+
+        if (m_events.empty()) {
+            return;
+        }
+
+        /// the components are free to do anything with the physics here, new events come only from the next step
+        m_dispatched.swap(m_events);
+
+        for (auto&& event : m_dispatched) {
+            Dispatch(event, 0);
+            Dispatch(event, 1);
+        }
+
+        m_dispatched.clear();
+    }
+
+    void ContactReportCallback::Dispatch(const Event& event, uint8_t index) {
+        auto&& pRigidbody = event.pRigidbodies[index];
+        auto&& pOther = event.pRigidbodies[1 - index];
+
+        if (!IsListening(pRigidbody, event.type)) {
+            return;
+        }
+
+        auto&& gameObject = pRigidbody->GetGameObject();
+        if (!gameObject) {
+            return;
+        }
+
+        SR_UTILS_NS::CollisionData data = { };
+
+        data.point = event.point;
+        data.impulse = event.impulse;
+        data.pHandler = pOther;
+
+        for (auto&& pComponent : gameObject->GetComponents()) {
+            if (pComponent == pRigidbody) {
+                continue;
             }
 
-            data.pHandler = triggerRigidBody;
-
-            for (auto&& pComponent : gameObject->GetComponents()){
-                if (pComponent == rigidbody){
-                    continue;
-                }
-                else {
-                    if (tp.status & physx::PxPairFlag::eNOTIFY_TOUCH_FOUND)
-                    {
-                        pComponent->OnTriggerEnter(data);
-                    }
-                    if (tp.status & physx::PxPairFlag::eNOTIFY_TOUCH_LOST)
-                    {
-                        pComponent->OnTriggerExit(data);
-                    }
-                }
+            switch (event.type) {
+                case EventType::CollisionEnter: pComponent->OnCollisionEnter(data); break;
+                case EventType::CollisionStay: pComponent->OnCollisionStay(data); break;
+                case EventType::CollisionExit: pComponent->OnCollisionExit(data); break;
+                case EventType::TriggerEnter: pComponent->OnTriggerEnter(data); break;
+                case EventType::TriggerExit: pComponent->OnTriggerExit(data); break;
             }
         }
     }
-}
\ No newline at end of file
+
+    void ContactReportCallback::Remove(SR_PTYPES_NS::Rigidbody* pRigidbody) {
+        std::erase_if(m_events, [pRigidbody](const Event& event) {
+            return event.pRigidbodies[0] == pRigidbody || event.pRigidbodies[1] == pRigidbody;
+        });
+    }
+}
@@ -4,6 +4,7 @@
 
 #include <Physics/PhysicsLib.h>
 #include <Utils/Resources/ResourceManager.h>
+#include <Utils/ECS/LayerManager.h>
 
 #ifdef SR_PHYSICS_USE_BULLET3
     #include <Physics/Bullet3/Bullet3LibraryImpl.h>
@@ -22,6 +23,7 @@ namespace SR_PHYSICS_NS {
         : Super()
     {
         m_libraries.resize(SR_UTILS_NS::EnumReflector::Count<LibraryType>());
+        m_collisionMatrix.fill(std::numeric_limits<uint32_t>::max());
     }
 
     PhysicsLibrary::~PhysicsLibrary() {
@@ -54,6 +56,10 @@ namespace SR_PHYSICS_NS {
             m_supportedLibs.insert(library);
         }
 
+        LoadCollisionMatrix(document.Root().GetNode("Physics").TryGetNode("CollisionMatrix"));
+
+        m_statisticsEnabled = document.Root().GetNode("Physics").TryGetNode("Statistics").TryGetAttribute("Enabled").ToBool(false);
+
         const auto&& defaultMaterialPath = SR_UTILS_NS::ResourceManager::Instance().GetResPath().Concat("Engine/PhysicsMaterials/DefaultMaterial.physmat");
         m_defaultMaterial = SR_PTYPES_NS::PhysicsMaterial::Load(defaultMaterialPath);
 
@@ -133,6 +139,50 @@ namespace SR_PHYSICS_NS {
         return nullptr;
     }
 
+    void PhysicsLibrary::SetJobScheduler(JobScheduler scheduler, uint32_t workers) {
+        m_jobScheduler = std::move(scheduler);
+        m_jobWorkers = m_jobScheduler ? workers : 0;
+    }
+
+    void PhysicsLibrary::LoadCollisionMatrix(const SR_XML_NS::Node& node) {
+        m_triggersVsStatic = node.TryGetAttribute("TriggersVsStatic").ToBool(m_triggersVsStatic);
+
+        auto&& layers = SR_UTILS_NS::LayerManager::Instance().GetLayers();
+
+        auto&& hasLayer = [&layers](SR_UTILS_NS::StringAtom layer) {
+            return std::find(layers.begin(), layers.end(), layer) != layers.end();
+        };
+
+        for (auto&& ignoreNode : node.TryGetNodes()) {
+            if (ignoreNode.Name() != "Ignore") {
+                continue;
+            }
+
+            const SR_UTILS_NS::StringAtom first = ignoreNode.GetAttribute("First").ToString();
+            const SR_UTILS_NS::StringAtom second = ignoreNode.GetAttribute("Second").ToString();
+
+            if (!hasLayer(first) || !hasLayer(second)) {
+                SR_WARN("PhysicsLibrary::LoadCollisionMatrix() : unknown layer!\n\tFirst: " + first.ToStringRef() + "\n\tSecond: " + second.ToStringRef());
+                continue;
+            }
+
+            const uint32_t firstIndex = GetLayerIndex(first);
+            const uint32_t secondIndex = GetLayerIndex(second);
+
+            /// the matrix is symmetric, a pair is rejected when any side ignores the other
+            m_collisionMatrix[firstIndex] &= ~(1u << secondIndex);
+            m_collisionMatrix[secondIndex] &= ~(1u << firstIndex);
+        }
+    }
+
+    uint32_t PhysicsLibrary::GetCollisionMask(SR_UTILS_NS::StringAtom layer) const {
+        return m_collisionMatrix[GetLayerIndex(layer)];
+    }
+
+    uint32_t PhysicsLibrary::GetLayerIndex(SR_UTILS_NS::StringAtom layer) {
+        return SR_UTILS_NS::LayerManager::Instance().GetLayerIndex(layer) % 32;
+    }
+
     PhysicsLibrary::LibraryTypes PhysicsLibrary::GetSupportedLibraries() const {
         LibraryTypes types;
 
@@ -9,6 +9,7 @@
 
 #include <Physics/PhysicsWorld.h>
 #include <Physics/LibraryImpl.h>
+#include <Physics/3D/CharacterController3D.h>
 
 namespace SR_PHYSICS_NS {
     PhysicsScene::PhysicsScene(const ScenePtr& scene)
@@ -17,6 +18,8 @@ namespace SR_PHYSICS_NS {
     { }
 
     PhysicsScene::~PhysicsScene() {
+        EndStep();
+
         auto&& removeRigidbody = [&](SR_PTYPES_NS::Rigidbody* pRigidbody) {
             if (!pRigidbody) {
                 return;
@@ -24,13 +27,10 @@ namespace SR_PHYSICS_NS {
 
             auto&& type = pRigidbody->GetType();
 
-            if (SR_PHYSICS_UTILS_NS::Is2DShape(type)) {
-                m_2DWorld->RemoveRigidbody(pRigidbody);
-            }
-            else if (SR_PHYSICS_UTILS_NS::Is3DShape(type)) {
-                m_3DWorld->RemoveRigidbody(pRigidbody);
+            if (auto&& pWorld = GetWorld(type)) {
+                pWorld->RemoveRigidbody(pRigidbody);
             }
-            else {
+            else if (!SR_PHYSICS_UTILS_NS::Is2DShape(type) && !SR_PHYSICS_UTILS_NS::Is3DShape(type)) {
                 SRHalt("Unknown measurement of rigidbody!");
             }
 
@@ -61,6 +61,24 @@ namespace SR_PHYSICS_NS {
             removeRigidbody(pRigidbody);
         }
 
+        std::set<CharacterControllerPtr> controllers(m_controllerToRegister.begin(), m_controllerToRegister.end());
+        controllers.insert(m_controllerToRemove.begin(), m_controllerToRemove.end());
+
+        m_controllerToRemove.clear();
+        m_controllerToRegister.clear();
+
+        for (auto&& pController : controllers) {
+            if (m_3DWorld) {
+                m_3DWorld->RemoveCharacterController(pController);
+            }
+
+            if (!pController->HasParent()) {
+                pController->AutoFree([](auto&& pData) {
+                    delete pData;
+                });
+            }
+        }
+
         SR_SAFE_DELETE_PTR(m_2DWorld);
         SR_SAFE_DELETE_PTR(m_3DWorld);
 
@@ -81,16 +99,6 @@ namespace SR_PHYSICS_NS {
             return false;
         }
 
-        if (!(m_2DWorld = m_library2D->CreatePhysicsWorld(Space::Space2D))) {
-            SR_ERROR("PhysicsScene::Init() : failed to create 2d world!");
-            return false;
-        }
-
-        if (!(m_3DWorld = m_library3D->CreatePhysicsWorld(Space::Space3D))) {
-            SR_ERROR("PhysicsScene::Init() : failed to create 3d world!");
-            return false;
-        }
-
         if (m_scene.RecursiveLockIfValid()) {
             auto&& dataStorage = m_scene->GetDataStorage();
 
@@ -108,14 +116,7 @@ namespace SR_PHYSICS_NS {
             SRHalt("PhysicsScene::Init() : scene is invalid!");
         }
 
-        if (!CreateDynamicWorld()) {
-            SR_ERROR("PhysicsScene::Init() : failed to create dynamic world!");
-            return false;
-        }
-
-        m_2DWorld->StepSimulation(1.f / 60.f);
-        m_3DWorld->StepSimulation(1.f / 60.f);
-
+        /// the worlds are created by the first rigidbody of their space, see GetOrCreateWorld()
         return true;
     }
 
@@ -125,36 +126,70 @@ namespace SR_PHYSICS_NS {
 
     bool PhysicsScene::Flush() {
         SR_TRACY_ZONE;
+        SR_LOCK_GUARD;
 
         const bool needFlush = !m_rigidbodyToRemove.empty();
 
+        /// the worlds add and remove the bodies in bulk, a streamed chunk is a single batch
+        m_flushBatch2D.clear();
+        m_flushBatch3D.clear();
+
         for (auto&& pRigidbody : m_rigidbodyToRegister) {
             auto&& type = pRigidbody->GetType();
 
             if (SR_PHYSICS_UTILS_NS::Is2DShape(type)) {
-                m_2DWorld->AddRigidbody(pRigidbody);
+                m_flushBatch2D.emplace_back(pRigidbody);
             }
             else if (SR_PHYSICS_UTILS_NS::Is3DShape(type)) {
-                m_3DWorld->AddRigidbody(pRigidbody);
+                m_flushBatch3D.emplace_back(pRigidbody);
             }
             else {
                 SRHalt("Unknown measurement of rigidbody!");
             }
         }
 
+        if (!m_flushBatch2D.empty()) {
+            if (auto&& pWorld = GetOrCreateWorld(Space::Space2D)) {
+                pWorld->AddRigidbodies(m_flushBatch2D);
+            }
+        }
+
+        if (!m_flushBatch3D.empty()) {
+            if (auto&& pWorld = GetOrCreateWorld(Space::Space3D)) {
+                pWorld->AddRigidbodies(m_flushBatch3D);
+            }
+        }
+
+        m_flushBatch2D.clear();
+        m_flushBatch3D.clear();
+
         for (auto&& pRigidbody : m_rigidbodyToRemove) {
             auto&& type = pRigidbody->GetType();
 
             if (SR_PHYSICS_UTILS_NS::Is2DShape(type)) {
-                m_2DWorld->RemoveRigidbody(pRigidbody);
+                m_flushBatch2D.emplace_back(pRigidbody);
             }
             else if (SR_PHYSICS_UTILS_NS::Is3DShape(type)) {
-                m_3DWorld->RemoveRigidbody(pRigidbody);
+                m_flushBatch3D.emplace_back(pRigidbody);
             }
             else {
                 SRHalt("Unknown measurement of rigidbody!");
             }
+        }
+
+        /// the rigidbody could be removed before it was flushed to a world
+        if (m_2DWorld && !m_flushBatch2D.empty()) {
+            m_2DWorld->RemoveRigidbodies(m_flushBatch2D);
+        }
+
+        if (m_3DWorld && !m_flushBatch3D.empty()) {
+            m_3DWorld->RemoveRigidbodies(m_flushBatch3D);
+        }
+
+        m_flushBatch2D.clear();
+        m_flushBatch3D.clear();
 
+        for (auto&& pRigidbody : m_rigidbodyToRemove) {
             if (!pRigidbody->HasParent()) {
                 pRigidbody->AutoFree([](auto&& pData) {
                     delete pData;
@@ -165,58 +200,378 @@ namespace SR_PHYSICS_NS {
         m_rigidbodyToRemove.clear();
         m_rigidbodyToRegister.clear();
 
+        if (!m_controllerToRegister.empty()) {
+            if (auto&& pWorld = GetOrCreateWorld(Space::Space3D)) {
+                for (auto&& pController : m_controllerToRegister) {
+                    pWorld->AddCharacterController(pController);
+                }
+            }
+        }
+
+        for (auto&& pController : m_controllerToRemove) {
+            if (m_3DWorld) {
+                m_3DWorld->RemoveCharacterController(pController);
+            }
+
+            if (!pController->HasParent()) {
+                pController->AutoFree([](auto&& pData) {
+                    delete pData;
+                });
+            }
+        }
+
+        m_controllerToRemove.clear();
+        m_controllerToRegister.clear();
+
         return needFlush;
     }
 
-    bool PhysicsScene::CreateDynamicWorld() {
-        if (!m_2DWorld->Initialize()) {
-            SR_ERROR("PhysicsScene::Initialize() : failed to create dynamic world for 2d world!");
+    PhysicsScene::PhysicsWorldPtr PhysicsScene::GetOrCreateWorld(Space space) {
+        PhysicsWorldPtr& pWorld = space == Space::Space2D ? m_2DWorld : m_3DWorld;
+        if (pWorld) {
+            return pWorld;
+        }
+
+        auto&& pLibrary = space == Space::Space2D ? m_library2D : m_library3D;
+        if (!pLibrary) {
+            SRHalt("PhysicsScene::GetOrCreateWorld() : the library is not initialized!");
+            return nullptr;
+        }
+
+        SR_LOG("PhysicsScene::GetOrCreateWorld() : creating the \"{}\" world...", SR_UTILS_NS::EnumReflector::ToStringAtom(space).ToStringRef());
+
+        if (!(pWorld = pLibrary->CreatePhysicsWorld(space))) {
+            SR_ERROR("PhysicsScene::GetOrCreateWorld() : failed to create world!");
+            return nullptr;
+        }
+
+        if (!pWorld->Initialize()) {
+            SR_ERROR("PhysicsScene::GetOrCreateWorld() : failed to initialize world!");
+            SR_SAFE_DELETE_PTR(pWorld);
+            return nullptr;
+        }
+
+        pWorld->SetInterpolationEnabled(m_interpolation);
+
+        return pWorld;
+    }
+
+    PhysicsScene::PhysicsWorldPtr PhysicsScene::GetWorld(ShapeType type) const {
+        if (SR_PHYSICS_UTILS_NS::Is2DShape(type)) {
+            return m_2DWorld;
+        }
+
+        if (SR_PHYSICS_UTILS_NS::Is3DShape(type)) {
+            return m_3DWorld;
+        }
+
+        return nullptr;
+    }
+
+    void PhysicsScene::FixedUpdate() {
+        SR_TRACY_ZONE;
+
+        Update(m_fixedStep);
+    }
+
+    void PhysicsScene::Update(float_t dt) {
+        SR_TRACY_ZONE;
+
+        EndStep();
+        StepSimulation(dt);
+        Synchronize();
+    }
+
+    void PhysicsScene::RequestStep(float_t step) {
+        SR_LOCK_GUARD;
+        m_requestedSteps.emplace_back(step);
+    }
+
+    void PhysicsScene::RequestOriginShift(const SR_MATH_NS::FVector3& shift) {
+        SR_LOCK_GUARD;
+        m_requestedOriginShift += shift;
+    }
+
+    void PhysicsScene::BeginOriginShift() {
+        m_isOriginShifting = true;
+    }
+
+    void PhysicsScene::EndOriginShift(const SR_MATH_NS::FVector3& shift) {
+        SR_TRACY_ZONE;
+
+        m_isOriginShifting = false;
+
+        if (!shift.IsEquals(SR_MATH_NS::FVector3(SR_MATH_NS::Unit(0)), SR_MATH_NS::Unit(0.00001))) {
+            RequestOriginShift(shift);
+        }
+
+        if (m_originShiftedRigidbodies.empty()) {
+            return;
+        }
+
+        SR_MATH_NS::FVector3 requestedShift;
+
+        {
+            SR_LOCK_GUARD;
+            requestedShift = m_requestedOriginShift;
+        }
+
+        std::vector<RigidbodyPtr> moved2D;
+        std::vector<RigidbodyPtr> moved3D;
+
+        /// only the transforms which have really moved are queued, under one lock of the world
+        for (auto&& pRigidbody : m_originShiftedRigidbodies) {
+            if (pRigidbody->ResolveOriginShift(requestedShift)) {
+                continue;
+            }
+
+            if (SR_PHYSICS_UTILS_NS::Is2DShape(pRigidbody->GetType())) {
+                moved2D.emplace_back(pRigidbody);
+            }
+            else {
+                moved3D.emplace_back(pRigidbody);
+            }
+        }
+
+        m_originShiftedRigidbodies.clear();
+
+        if (m_2DWorld && !moved2D.empty()) {
+            m_2DWorld->MarkDirty(moved2D);
+        }
+
+        if (m_3DWorld && !moved3D.empty()) {
+            m_3DWorld->MarkDirty(moved3D);
+        }
+    }
+
+    void PhysicsScene::DeferOriginShift(RigidbodyPtr pRigidbody) {
+        m_originShiftedRigidbodies.emplace_back(pRigidbody);
+    }
+
+    bool PhysicsScene::HasRequestedSteps() const {
+        SR_LOCK_GUARD;
+        return !m_requestedSteps.empty();
+    }
+
+    bool PhysicsScene::Simulate() {
+        SR_TRACY_ZONE;
+
+        const bool isBegun = BeginStep();
+        const bool isEnded = EndStep();
+
+        return isBegun || isEnded;
+    }
+
+    bool PhysicsScene::BeginStep() {
+        SR_TRACY_ZONE;
+
+        std::vector<float_t> steps;
+
+        {
+            SR_LOCK_GUARD;
+            steps.swap(m_requestedSteps);
+        }
+
+        if (steps.empty()) {
             return false;
         }
 
-        if (!m_3DWorld->Initialize()) {
-            SR_ERROR("PhysicsScene::Initialize() : failed to create dynamic world for 3d world!");
+        EndStep();
+
+        /// only the last step can overlap with the gameplay, the previous ones are done at once
+        for (size_t i = 0; i + 1 < steps.size(); ++i) {
+            StepSimulation(steps[i]);
+        }
+
+        PrepareStep(steps.back());
+
+        const auto start = std::chrono::steady_clock::now();
+
+        ForEachWorld([&](auto&& pWorld) { pWorld->BeginStep(steps.back()); });
+
+        m_sampleTimes.simulateTime += std::chrono::duration<double_t, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        m_isStepInFlight = true;
+
+        return true;
+    }
+
+    bool PhysicsScene::EndStep() {
+        SR_TRACY_ZONE;
+
+        if (!m_isStepInFlight) {
             return false;
         }
 
+        const auto start = std::chrono::steady_clock::now();
+
+        ForEachWorld([&](auto&& pWorld) { pWorld->EndStep(); });
+
+        m_sampleTimes.fetchTime += std::chrono::duration<double_t, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        m_isStepInFlight = false;
+
         return true;
     }
 
-    void PhysicsScene::FixedUpdate() {
+    void PhysicsScene::Synchronize() {
         SR_TRACY_ZONE;
 
-        Update(1.f / 60.f);
+        EndStep();
+        ApplyOriginShift();
+
+        const auto start = std::chrono::steady_clock::now();
+
+        ForEachWorld([&](auto&& pWorld) { pWorld->Synchronize(); });
+
+        m_sampleTimes.synchronizeTime += std::chrono::duration<double_t, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        TakeStatisticsSample();
     }
 
-    void PhysicsScene::Update(float_t dt) {
+    void PhysicsScene::Interpolate(float_t alpha) {
         SR_TRACY_ZONE;
 
+        m_interpolationAlpha = alpha;
+
+        if (!m_interpolation) {
+            return;
+        }
+
+        ForEachWorld([&](auto&& pWorld) { pWorld->Interpolate(alpha); });
+    }
+
+    void PhysicsScene::RestoreSimulatedPoses() {
+        SR_TRACY_ZONE;
+        ForEachWorld([&](auto&& pWorld) { pWorld->RestoreSimulatedPoses(); });
+    }
+
+    void PhysicsScene::SetInterpolationEnabled(bool enabled) {
+        m_interpolation = enabled;
+
+        if (m_2DWorld) {
+            m_2DWorld->SetInterpolationEnabled(enabled);
+        }
+
+        if (m_3DWorld) {
+            m_3DWorld->SetInterpolationEnabled(enabled);
+        }
+    }
+
+    void PhysicsScene::PrepareStep(float_t step) {
+        /// the registered rigidbodies are added in the shifted space
+        ApplyOriginShift();
+
         if (Flush()) {
-            m_2DWorld->Flush();
-            m_3DWorld->Flush();
+            ForEachWorld([&](auto&& pWorld) { pWorld->Flush(); });
         }
 
         if (m_needClearForces) {
-            m_2DWorld->ClearForces();
-            m_3DWorld->ClearForces();
+            ForEachWorld([&](auto&& pWorld) { pWorld->ClearForces(); });
             m_needClearForces = false;
         }
 
-        m_2DWorld->StepSimulation(dt);
-        m_3DWorld->StepSimulation(dt);
+        /// the controllers are kinematic for the simulation, they are moved before it starts
+        if (m_3DWorld) {
+            m_3DWorld->MoveCharacterControllers(step);
+        }
+    }
 
-        m_2DWorld->Synchronize();
-        m_3DWorld->Synchronize();
+    void PhysicsScene::ApplyOriginShift() {
+        SR_TRACY_ZONE;
+
+        SR_MATH_NS::FVector3 shift;
+
+        {
+            SR_LOCK_GUARD;
+            shift = m_requestedOriginShift;
+            m_requestedOriginShift = SR_MATH_NS::FVector3(SR_MATH_NS::Unit(0));
+        }
+
+        if (shift.IsEquals(SR_MATH_NS::FVector3(SR_MATH_NS::Unit(0)), SR_MATH_NS::Unit(0.00001))) {
+            return;
+        }
+
+        /// the rigidbodies visited by the worlds catch up with it at once, the others when they are touched
+        m_originShift += shift;
+
+        ForEachWorld([&](auto&& pWorld) { pWorld->ShiftOrigin(shift); });
+    }
+
+    void PhysicsScene::StepSimulation(float_t dt) {
+        SR_TRACY_ZONE;
+
+        PrepareStep(dt);
+
+        const auto start = std::chrono::steady_clock::now();
+
+        ForEachWorld([&](auto&& pWorld) { pWorld->StepSimulation(dt); });
+
+        m_sampleTimes.simulateTime += std::chrono::duration<double_t, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    void PhysicsScene::TakeStatisticsSample() {
+        if (!PhysicsLibrary::Instance().IsStatisticsEnabled()) {
+            ForEachWorld([](auto&& pWorld) { pWorld->ResetStatistics(); });
+            m_sampleTimes = PhysicsStatistics();
+            return;
+        }
+
+        SR_TRACY_ZONE;
+
+        PhysicsStatistics sample = m_sampleTimes;
+
+        ForEachWorld([&](auto&& pWorld) {
+            sample += pWorld->GetStatistics();
+            pWorld->ResetStatistics();
+        });
+
+        m_statistics.Push(sample);
+        m_sampleTimes = PhysicsStatistics();
     }
 
     void PhysicsScene::Register(PhysicsScene::RigidbodyPtr pRigidbody) {
+        SR_LOCK_GUARD;
         SRAssert(pRigidbody->IsComponentLoaded());
         m_rigidbodyToRegister.emplace_back(pRigidbody);
     }
 
     void PhysicsScene::Remove(PhysicsScene::RigidbodyPtr pRigidbody) {
+        SR_LOCK_GUARD;
         SRAssert(pRigidbody->IsComponentLoaded());
         m_rigidbodyToRemove.emplace_back(pRigidbody);
+
+        /// the chunks are unloaded by the same scene logic that shifts the origin
+        if (m_isOriginShifting) {
+            std::erase(m_originShiftedRigidbodies, pRigidbody);
+        }
+    }
+
+    void PhysicsScene::Register(PhysicsScene::CharacterControllerPtr pController) {
+        SR_LOCK_GUARD;
+        SRAssert(pController->IsComponentLoaded());
+        m_controllerToRegister.emplace_back(pController);
+    }
+
+    void PhysicsScene::Remove(PhysicsScene::CharacterControllerPtr pController) {
+        SR_LOCK_GUARD;
+        SRAssert(pController->IsComponentLoaded());
+        m_controllerToRemove.emplace_back(pController);
+    }
+
+    void PhysicsScene::MarkDirty(PhysicsScene::RigidbodyPtr pRigidbody) {
+        auto&& type = pRigidbody->GetType();
+
+        if (SR_PHYSICS_UTILS_NS::Is2DShape(type)) {
+            if (m_2DWorld) {
+                m_2DWorld->MarkDirty(pRigidbody);
+            }
+        }
+        else if (SR_PHYSICS_UTILS_NS::Is3DShape(type)) {
+            if (m_3DWorld) {
+                m_3DWorld->MarkDirty(pRigidbody);
+            }
+        }
     }
 
     void PhysicsScene::ClearForces() {
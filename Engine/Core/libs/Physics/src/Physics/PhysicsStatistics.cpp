@@ -0,0 +1,119 @@
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <Physics/PhysicsStatistics.h>
+
+namespace SR_PHYSICS_NS {
+    PhysicsStatistics& PhysicsStatistics::operator+=(const PhysicsStatistics& other) {
+        activeBodies += other.activeBodies;
+        staticBodies += other.staticBodies;
+        sleepingBodies += other.sleepingBodies;
+        broadPhasePairs += other.broadPhasePairs;
+        contacts += other.contacts;
+        islands += other.islands;
+
+        simulateTime += other.simulateTime;
+        fetchTime += other.fetchTime;
+        synchronizeTime += other.synchronizeTime;
+        callbackTime += other.callbackTime;
+        cookingTime += other.cookingTime;
+
+        broadPhaseTime += other.broadPhaseTime;
+        narrowPhaseTime += other.narrowPhaseTime;
+        solverTime += other.solverTime;
+        hasPhaseTimes |= other.hasPhaseTimes;
+
+        return *this;
+    }
+
+    void PhysicsStatisticsHistory::Push(const PhysicsStatistics& statistics) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_samples[m_count % Capacity] = statistics;
+        ++m_count;
+    }
+
+    void PhysicsStatisticsHistory::Reset() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_count = 0;
+    }
+
+    std::vector<PhysicsStatistics> PhysicsStatisticsHistory::GetSamples() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        const uint64_t size = SR_MIN(m_count, static_cast<uint64_t>(Capacity));
+
+        std::vector<PhysicsStatistics> samples;
+        samples.reserve(size);
+
+        for (uint64_t i = m_count - size; i < m_count; ++i) {
+            samples.emplace_back(m_samples[i % Capacity]);
+        }
+
+        return samples;
+    }
+
+    PhysicsStatistics PhysicsStatisticsHistory::GetLast() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_count == 0 ? PhysicsStatistics() : m_samples[(m_count - 1) % Capacity];
+    }
+
+    std::vector<PhysicsStatistics> PhysicsStatisticsHistory::GetSamplesSince(uint64_t& cursor) const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        /// the history was reset after the previous call
+        if (cursor > m_count) {
+            cursor = 0;
+        }
+
+        const uint64_t first = SR_MAX(cursor, m_count - SR_MIN(m_count, static_cast<uint64_t>(Capacity)));
+
+        std::vector<PhysicsStatistics> samples;
+        samples.reserve(m_count - first);
+
+        for (uint64_t i = first; i < m_count; ++i) {
+            samples.emplace_back(m_samples[i % Capacity]);
+        }
+
+        cursor = m_count;
+
+        return samples;
+    }
+
+    bool PhysicsStatisticsHistory::DumpCSV(const SR_UTILS_NS::Path& path) const {
+        if (!path.GetFolder().CreateIfNotExists()) {
+            SR_ERROR("PhysicsStatisticsHistory::DumpCSV() : failed to create folder!\n\tPath: " + path.ToString());
+            return false;
+        }
+
+        std::ofstream file(path.ToString());
+        if (!file.is_open()) {
+            SR_ERROR("PhysicsStatisticsHistory::DumpCSV() : failed to open file!\n\tPath: " + path.ToString());
+            return false;
+        }
+
+        file << "active,static,sleeping,broadphase_pairs,contacts,islands,simulate_ms,fetch_ms,synchronize_ms,"
+                "callbacks_ms,cooking_ms,broadphase_ms,narrowphase_ms,solver_ms\n";
+
+        for (auto&& sample : GetSamples()) {
+            file << sample.activeBodies << ',' << sample.staticBodies << ',' << sample.sleepingBodies << ','
+                 << sample.broadPhasePairs << ',' << sample.contacts << ',' << sample.islands << ','
+                 << sample.simulateTime << ',' << sample.fetchTime << ',' << sample.synchronizeTime << ','
+                 << sample.callbackTime << ',' << sample.cookingTime << ',';
+
+            /// the phases that are not measured by the backend are left empty
+            if (sample.hasPhaseTimes) {
+                file << sample.broadPhaseTime << ',' << sample.narrowPhaseTime << ',' << sample.solverTime;
+            }
+            else {
+                file << ",,";
+            }
+
+            file << '\n';
+        }
+
+        SR_LOG("PhysicsStatisticsHistory::DumpCSV() : physics statistics were saved to \"" + path.ToString() + "\"");
+
+        return true;
+    }
+}
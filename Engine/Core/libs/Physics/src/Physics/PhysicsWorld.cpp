@@ -3,6 +3,9 @@
 //
 
 #include <Physics/PhysicsWorld.h>
+#include <Physics/Rigidbody.h>
+#include <Physics/2D/Raycast2DImpl.h>
+#include <Physics/3D/Raycast3DImpl.h>
 
 namespace SR_PHYSICS_NS {
     PhysicsWorld::PhysicsWorld(LibraryPtr pLibrary, Space space)
@@ -14,9 +17,98 @@ namespace SR_PHYSICS_NS {
     }
 
     PhysicsWorld::~PhysicsWorld() {
+        SR_SAFE_DELETE_PTR(m_raycast2dImpl);
+
         if (m_raycast3dImpl){
             delete m_raycast3dImpl;
             m_raycast3dImpl = nullptr;
         }
     }
-}
+
+    bool PhysicsWorld::BeginStep(float_t step) {
+        if (m_deferredStep.has_value()) {
+            SRHalt("PhysicsWorld::BeginStep() : the previous step is not ended!");
+            EndStep();
+        }
+
+        m_deferredStep = step;
+
+        return true;
+    }
+
+    bool PhysicsWorld::EndStep() {
+        if (!m_deferredStep.has_value()) {
+            return true;
+        }
+
+        const float_t step = m_deferredStep.value();
+        m_deferredStep.reset();
+
+        return StepSimulation(step);
+    }
+
+    bool PhysicsWorld::AddRigidbodies(const std::vector<RigidbodyPtr>& rigidbodies) {
+        bool result = true;
+
+        for (auto&& pRigidbody : rigidbodies) {
+            result &= AddRigidbody(pRigidbody);
+        }
+
+        return result;
+    }
+
+    bool PhysicsWorld::RemoveRigidbodies(const std::vector<RigidbodyPtr>& rigidbodies) {
+        bool result = true;
+
+        for (auto&& pRigidbody : rigidbodies) {
+            result &= RemoveRigidbody(pRigidbody);
+        }
+
+        return result;
+    }
+
+    void PhysicsWorld::MarkDirty(RigidbodyPtr pRigidbody) {
+        std::lock_guard lock(m_dirtyMutex);
+        m_dirtyRigidbodies.insert(pRigidbody);
+    }
+
+    void PhysicsWorld::MarkDirty(const std::vector<RigidbodyPtr>& rigidbodies) {
+        std::lock_guard lock(m_dirtyMutex);
+        m_dirtyRigidbodies.insert(rigidbodies.begin(), rigidbodies.end());
+    }
+
+    void PhysicsWorld::CatchUpOrigin(const std::vector<RigidbodyPtr>& moved, const std::vector<RigidbodyPtr>& previousMoved) {
+        SR_TRACY_ZONE;
+
+        for (auto&& pRigidbody : moved) {
+            pRigidbody->CatchUpOrigin();
+        }
+
+        for (auto&& pRigidbody : previousMoved) {
+            pRigidbody->CatchUpOrigin();
+        }
+
+        std::vector<RigidbodyPtr> dirty;
+
+        {
+            std::lock_guard lock(m_dirtyMutex);
+            dirty.assign(m_dirtyRigidbodies.begin(), m_dirtyRigidbodies.end());
+        }
+
+        for (auto&& pRigidbody : dirty) {
+            pRigidbody->CatchUpOrigin();
+        }
+    }
+
+    void PhysicsWorld::UnmarkDirty(RigidbodyPtr pRigidbody) {
+        std::lock_guard lock(m_dirtyMutex);
+        m_dirtyRigidbodies.erase(pRigidbody);
+    }
+
+    std::vector<PhysicsWorld::RigidbodyPtr> PhysicsWorld::TakeDirtyRigidbodies() {
+        std::lock_guard lock(m_dirtyMutex);
+        std::vector<RigidbodyPtr> rigidbodies(m_dirtyRigidbodies.begin(), m_dirtyRigidbodies.end());
+        m_dirtyRigidbodies.clear();
+        return rigidbodies;
+    }
+}
\ No newline at end of file
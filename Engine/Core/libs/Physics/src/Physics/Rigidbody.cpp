@@ -17,6 +17,80 @@
 #include <Physics/3D/Rigidbody3D.h>
 
 namespace SR_PTYPES_NS {
+    void RigidbodyImpl::PushInterpolationState(const SR_MATH_NS::FVector3& translation, const SR_MATH_NS::Quaternion& rotation) {
+        if (!m_isInterpolated) {
+            m_previousTranslation = translation;
+            m_previousRotation = rotation;
+            m_isInterpolated = true;
+        }
+        else {
+            m_previousTranslation = m_currentTranslation;
+            m_previousRotation = m_currentRotation;
+        }
+
+        m_currentTranslation = translation;
+        m_currentRotation = rotation;
+    }
+
+    void RigidbodyImpl::Synchronize(bool interpolate) {
+        if (!interpolate || !m_isInterpolated || !m_rigidbody) {
+            return;
+        }
+
+        /// the gameplay works with the last simulated state, the interpolated one is only shown
+        m_rigidbody->ApplyPose(m_currentTranslation, m_currentRotation);
+        m_rigidbody->SetMatrixDirty(false);
+
+        m_rigidbodyTranslation = m_rigidbody->GetTranslation();
+        m_rigidbodyRotation = m_rigidbody->GetRotation();
+    }
+
+    bool RigidbodyImpl::Interpolate(float_t alpha) {
+        if (!m_isInterpolated || !m_rigidbody || !m_rigidbody->GetTransform()) {
+            return false;
+        }
+
+        alpha = SR_MAX(0.f, SR_MIN(alpha, 1.f));
+
+        auto&& translation = m_previousTranslation + (m_currentTranslation - m_previousTranslation) * alpha;
+
+        /// normalized lerp by the shortest arc, the states are too close to each other to need a slerp
+        const double_t dot = m_previousRotation.X() * m_currentRotation.X() + m_previousRotation.Y() * m_currentRotation.Y()
+            + m_previousRotation.Z() * m_currentRotation.Z() + m_previousRotation.W() * m_currentRotation.W();
+        const double_t sign = dot < 0.0 ? -1.0 : 1.0;
+
+        const double_t x = m_previousRotation.X() + (sign * m_currentRotation.X() - m_previousRotation.X()) * alpha;
+        const double_t y = m_previousRotation.Y() + (sign * m_currentRotation.Y() - m_previousRotation.Y()) * alpha;
+        const double_t z = m_previousRotation.Z() + (sign * m_currentRotation.Z() - m_previousRotation.Z()) * alpha;
+        const double_t w = m_previousRotation.W() + (sign * m_currentRotation.W() - m_previousRotation.W()) * alpha;
+        const double_t length = std::sqrt(x * x + y * y + z * z + w * w);
+
+        auto&& rotation = length > 0.0 ? SR_MATH_NS::Quaternion(x / length, y / length, z / length, w / length) : m_currentRotation;
+
+        /// the synchronized pose stays the simulated one, so the visual pose is never pushed back to the simulation
+        m_rigidbody->ApplyPose(translation, rotation);
+
+        return true;
+    }
+
+    void RigidbodyImpl::RestoreSimulatedPose() {
+        if (m_isInterpolated && m_rigidbody) {
+            m_rigidbody->ApplyPose(m_currentTranslation, m_currentRotation);
+        }
+    }
+
+    void RigidbodyImpl::ShiftSimulatedState(const SR_MATH_NS::FVector3& shift) {
+        if (m_rigidbodyTranslation.IsFinite()) {
+            m_rigidbodyTranslation += shift;
+        }
+
+        /// the interpolation goes on between the shifted states
+        m_previousTranslation += shift;
+        m_currentTranslation += shift;
+    }
+
+    /// ----------------------------------------------------------------------------------------------------------------
+
     Rigidbody::~Rigidbody() {
         SR_SAFE_DELETE_PTR(m_shape);
         SR_SAFE_DELETE_PTR(m_impl);
@@ -76,6 +150,35 @@ namespace SR_PTYPES_NS {
             })
             .SetSameLine();
 
+        m_properties.AddStandardProperty("Collision events", &m_hasCollisionEvents)
+            .SetSetter([this](void* pValue){
+                m_hasCollisionEvents = *reinterpret_cast<bool*>(pValue);
+                SetShapeDirty(true);
+            });
+
+        m_properties.AddStandardProperty("Stay events", &m_hasCollisionStayEvents)
+            .SetSetter([this](void* pValue){
+                m_hasCollisionStayEvents = *reinterpret_cast<bool*>(pValue);
+                SetShapeDirty(true);
+            })
+            .SetSameLine();
+
+        m_properties.AddStandardProperty("Trigger events", &m_hasTriggerEvents)
+            .SetSetter([this](void* pValue){
+                m_hasTriggerEvents = *reinterpret_cast<bool*>(pValue);
+                SetShapeDirty(true);
+            })
+            .SetSameLine();
+
+        m_properties.AddCustomProperty<SR_UTILS_NS::StandardProperty>("Collision layer")
+            .SetGetter([this](void* pData) {
+                *reinterpret_cast<std::string*>(pData) = m_collisionLayer.ToStringRef();
+            })
+            .SetSetter([this](void* pData) {
+                SetCollisionLayer(*reinterpret_cast<std::string*>(pData));
+            })
+            .SetType(SR_UTILS_NS::StandardType::String);
+
         m_properties.AddCustomProperty<SR_UTILS_NS::PathProperty>("Physics material")
             .SetGetter([this]() { return m_material ? m_material->GetResourcePath() : SR_UTILS_NS::Path(); })
             .SetSetter([this](const SR_UTILS_NS::Path& path) {
@@ -160,16 +263,109 @@ namespace SR_PTYPES_NS {
             m_shape->UpdateDebugShape();
         }
 
+        if (m_isApplyingPose) {
+            Component::OnMatrixDirty();
+            return;
+        }
+
+        /// the scene logic moves all root transforms, they are checked against the shift at once when it is known
+        if (auto&& physicsScene = GetPhysicsScene(); physicsScene && physicsScene->IsOriginShifting()) {
+            m_isMatrixDirty = true;
+            physicsScene->DeferOriginShift(this);
+            Component::OnMatrixDirty();
+            return;
+        }
+
+        CatchUpOrigin();
+
+        /// the origin was shifted before the transform, the simulation is already there
+        if (!IsMatrixDirty() && IsPoseSynchronized()) {
+            Component::OnMatrixDirty();
+            return;
+        }
+
         SetMatrixDirty(true);
 
         Component::OnMatrixDirty();
     }
 
+    void Rigidbody::ShiftOrigin(const SR_MATH_NS::FVector3& shift) {
+        if (m_impl) {
+            m_impl->ShiftOrigin(shift);
+        }
+
+        CatchUpOrigin();
+    }
+
+    void Rigidbody::CatchUpOrigin() {
+        auto&& physicsScene = GetPhysicsScene();
+        if (!physicsScene) {
+            return;
+        }
+
+        const SR_MATH_NS::FVector3 originShift = physicsScene->GetOriginShift();
+
+        /// the same sum of the shifts is copied, so the exact comparison is fine
+        if (originShift.x == m_originShift.x && originShift.y == m_originShift.y && originShift.z == m_originShift.z) {
+            return;
+        }
+
+        const SR_MATH_NS::FVector3 shift = originShift - m_originShift;
+
+        m_originShift = originShift;
+
+        if (m_impl) {
+            m_impl->ShiftSimulatedState(shift);
+        }
+
+        if (!m_synchronizedTranslation.IsFinite()) {
+            return;
+        }
+
+        m_synchronizedTranslation += shift;
+
+        /// the transform was shifted before the origin, only a real move keeps it dirty
+        if (IsMatrixDirty() && IsPoseSynchronized()) {
+            SetMatrixDirty(false);
+        }
+    }
+
+    bool Rigidbody::ResolveOriginShift(const SR_MATH_NS::FVector3& requestedShift) {
+        CatchUpOrigin();
+
+        if (!IsPoseSynchronized(requestedShift)) {
+            return false;
+        }
+
+        /// the simulation gets there by the shift of the origin, nothing to push
+        m_isMatrixDirty = false;
+
+        return true;
+    }
+
+    bool Rigidbody::IsPoseSynchronized(const SR_MATH_NS::FVector3& offset) const {
+        if (!m_synchronizedTranslation.IsFinite() || !m_synchronizedRotation.IsFinite()) {
+            return false;
+        }
+
+        if (!m_translation.IsEquals(m_synchronizedTranslation + offset, SR_MATH_NS::Unit(0.001))) {
+            return false;
+        }
+
+        if (!m_scale.IsEquals(m_synchronizedScale, SR_MATH_NS::Unit(0.0001))) {
+            return false;
+        }
+
+        return (m_rotation * m_synchronizedRotation.Inverse()).IsEquals(SR_MATH_NS::FVector3(SR_MATH_NS::Unit(0)), SR_MATH_NS::Unit(0.0001));
+    }
+
     bool Rigidbody::UpdateMatrix(bool force) {
         if ((!force && !IsMatrixDirty())) {
             return false;
         }
 
+        CatchUpOrigin();
+
         if (m_impl) {
             m_impl->UpdateMatrix(force);
         }
@@ -192,6 +388,8 @@ namespace SR_PTYPES_NS {
 
     void Rigidbody::SetCenter(const SR_MATH_NS::FVector3& center) {
         m_center = center;
+        /// the pose is the same, but the body is not
+        m_synchronizedTranslation = SR_MATH_NS::InfinityFV3;
         SetMatrixDirty(true);
         m_shape->UpdateDebugShape();
     }
@@ -262,11 +460,98 @@ namespace SR_PTYPES_NS {
     void Rigidbody::SetIsTrigger(bool value) {
         m_isTrigger = value;
         m_isBodyDirty = true;
+        QueueSynchronization();
     }
 
     void Rigidbody::SetIsStatic(bool value) {
         m_isStatic = value;
         m_isBodyDirty = true;
+        QueueSynchronization();
+    }
+
+    ContactEventFlags Rigidbody::GetContactEvents() const noexcept {
+        ContactEventFlags events = static_cast<ContactEventFlags>(ContactEvent::None);
+
+        if (m_hasCollisionEvents) {
+            events |= static_cast<ContactEventFlags>(ContactEvent::Collision);
+        }
+
+        if (m_hasCollisionStayEvents) {
+            events |= static_cast<ContactEventFlags>(ContactEvent::CollisionStay);
+        }
+
+        if (m_hasTriggerEvents) {
+            events |= static_cast<ContactEventFlags>(ContactEvent::Trigger);
+        }
+
+        return events;
+    }
+
+    SR_UTILS_NS::StringAtom Rigidbody::GetCollisionLayer() const {
+        if (!m_collisionLayer.ToStringRef().empty()) {
+            return m_collisionLayer;
+        }
+
+        if (auto&& pGameObject = GetGameObject()) {
+            return pGameObject->GetLayer();
+        }
+
+        return m_collisionLayer;
+    }
+
+    void Rigidbody::SetCollisionLayer(SR_UTILS_NS::StringAtom layer) {
+        if (m_collisionLayer == layer) {
+            return;
+        }
+
+        m_collisionLayer = layer;
+
+        /// the layer is a part of the filter data of the shape
+        SetShapeDirty(true);
+    }
+
+    void Rigidbody::SetContactEvents(ContactEventFlags events) {
+        if (events == GetContactEvents()) {
+            return;
+        }
+
+        m_hasCollisionEvents = events & static_cast<ContactEventFlags>(ContactEvent::Collision);
+        m_hasCollisionStayEvents = events & static_cast<ContactEventFlags>(ContactEvent::CollisionStay);
+        m_hasTriggerEvents = events & static_cast<ContactEventFlags>(ContactEvent::Trigger);
+
+        /// the events are a part of the filter data of the shape
+        SetShapeDirty(true);
+    }
+
+    void Rigidbody::SetMatrixDirty(bool value) {
+        m_isMatrixDirty = value;
+
+        if (value) {
+            QueueSynchronization();
+        }
+        else {
+            /// the impl keeps the simulated pose of the same origin
+            CatchUpOrigin();
+
+            m_synchronizedTranslation = m_translation;
+            m_synchronizedRotation = m_rotation;
+            m_synchronizedScale = m_scale;
+        }
+    }
+
+    void Rigidbody::SetShapeDirty(bool value) {
+        m_isShapeDirty = value;
+
+        if (value) {
+            QueueSynchronization();
+        }
+    }
+
+    void Rigidbody::QueueSynchronization() {
+        /// a rigidbody without a scene is queued when it is added to the world
+        if (auto&& physicsScene = GetPhysicsScene()) {
+            physicsScene->MarkDirty(this);
+        }
     }
 
     RBUpdShapeRes Rigidbody::UpdateShape() {
@@ -274,6 +559,14 @@ namespace SR_PTYPES_NS {
             return RBUpdShapeRes::Nothing;
         }
 
+        /// the placeholder stays attached, the shape is updated by the synchronization after the cooking
+        if (m_shape->IsCooking()) {
+            QueueSynchronization();
+            return RBUpdShapeRes::Nothing;
+        }
+
+        const bool wasPlaceholder = m_shape->IsPlaceholder();
+
         m_shape->RemoveDebugShape();
 
         if (!m_shape->UpdateShape()) {
@@ -290,7 +583,15 @@ namespace SR_PTYPES_NS {
 
         UpdateMatrix(true);
 
-        SetShapeDirty(false);
+        SetShapeDirty(m_shape->IsPlaceholder());
+
+        if (wasPlaceholder && !m_shape->IsPlaceholder()) {
+            UpdateInertia();
+
+            if (m_shapeCookedCallback) {
+                m_shapeCookedCallback(this);
+            }
+        }
 
         return RBUpdShapeRes::Updated;
     }
@@ -301,6 +602,9 @@ namespace SR_PTYPES_NS {
             return false;
         }
 
+        /// the body is created in the current origin
+        CatchUpOrigin();
+
         if (m_impl) {
             m_impl->InitBody();
         }
@@ -393,10 +697,57 @@ namespace SR_PTYPES_NS {
         return m_impl ? m_impl->GetHandle() : nullptr;
     }
 
-    void Rigidbody::Synchronize() {
+    void Rigidbody::Synchronize(bool interpolate) {
+        CatchUpOrigin();
+
         if (m_impl) {
-            m_impl->Synchronize();
+            m_impl->Synchronize(interpolate);
+        }
+    }
+
+    void Rigidbody::Interpolate(float_t alpha) {
+        CatchUpOrigin();
+
+        /// moved by the gameplay after the synchronization, the move is pushed as a teleport
+        if (!m_impl || IsMatrixDirty()) {
+            return;
+        }
+
+        m_hasVisualPose = m_impl->Interpolate(alpha);
+    }
+
+    void Rigidbody::RestoreSimulatedPose() {
+        if (!m_hasVisualPose) {
+            return;
+        }
+
+        m_hasVisualPose = false;
+
+        /// moved by the editor after the interpolation, the move is pushed as a teleport
+        if (!m_impl || IsMatrixDirty()) {
+            return;
         }
+
+        CatchUpOrigin();
+
+        m_impl->RestoreSimulatedPose();
+    }
+
+    void Rigidbody::ApplyPose(const SR_MATH_NS::FVector3& translation, const SR_MATH_NS::Quaternion& rotation) {
+        auto&& pTransform = GetTransform();
+        if (!pTransform) {
+            return;
+        }
+
+        m_isApplyingPose = true;
+
+        if (auto&& delta = translation - m_translation; !delta.IsEquals(SR_MATH_NS::FVector3(SR_MATH_NS::Unit(0)), SR_MATH_NS::Unit(0.00001))) {
+            pTransform->GlobalTranslate(delta);
+        }
+
+        pTransform->SetRotation(rotation);
+
+        m_isApplyingPose = false;
     }
 
     bool Rigidbody::IsShapeSupported(ShapeType type) const {
@@ -59,6 +59,38 @@ namespace SR_CORE_NS {
             logDir = folder;
         }
 
+        m_isBenchmark = SR_UTILS_NS::HasCmdOption(argv, argv + argc, "--benchmark");
+        /// benchmarks run on machines without a GPU
+        m_isHeadless = m_isBenchmark || SR_UTILS_NS::HasCmdOption(argv, argv + argc, "--headless");
+
+        if (auto&& tickRate = SR_UTILS_NS::GetCmdOption(argv, argv + argc, "--tick-rate"); !tickRate.empty()) {
+            m_tickRate = static_cast<uint32_t>(SR_MAX(std::atoi(tickRate.c_str()), 1));
+        }
+
+        if (auto&& scene = SR_UTILS_NS::GetCmdOption(argv, argv + argc, "--scene"); !scene.empty()) {
+            m_startupScene = scene;
+        }
+
+        if (auto&& stateTimings = SR_UTILS_NS::GetCmdOption(argv, argv + argc, "--state-timings"); !stateTimings.empty()) {
+            m_stateTimingsPath = stateTimings;
+        }
+
+        if (auto&& physicsStatistics = SR_UTILS_NS::GetCmdOption(argv, argv + argc, "--physics-stats"); !physicsStatistics.empty()) {
+            m_physicsStatisticsPath = physicsStatistics;
+        }
+
+        if (auto&& recordInput = SR_UTILS_NS::GetCmdOption(argv, argv + argc, "--record-input"); !recordInput.empty()) {
+            m_recordInputPath = recordInput;
+        }
+
+        if (auto&& replayInput = SR_UTILS_NS::GetCmdOption(argv, argv + argc, "--replay-input"); !replayInput.empty()) {
+            m_replayInputPath = replayInput;
+        }
+
+        if (auto&& lockedDt = SR_UTILS_NS::GetCmdOption(argv, argv + argc, "--locked-dt"); !lockedDt.empty()) {
+            m_lockedDeltaTime = SR_MAX(static_cast<float_t>(std::atof(lockedDt.c_str())), 0.f);
+        }
+
         return InitLogger(logDir);
     }
 
@@ -78,7 +110,13 @@ namespace SR_CORE_NS {
         SR_HTYPES_NS::Thread::Factory::Instance().SetMainThread();
         SR_HTYPES_NS::Time::Instance().Update();
 
-        SR_UTILS_NS::Features::Instance().SetPath(m_resourcesPath.Concat("Engine/Configs/Features.xml"));
+        if (m_isHeadless) {
+            SR_SYSTEM_LOG("Application::EarlyInit() : running in headless mode, tick rate is {}", m_tickRate);
+            SR_UTILS_NS::Features::Instance().SetPath(m_resourcesPath.Concat("Engine/Configs/FeaturesHeadless.xml"));
+        }
+        else {
+            SR_UTILS_NS::Features::Instance().SetPath(m_resourcesPath.Concat("Engine/Configs/Features.xml"));
+        }
         SR_UTILS_NS::Features::Instance().Reload();
 
         if (SR_UTILS_NS::Features::Instance().Enabled("SegmentationHandler", false)) {
@@ -226,8 +264,10 @@ namespace SR_CORE_NS {
             if (!m_engine) {
                 SR_ERROR("Application::Execute() : engine lost!");
                 hasErrors = true;
+                break;
             }
 
+            /// blocks until the engine is stopped, reloaded or the wait times out
             if (!m_engine->Execute()) {
                 SR_SYSTEM_LOG("Application::Execute() : engine is not alive!");
                 break;
@@ -3,10 +3,13 @@
 //
 
 #include <Core/Engine.h>
+#include <Core/Application.h>
 #include <Core/EngineResources.h>
 #include <Core/EngineMigrators.h>
 #include <Core/GUI/EditorGUI.h>
 #include <Core/World/EngineScene.h>
+#include <Core/Utils/InputRecorder.h>
+#include <Core/Tests/Benchmark.h>
 
 #include <Utils/Events/EventManager.h>
 #include <Utils/World/Scene.h>
@@ -42,6 +45,11 @@ namespace SR_CORE_NS {
     { }
 
     Engine::~Engine() {
+        SR_SAFE_DELETE_PTR(m_threadStateSync);
+        SR_SAFE_DELETE_PTR(m_framePacer);
+        SR_SAFE_DELETE_PTR(m_stateTimings);
+        SR_SAFE_DELETE_PTR(m_jobSystem);
+
         m_renderContext.AutoFree([](auto&& pContext) {
             delete pContext;
         });
@@ -146,10 +154,21 @@ namespace SR_CORE_NS {
         /// m_localizationManager->LoadInfoAsConfigFile(configPath);
         ///TEST
 
-        m_renderContext = new SR_GRAPH_NS::RenderContext();
+        if (SR_UTILS_NS::Features::Instance().Enabled("Renderer", true)) {
+            m_renderContext = new SR_GRAPH_NS::RenderContext();
+        }
 
         m_cmdManager = new SR_UTILS_NS::CmdManager();
         m_input = new SR_UTILS_NS::InputDispatcher();
+        m_jobSystem = new JobSystem(JobSystem::GetDefaultWorkersCount());
+
+        SR_PHYSICS_NS::Raycast3D::Instance().SetParallelFor([this](uint32_t count, uint32_t batchSize, const SR_HTYPES_NS::Function<void(uint32_t, uint32_t)>& function) {
+            m_jobSystem->ParallelFor(count, batchSize, function);
+        });
+
+        SR_PHYSICS_NS::PhysicsLibrary::Instance().SetJobScheduler([this](SR_PHYSICS_NS::PhysicsLibrary::Job job) {
+            m_jobSystem->Schedule(std::move(job));
+        }, m_jobSystem->GetWorkersCount());
 
         if (SR_UTILS_NS::Features::Instance().Enabled("Editor")) {
             m_editor = new SR_CORE_GUI_NS::EditorGUI(GetThis());
@@ -172,7 +191,13 @@ namespace SR_CORE_NS {
 
         m_autoReloadResources = SR_UTILS_NS::Features::Instance().Enabled("AutoReloadResources", false);
 
-        if (!m_engineScene && (m_editor && !m_editor->LoadSceneFromCachedPath())) {
+        if (!m_engineScene && !m_application->GetStartupScene().IsEmpty()) {
+            if (!SetScene(SR_WORLD_NS::Scene::Load(m_application->GetStartupScene()))) {
+                SR_ERROR("Engine::Create() : failed to load startup scene!\n\tPath: " + m_application->GetStartupScene().ToString());
+            }
+        }
+        /// without the editor (headless) there is no cached scene, the default one is used
+        else if (!m_engineScene && (!m_editor || !m_editor->LoadSceneFromCachedPath())) {
             auto&& scenePath = SR_WORLD_NS::Scene::NewScenePath.ConcatExt("scene");
 
             if (SR_WORLD_NS::Scene::IsExists(scenePath)) {
@@ -185,7 +210,56 @@ namespace SR_CORE_NS {
             }
         }
 
-        m_threadsWorker = SR_UTILS_NS::ThreadsWorker::Load("Engine/Configs/Threads.yml");
+        m_threadStateSync = new ThreadStateSync();
+        /// the headless profile has the same states, so the synchronization rules are kept only in Threads.yml
+        if (!m_threadStateSync->LoadConditions(SR_UTILS_NS::ResourceManager::Instance().GetResPath().Concat("Engine/Configs/Threads.yml"))) {
+            SR_ERROR("Engine::Create() : failed to load the conditions of the thread states!");
+            return false;
+        }
+        /// the benchmark summarizes all measured frames, the window of the states has to hold them
+        if (auto&& benchmark = Benchmark::Instance(); benchmark.IsActive()) {
+            m_stateTimings = new StateTimings(SR_MAX(benchmark.GetFrames(), StateTimingBuffer::DefaultCapacity));
+        }
+        else {
+            m_stateTimings = new StateTimings();
+        }
+
+        /// the benchmark reports the physics step from the statistics of the physics scene
+        if (!m_application->GetPhysicsStatisticsPath().IsEmpty() || Benchmark::Instance().IsActive()) {
+            SR_PHYSICS_NS::PhysicsLibrary::Instance().SetStatisticsEnabled(true);
+        }
+
+        m_framePacer = new FramePacer();
+        m_framePacer->Load(SR_UTILS_NS::ResourceManager::Instance().GetResPath().Concat("Engine/Configs/FramePacing.xml"));
+
+        if (m_application->IsBenchmark()) {
+            m_framePacer->SetMode(FramePacingMode::Uncapped);
+        }
+        else if (IsHeadless()) {
+            m_framePacer->SetMode(FramePacingMode::FixedFPS);
+            m_framePacer->SetTargetFPS(m_application->GetTickRate());
+        }
+
+        if (auto&& path = m_application->GetReplayInputPath(); !path.IsEmpty()) {
+            if (!InputRecorder::Instance().StartReplay(path, m_application->GetLockedDeltaTime())) {
+                SR_ERROR("Engine::Create() : failed to start input replay!\n\tPath: " + path.ToString());
+                return false;
+            }
+        }
+        else if (auto&& recordPath = m_application->GetRecordInputPath(); !recordPath.IsEmpty()) {
+            InputRecorder::Instance().StartRecording(recordPath);
+        }
+
+        /// the recorder stores the events of the dispatcher, while replaying it dispatches them to the same handlers
+        if (InputRecorder::Instance().IsReplaying()) {
+            InputRecorder::Instance().Register(&Graphics::GUI::GlobalWidgetManager::Instance());
+            InputRecorder::Instance().Register(m_editor);
+        }
+        else if (InputRecorder::Instance().GetMode() == InputRecorderMode::Record) {
+            m_input->Register(&InputRecorder::Instance());
+        }
+
+        m_threadsWorker = SR_UTILS_NS::ThreadsWorker::Load(IsHeadless() ? "Engine/Configs/ThreadsHeadless.yml" : "Engine/Configs/Threads.yml");
         if (!m_threadsWorker) {
             SR_ERROR("Engine::Create() : failed to load threads worker!");
             return false;
@@ -235,7 +309,12 @@ namespace SR_CORE_NS {
         });
 
         pWindow->SetScrollCallback([](double_t xOffset, double_t yOffset) {
+            /// the replayed scroll is set by the recorder
+            if (InputRecorder::Instance().IsReplaying()) {
+                return;
+            }
             SR_UTILS_NS::Input::Instance().SetMouseScroll(xOffset, yOffset);
+            InputRecorder::Instance().OnScroll(xOffset, yOffset);
         });
 
         return pWindow;
@@ -256,6 +335,9 @@ namespace SR_CORE_NS {
 
         SR_UTILS_NS::Input::Instance().SetCursorLockCallback([this](){
             auto&& pMainWindow = GetMainWindow();
+            if (!pMainWindow) {
+                return;
+            }
             auto&& resolution = pMainWindow->GetSize();
             resolution /= 2;
             SR_PLATFORM_NS::SetMousePos(pMainWindow->GetPosition() + resolution.Cast<int32_t>());
@@ -296,6 +378,13 @@ namespace SR_CORE_NS {
 
         m_isRun = false;
 
+        WakeUp();
+
+        /// wake up the states waiting for each other, otherwise the worker can not be stopped
+        if (m_threadStateSync) {
+            m_threadStateSync->Stop();
+        }
+
         if (m_threadsWorker) {
             if (m_threadsWorker->IsActive()) {
                 m_threadsWorker->Stop();
@@ -303,6 +392,27 @@ namespace SR_CORE_NS {
             m_threadsWorker.Reset();
         }
 
+        InputRecorder::Instance().Stop();
+
+        /// the job system is deleted with the engine
+        SR_PHYSICS_NS::Raycast3D::Instance().SetParallelFor(SR_PHYSICS_NS::SceneQueryParallelFor());
+        SR_PHYSICS_NS::PhysicsLibrary::Instance().SetJobScheduler(SR_PHYSICS_NS::PhysicsLibrary::JobScheduler(), 0);
+
+        if (auto&& path = m_application->GetStateTimingsPath(); m_stateTimings && !path.IsEmpty()) {
+            if (path.GetExtensionView() == "json") {
+                m_stateTimings->DumpJSON(path);
+            }
+            else {
+                m_stateTimings->DumpCSV(path);
+            }
+        }
+
+        if (auto&& path = m_application->GetPhysicsStatisticsPath(); !path.IsEmpty()) {
+            if (auto&& pPhysicsScene = GetPhysicsScene()) {
+                pPhysicsScene->GetStatistics().DumpCSV(path);
+            }
+        }
+
         SR_INFO("Engine::Close() : destroying the editor...");
 
         if (m_editor && m_editor->Enabled()) {
@@ -310,6 +420,7 @@ namespace SR_CORE_NS {
             m_editor->Save();
             m_editor->Enable(false);
             m_input->Unregister(m_editor);
+            InputRecorder::Instance().Unregister(m_editor);
         }
         SR_SAFE_DELETE_PTR(m_editor);
 
@@ -339,32 +450,46 @@ namespace SR_CORE_NS {
 
     void Engine::Reload() {
         m_application->Reload();
+        WakeUp();
     }
 
     void Engine::FixedUpdate() {
         SR_TRACY_ZONE;
 
-        ///В этом блоке находится обработка нажатия клавиш, которая не должна срабатывать, если окно не сфокусированно
-        if (IsApplicationFocused())
-        {
+        auto&& recorder = InputRecorder::Instance();
+
+        /// the replay does not check the live input and does not depend on the focus, the recorded events are dispatched instead
+        if (recorder.IsReplaying()) {
+            recorder.OnTick();
+        }
+        else if (IsApplicationFocused()) {
             SR_UTILS_NS::Input::Instance().Check();
             m_input->Check();
+        }
 
-            bool lShiftPressed = SR_UTILS_NS::Input::Instance().GetKeyDown(SR_UTILS_NS::KeyCode::LShift);
+        /// every tick is recorded, even without the focus, so the replay keeps the ticks of the frame in place
+        if (recorder.GetMode() == InputRecorderMode::Record) {
+            recorder.OnTick();
+        }
 
-            if (!IsGameMode() && SR_UTILS_NS::Input::Instance().GetKey(SR_UTILS_NS::KeyCode::Ctrl)) {
-                if (SR_UTILS_NS::Input::Instance().GetKeyDown(SR_UTILS_NS::KeyCode::Z)) {
+        ///В этом блоке находится обработка нажатия клавиш, которая не должна срабатывать, если окно не сфокусированно
+        if (IsApplicationFocused() || recorder.IsReplaying())
+        {
+            bool lShiftPressed = recorder.GetKeyDown(SR_UTILS_NS::KeyCode::LShift);
+
+            if (!IsGameMode() && recorder.GetKey(SR_UTILS_NS::KeyCode::Ctrl)) {
+                if (recorder.GetKeyDown(SR_UTILS_NS::KeyCode::Z)) {
                     m_cmdManager->Cancel();
                 }
 
-                if (SR_UTILS_NS::Input::Instance().GetKeyDown(SR_UTILS_NS::KeyCode::Y)) {
+                if (recorder.GetKeyDown(SR_UTILS_NS::KeyCode::Y)) {
                     if (!m_cmdManager->Redo()) {
                         SR_WARN("Engine::FixedUpdate() : failed to redo \"" + m_cmdManager->GetLastCmdName() + "\" command!");
                     }
                 }
             }
 
-            if (!IsGameMode() && m_editor && SR_UTILS_NS::Input::Instance().GetKeyDown(SR_UTILS_NS::KeyCode::F1)) {
+            if (!IsGameMode() && m_editor && recorder.GetKeyDown(SR_UTILS_NS::KeyCode::F1)) {
                 m_editor->SetDockingEnabled(!m_editor->IsDockingEnabled());
             }
 
@@ -372,7 +497,7 @@ namespace SR_CORE_NS {
             //     SR_UTILS_NS::Input::Instance().LockCursor(!SR_UTILS_NS::Input::Instance().IsCursorLocked());
             // }
 
-            if (m_editor && IsActive() && SR_UTILS_NS::Input::Instance().GetKeyDown(SR_UTILS_NS::KeyCode::F2)) {
+            if (m_editor && IsActive() && recorder.GetKeyDown(SR_UTILS_NS::KeyCode::F2)) {
                 SetGameMode(!IsGameMode());
 
                 if(IsGameMode()) {
@@ -383,7 +508,7 @@ namespace SR_CORE_NS {
                 }
             }
 
-            if (SR_UTILS_NS::Input::Instance().GetKeyDown(SR_UTILS_NS::KeyCode::F3) && lShiftPressed) {
+            if (recorder.GetKeyDown(SR_UTILS_NS::KeyCode::F3) && lShiftPressed) {
                 Reload();
                 return;
             }
@@ -429,6 +554,11 @@ namespace SR_CORE_NS {
             return false;
         }
 
+        /// states on the other threads must not touch the scene while it is being replaced
+        if (m_threadStateSync) {
+            m_threadStateSync->Pause();
+        }
+
         m_sceneQueue.Flush([this](auto&& newScene) {
             if (m_cmdManager) {
                 m_cmdManager->Clear();
@@ -452,6 +582,10 @@ namespace SR_CORE_NS {
             }
         });
 
+        if (m_threadStateSync) {
+            m_threadStateSync->Resume();
+        }
+
         if (m_editor && m_engineScene) {
             m_editor->SetScene(m_engineScene->pScene);
         }
@@ -504,7 +638,15 @@ namespace SR_CORE_NS {
 
     bool Engine::Execute() {
         SR_TRACY_ZONE;
-        SR_LOCK_GUARD;
+
+        /// the worker can die without notifying us, so the state is rechecked periodically
+        {
+            std::unique_lock<std::mutex> lock(m_executeMutex);
+            m_executeCondition.wait_for(lock, std::chrono::milliseconds(100), [this]() {
+                return m_executeWakeUp || !IsRun() || !m_threadsWorker || !m_threadsWorker->IsAlive();
+            });
+            m_executeWakeUp = false;
+        }
 
         bool isAlive = true;
 
@@ -513,7 +655,7 @@ namespace SR_CORE_NS {
             isAlive = false;
         }
 
-        if (!m_threadsWorker->IsAlive()) {
+        if (!m_threadsWorker || !m_threadsWorker->IsAlive()) {
             SR_SYSTEM_LOG("Engine::Execute() : threads worker is not alive!");
             isAlive = false;
         }
@@ -526,6 +668,14 @@ namespace SR_CORE_NS {
         return isAlive;
     }
 
+    void Engine::WakeUp() {
+        {
+            std::lock_guard<std::mutex> lock(m_executeMutex);
+            m_executeWakeUp = true;
+        }
+        m_executeCondition.notify_all();
+    }
+
     void Engine::AddWindow(Engine::WindowPtr pWindow) {
         pWindow->SetResizeCallback([this](auto&& size) {
             if (m_renderContext) {
@@ -536,6 +686,10 @@ namespace SR_CORE_NS {
         m_windows.emplace_back(std::move(pWindow));
     }
 
+    bool Engine::IsHeadless() const {
+        return m_application && m_application->IsHeadless();
+    }
+
     bool Engine::IsApplicationFocused() const {
         if (m_windows.empty()) {
             return true;
@@ -4,6 +4,7 @@
 
 #include <Core/EvoScriptAPI.h>
 #include <Core/Engine.h>
+#include <Core/Utils/InputRecorder.h>
 
 #include <Core/UI/Button.h>
 
@@ -24,6 +25,7 @@
 
 #include <Physics/3D/Rigidbody3D.h>
 #include <Physics/3D/Raycast3D.h>
+#include <Physics/3D/CharacterController3D.h>
 
 #include <Audio/Types/AudioSource.h>
 
@@ -131,6 +133,10 @@ namespace SpaRcle {
         ESRegisterCustomStaticMethod(EvoScript::Public, generator, Raycast3D, Cast, std::vector<RaycastHit>, ESArg4(const FVector3& origin, const FVector3& direction, float_t maxDistance, uint32_t maxHits), {
             return Raycast3D::Instance().Cast(origin, direction, maxDistance, maxHits);
         });
+
+        ESRegisterCustomStaticMethod(EvoScript::Public, generator, Raycast3D, CastAny, bool, ESArg3(const FVector3& origin, const FVector3& direction, float_t maxDistance), {
+            return Raycast3D::Instance().CastAny(origin, direction, maxDistance);
+        });
     }
 
     void API::RegisterEngine(EvoScript::AddressTableGen *generator) {
@@ -409,6 +415,17 @@ namespace SpaRcle {
                 { "Libraries/Math/Vector3.h", "Libraries/Math/Vector2.h", "Libraries/Component.h" }, {
                 { "Component", EvoScript::Public }
         });
+
+        generator->RegisterNewClass("CharacterController3D", "CharacterController3D",
+                { "Libraries/Math/Vector3.h", "Libraries/Component.h" }, {
+                { "Component", EvoScript::Public }
+        });
+
+        ESRegisterMethod(EvoScript::Public, generator, CharacterController3D, Move, void, ESArg1(const FVector3& displacement), ESArg1(displacement))
+        ESRegisterMethod(EvoScript::Public, generator, CharacterController3D, SetVerticalVelocity, void, ESArg1(float_t velocity), ESArg1(velocity))
+        ESRegisterMethodArg0(EvoScript::Public, generator, CharacterController3D, IsGrounded, bool)
+        ESRegisterMethodArg0(EvoScript::Public, generator, CharacterController3D, GetVerticalVelocity, float_t)
+        ESRegisterMethodArg0(EvoScript::Public, generator, CharacterController3D, GetVelocity, FVector3)
     }
 
     void API::RegisterRender(EvoScript::AddressTableGen *generator) {
@@ -489,31 +506,31 @@ namespace SpaRcle {
         // ESRegisterStaticMethod(EvoScript::Public, generator, Input, GetKeyUp, bool, ESArg1(KeyCode key), ESArg1(key))
 
         ESRegisterCustomStaticMethod(EvoScript::Public, generator, Input, GetKey, bool, ESArg1(KeyCode key), {
-            return SR_UTILS_NS::Input::Instance().GetKey(key);
+            return SR_CORE_NS::InputRecorder::Instance().GetKey(key);
         });
 
         ESRegisterCustomStaticMethod(EvoScript::Public, generator, Input, GetKeyDown, bool, ESArg1(KeyCode key), {
-            return SR_UTILS_NS::Input::Instance().GetKeyDown(key);
+            return SR_CORE_NS::InputRecorder::Instance().GetKeyDown(key);
         });
 
         ESRegisterCustomStaticMethod(EvoScript::Public, generator, Input, GetKeyUp, bool, ESArg1(KeyCode key), {
-            return SR_UTILS_NS::Input::Instance().GetKeyUp(key);
+            return SR_CORE_NS::InputRecorder::Instance().GetKeyUp(key);
         });
 
         ESRegisterCustomStaticMethod(EvoScript::Public, generator, Input, GetMouseDown, bool, ESArg1(MouseCode key), {
-            return SR_UTILS_NS::Input::Instance().GetMouseDown(key);
+            return SR_CORE_NS::InputRecorder::Instance().GetMouseDown(key);
         });
 
         ESRegisterCustomStaticMethod(EvoScript::Public, generator, Input, GetMouse, bool, ESArg1(MouseCode key), {
-            return SR_UTILS_NS::Input::Instance().GetMouse(key);
+            return SR_CORE_NS::InputRecorder::Instance().GetMouse(key);
         });
 
         ESRegisterCustomStaticMethod(EvoScript::Public, generator, Input, GetMouseUp, bool, ESArg1(MouseCode key), {
-            return SR_UTILS_NS::Input::Instance().GetMouseUp(key);
+            return SR_CORE_NS::InputRecorder::Instance().GetMouseUp(key);
         });
 
         ESRegisterCustomStaticMethodArg0(EvoScript::Public, generator, Input, GetMouseDrag, FVector2, {
-            return SR_UTILS_NS::Input::Instance().GetMouseDrag();
+            return SR_CORE_NS::InputRecorder::Instance().GetMouseDrag();
         });
 
         generator->RegisterEnum("MouseCode", "Input", true, {
@@ -666,6 +683,7 @@ namespace SpaRcle {
         ESRegisterDynamicCast(generator, ProceduralMesh, Component)
         ESRegisterDynamicCast(generator, Rigidbody3D, Component)
         ESRegisterDynamicCast(generator, Rigidbody, Component)
+        ESRegisterDynamicCast(generator, CharacterController3D, Component)
         ESRegisterDynamicCast(generator, Text, Component)
         ESRegisterDynamicCast(generator, Button, Component)
         ESRegisterDynamicCast(generator, Animator, Component)
@@ -3,6 +3,8 @@
 //
 
 #include <Core/GUI/EngineStatistics.h>
+#include <Core/GUI/EditorGUI.h>
+#include <Core/Engine.h>
 
 #include <Utils/Resources/ResourceManager.h>
 
@@ -19,6 +21,9 @@
 #include <Graphics/Pipeline/Vulkan/VulkanMemory.h>
 #include <Graphics/Render/RenderQueue.h>
 
+#include <Physics/PhysicsLib.h>
+#include <Physics/PhysicsScene.h>
+
 namespace SR_CORE_GUI_NS {
     EngineStatistics::EngineStatistics()
         : SR_GRAPH_GUI_NS::Widget("Engine statistics")
@@ -34,6 +39,7 @@ namespace SR_CORE_GUI_NS {
             VideoMemoryPage();
             SubmitQueuePage();
             RenderStrategyPage();
+            PhysicsPage();
 
             ImGui::EndTabBar();
         }
@@ -103,6 +109,71 @@ namespace SR_CORE_GUI_NS {
 
     void EngineStatistics::ThreadsPage() {
         if (ImGui::BeginTabItem("Threads")) {
+            auto&& pEditor = dynamic_cast<EditorGUI*>(GetManager());
+            if (!pEditor || !pEditor->GetEngine()) {
+                ImGui::EndTabItem();
+                return;
+            }
+
+            auto&& pEngine = pEditor->GetEngine();
+
+            if (auto&& pFramePacer = pEngine->GetFramePacer()) {
+                auto&& stats = pFramePacer->GetStats();
+                SR_GRAPH_GUI_NS::Text(SR_FORMAT_C("Frame pacing: {} ({} fps)", SR_UTILS_NS::EnumReflector::ToStringAtom(pFramePacer->GetMode()).ToStringRef(), pFramePacer->GetTargetFPS()));
+                SR_GRAPH_GUI_NS::Text(SR_FORMAT_C("Frame: {:.3f} ms, slept: {:.3f} ms, spun: {:.3f} ms", stats.frameTime, stats.slept, stats.spun));
+                ImGui::Separator();
+            }
+
+            auto&& pTimings = pEngine->GetStateTimings();
+            if (!pTimings) {
+                ImGui::EndTabItem();
+                return;
+            }
+
+            if (ImGui::Button("Dump CSV")) {
+                pTimings->DumpCSV(SR_UTILS_NS::ResourceManager::Instance().GetCachePath().Concat("Profiling/StateTimings.csv"));
+            }
+
+            ImGui::SameLine();
+
+            if (ImGui::Button("Dump JSON")) {
+                pTimings->DumpJSON(SR_UTILS_NS::ResourceManager::Instance().GetCachePath().Concat("Profiling/StateTimings.json"));
+            }
+
+            if (ImGui::BeginTable("##StateTimingsTable", 6, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg)) {
+                ImGui::TableSetupColumn("State");
+                ImGui::TableSetupColumn("Last, ms");
+                ImGui::TableSetupColumn("p50, ms");
+                ImGui::TableSetupColumn("p95, ms");
+                ImGui::TableSetupColumn("p99, ms");
+                ImGui::TableSetupColumn("Max, ms");
+                ImGui::TableHeadersRow();
+
+                for (auto&& summary : pTimings->Summarize()) {
+                    ImGui::TableNextRow();
+
+                    ImGui::TableSetColumnIndex(0);
+                    ImGui::Text("%s", summary.name.c_str());
+
+                    ImGui::TableSetColumnIndex(1);
+                    ImGui::Text("%.3f", summary.last);
+
+                    ImGui::TableSetColumnIndex(2);
+                    ImGui::Text("%.3f", summary.p50);
+
+                    ImGui::TableSetColumnIndex(3);
+                    ImGui::Text("%.3f", summary.p95);
+
+                    ImGui::TableSetColumnIndex(4);
+                    ImGui::Text("%.3f", summary.p99);
+
+                    ImGui::TableSetColumnIndex(5);
+                    ImGui::Text("%.3f", summary.max);
+                }
+
+                ImGui::EndTable();
+            }
+
             ImGui::EndTabItem();
         }
     }
@@ -588,4 +659,92 @@ namespace SR_CORE_GUI_NS {
 
         ImGui::EndTabItem();
     }
+
+    void EngineStatistics::PhysicsPage() {
+        if (!ImGui::BeginTabItem("Physics")) {
+            return;
+        }
+
+        auto&& pEditor = dynamic_cast<EditorGUI*>(GetManager());
+        auto&& pPhysicsScene = pEditor && pEditor->GetEngine() ? pEditor->GetEngine()->GetPhysicsScene() : SR_PHYSICS_NS::PhysicsScene::Ptr();
+
+        if (!pPhysicsScene) {
+            ImGui::Text("No physics scene!");
+            ImGui::EndTabItem();
+            return;
+        }
+
+        auto&& physicsLibrary = SR_PHYSICS_NS::PhysicsLibrary::Instance();
+
+        bool isEnabled = physicsLibrary.IsStatisticsEnabled();
+        if (SR_GRAPH_GUI_NS::CheckBox("Collect statistics", isEnabled)) {
+            physicsLibrary.SetStatisticsEnabled(isEnabled);
+        }
+
+        ImGui::SameLine();
+
+        if (ImGui::Button("Dump CSV")) {
+            pPhysicsScene->GetStatistics().DumpCSV(SR_UTILS_NS::ResourceManager::Instance().GetCachePath().Concat("Profiling/PhysicsStatistics.csv"));
+        }
+
+        auto&& samples = pPhysicsScene->GetStatistics().GetSamples();
+        if (samples.empty()) {
+            ImGui::Text("No samples.");
+            ImGui::EndTabItem();
+            return;
+        }
+
+        auto&& last = samples.back();
+
+        ImGui::Separator();
+        SR_GRAPH_GUI_NS::Text(SR_FORMAT_C("Bodies: {} active, {} sleeping, {} static", last.activeBodies, last.sleepingBodies, last.staticBodies));
+        SR_GRAPH_GUI_NS::Text(SR_FORMAT_C("Broadphase pairs: {}, contacts: {}, islands: {}", last.broadPhasePairs, last.contacts, last.islands));
+        ImGui::Separator();
+
+        std::vector<float_t> values;
+        values.reserve(samples.size());
+
+        auto&& drawGraph = [&samples, &values](const char* label, auto&& getValue) {
+            values.clear();
+
+            float_t max = 0.f;
+
+            for (auto&& sample : samples) {
+                values.emplace_back(static_cast<float_t>(getValue(sample)));
+                max = SR_MAX(max, values.back());
+            }
+
+            /// the scale of a graph is its own maximum over the window, so the spikes are visible
+            ImGui::PlotLines(label, values.data(), static_cast<int32_t>(values.size()), 0, SR_FORMAT_C("{:.3f}", values.back()),
+                0.f, SR_MAX(max, 0.001f), ImVec2(0, 50));
+        };
+
+        if (ImGui::CollapsingHeader("Counters", ImGuiTreeNodeFlags_DefaultOpen)) {
+            drawGraph("Active bodies", [](auto&& sample) { return sample.activeBodies; });
+            drawGraph("Sleeping bodies", [](auto&& sample) { return sample.sleepingBodies; });
+            drawGraph("Static bodies", [](auto&& sample) { return sample.staticBodies; });
+            drawGraph("Broadphase pairs", [](auto&& sample) { return sample.broadPhasePairs; });
+            drawGraph("Contacts", [](auto&& sample) { return sample.contacts; });
+            drawGraph("Islands", [](auto&& sample) { return sample.islands; });
+        }
+
+        if (ImGui::CollapsingHeader("Times, ms", ImGuiTreeNodeFlags_DefaultOpen)) {
+            drawGraph("Simulate", [](auto&& sample) { return sample.simulateTime; });
+            drawGraph("Fetch", [](auto&& sample) { return sample.fetchTime; });
+
+            /// PhysX and Bullet do not measure the phases of the step, zero graphs would only mislead
+            const bool hasPhaseTimes = std::any_of(samples.begin(), samples.end(), [](auto&& sample) { return sample.hasPhaseTimes; });
+            if (hasPhaseTimes) {
+                drawGraph("Broadphase", [](auto&& sample) { return sample.broadPhaseTime; });
+                drawGraph("Narrowphase", [](auto&& sample) { return sample.narrowPhaseTime; });
+                drawGraph("Solver", [](auto&& sample) { return sample.solverTime; });
+            }
+
+            drawGraph("Synchronize", [](auto&& sample) { return sample.synchronizeTime; });
+            drawGraph("Contact callbacks", [](auto&& sample) { return sample.callbackTime; });
+            drawGraph("Cooking", [](auto&& sample) { return sample.cookingTime; });
+        }
+
+        ImGui::EndTabItem();
+    }
 }
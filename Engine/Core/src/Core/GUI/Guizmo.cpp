@@ -8,6 +8,7 @@
 #include <Physics/LibraryImpl.h>
 
 #include <Core/GUI/Guizmo.h>
+#include <Core/Utils/InputRecorder.h>
 
 namespace SR_CORE_GUI_NS {
     Guizmo::Guizmo(const EnginePtr& pEngine)
@@ -223,7 +224,7 @@ namespace SR_CORE_GUI_NS {
             }
         }
         else {
-            if (IsUse() && SR_UTILS_NS::Input::Instance().GetMouseUp(SR_UTILS_NS::MouseCode::MouseLeft)) {
+            if (IsUse() && SR_CORE_NS::InputRecorder::Instance().GetMouseUp(SR_UTILS_NS::MouseCode::MouseLeft)) {
                 auto&& cmd = new SR_CORE_NS::Commands::GameObjectTransform(m_engine, m_transform->GetGameObject(), m_marshal->CopyPtr());
                 m_engine->GetCmdManager()->Execute(cmd, SR_UTILS_NS::SyncType::Async);
 
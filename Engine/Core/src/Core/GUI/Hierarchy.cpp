@@ -4,6 +4,7 @@
 
 #include <Core/GUI/Hierarchy.h>
 #include <Core/GUI/SceneRunner.h>
+#include <Core/Utils/InputRecorder.h>
 
 #include <Utils/Input/InputSystem.h>
 #include <Utils/Platform/Platform.h>
@@ -28,7 +29,7 @@ namespace SR_CORE_GUI_NS {
     void Hierarchy::Draw() {
         SR_LOCK_GUARD;
 
-        m_shiftPressed = SR_UTILS_NS::Input::Instance().GetKey(SR_UTILS_NS::KeyCode::LShift);
+        m_shiftPressed = SR_CORE_NS::InputRecorder::Instance().GetKey(SR_UTILS_NS::KeyCode::LShift);
 
         if (m_scene.TryRecursiveLockIfValid()) {
             m_tree = m_scene->GetRootSceneObjects();
@@ -3,6 +3,7 @@
 //
 
 #include <Core/GUI/Inspector.h>
+#include <Core/Utils/InputRecorder.h>
 
 #include <Utils/ECS/Transform3D.h>
 #include <Utils/ECS/Transform2D.h>
@@ -132,7 +133,7 @@ namespace SR_CORE_GUI_NS {
                     m_isUsed = true;
                 }
 
-                if (m_isUsed && SR_UTILS_NS::Input::Instance().GetMouseUp(SR_UTILS_NS::MouseCode::MouseLeft)) {
+                if (m_isUsed && SR_CORE_NS::InputRecorder::Instance().GetMouseUp(SR_UTILS_NS::MouseCode::MouseLeft)) {
                     auto&& cmd = new SR_CORE_NS::Commands::GameObjectTransform(pEngine, pGameObject, m_oldTransformMarshal->CopyPtr());
                     pEngine->GetCmdManager()->Execute(cmd, SR_UTILS_NS::SyncType::Async);
 
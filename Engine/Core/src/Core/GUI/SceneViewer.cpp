@@ -7,6 +7,7 @@
 #include <Core/GUI/EditorCamera.h>
 #include <Core/GUI/EditorGizmo.h>
 #include <Core/GUI/Guizmo.h>
+#include <Core/Utils/InputRecorder.h>
 #include <Graphics/Material/UniqueMaterial.h>
 
 #include <Utils/Input/InputSystem.h>
@@ -161,24 +162,24 @@ namespace SR_CORE_GUI_NS {
         constexpr float_t moveSpeed = 2.0f / 10.f;
 
         const float_t velocitySpeed = moveSpeed * velocityFactor;
-        auto&& dir = SR_UTILS_NS::Input::Instance().GetMouseDrag();
-        auto&& wheel = SR_UTILS_NS::Input::Instance().GetMouseWheel() * wheelSpeed * velocityFactor;
+        auto&& dir = SR_CORE_NS::InputRecorder::Instance().GetMouseDrag();
+        auto&& wheel = SR_CORE_NS::InputRecorder::Instance().GetMouseWheel() * wheelSpeed * velocityFactor;
 
-        if (!SR_UTILS_NS::Input::Instance().GetKey(SR_UTILS_NS::KeyCode::Ctrl))
+        if (!SR_CORE_NS::InputRecorder::Instance().GetKey(SR_UTILS_NS::KeyCode::Ctrl))
         {
-            if (SR_UTILS_NS::Input::Instance().GetKey(SR_UTILS_NS::KeyCode::W)) {
+            if (SR_CORE_NS::InputRecorder::Instance().GetKey(SR_UTILS_NS::KeyCode::W)) {
                 m_velocity += SR_UTILS_NS::Transform3D::FORWARD * velocitySpeed;
             }
 
-            if (SR_UTILS_NS::Input::Instance().GetKey(SR_UTILS_NS::KeyCode::S)) {
+            if (SR_CORE_NS::InputRecorder::Instance().GetKey(SR_UTILS_NS::KeyCode::S)) {
                 m_velocity -= SR_UTILS_NS::Transform3D::FORWARD * velocitySpeed;
             }
 
-            if (SR_UTILS_NS::Input::Instance().GetKey(SR_UTILS_NS::KeyCode::A)) {
+            if (SR_CORE_NS::InputRecorder::Instance().GetKey(SR_UTILS_NS::KeyCode::A)) {
                 m_velocity -= SR_UTILS_NS::Transform3D::RIGHT * velocitySpeed;
             }
 
-            if (SR_UTILS_NS::Input::Instance().GetKey(SR_UTILS_NS::KeyCode::D)) {
+            if (SR_CORE_NS::InputRecorder::Instance().GetKey(SR_UTILS_NS::KeyCode::D)) {
                 m_velocity += SR_UTILS_NS::Transform3D::RIGHT * velocitySpeed;
             }
 
@@ -198,11 +199,11 @@ namespace SR_CORE_GUI_NS {
                 m_camera->GetTransform()->Translate(SR_UTILS_NS::Transform3D::FORWARD * wheel);
             }
 
-            if (SR_UTILS_NS::Input::Instance().GetKey(SR_UTILS_NS::KeyCode::MouseRight)) {
+            if (SR_CORE_NS::InputRecorder::Instance().GetKey(SR_UTILS_NS::KeyCode::MouseRight)) {
                 m_camera->GetTransform()->GlobalRotate(dir.y * rotateSpeed, dir.x * rotateSpeed, 0.0);
             }
 
-            if (SR_UTILS_NS::Input::Instance().GetKey(SR_UTILS_NS::KeyCode::MouseMiddle)) {
+            if (SR_CORE_NS::InputRecorder::Instance().GetKey(SR_UTILS_NS::KeyCode::MouseMiddle)) {
                 auto right = SR_UTILS_NS::Transform3D::RIGHT * seekSpeed;
                 auto up = SR_UTILS_NS::Transform3D::UP * seekSpeed;
 
@@ -0,0 +1,28 @@
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <Core/States/ChunkInstantiateState.h>
+#include <Core/Engine.h>
+#include <Core/World/EngineScene.h>
+
+#include <Utils/World/Scene.h>
+
+namespace SR_CORE_NS {
+    SR_UTILS_NS::ThreadWorkerResult ChunkInstantiateState::ExecuteSynced() {
+        SR_TRACY_ZONE_N("ChunkInstantiateState");
+
+        auto&& pEngine = GetContext().GetPointer<Engine>();
+        auto&& pScene = pEngine->GetScene();
+        auto&& pEngineScene = pEngine->GetEngineScene();
+
+        if (!pEngineScene || !pScene) {
+            return SR_UTILS_NS::ThreadWorkerResult::Success;
+        }
+
+        /// the loaded chunks are instantiated by the PostLoad() of the scene update every frame
+        pEngineScene->UpdateChunkDebug();
+
+        return SR_UTILS_NS::ThreadWorkerResult::Success;
+    }
+}
@@ -9,12 +9,17 @@
 #include <Graphics/Render/RenderScene.h>
 #include <Graphics/Types/Camera.h>
 
+#include <Physics/PhysicsScene.h>
+
 #include <Utils/World/Scene.h>
 #include <Utils/World/SceneCubeChunkLogic.h>
 
 namespace SR_CORE_NS {
-    SR_UTILS_NS::ThreadWorkerResult ChunkSystemState::ExecuteImpl() {
+    SR_UTILS_NS::ThreadWorkerResult ChunkSystemState::ExecuteSynced() {
+        SR_TRACY_ZONE_N("ChunkSystemState");
+
         if (!m_worldTimer.Update()) {
+            SetProduced(false);
             return SR_UTILS_NS::ThreadWorkerResult::Success;
         }
 
@@ -23,24 +28,52 @@ namespace SR_CORE_NS {
         auto&& pEngineScene = pEngine->GetEngineScene();
 
         if (!pEngineScene || !pScene) {
+            SetProduced(false);
             return SR_UTILS_NS::ThreadWorkerResult::Success;
         }
 
+        /// headless server has no camera, the observer is set by the game logic
         auto&& pMainCamera = pEngineScene->GetMainCamera();
-        if (!pMainCamera) {
+        if (!pMainCamera && !pEngine->IsHeadless()) {
+            SetProduced(false);
             return SR_UTILS_NS::ThreadWorkerResult::Success;
         }
 
-        else if (auto&& gameObject = dynamic_cast<SR_UTILS_NS::GameObject*>(pMainCamera->GetParent())) {
-            auto&& pLogic = pScene->GetLogicBase().DynamicCast<SR_WORLD_NS::SceneCubeChunkLogic>();
-            if (pLogic && gameObject) {
-                pLogic->SetObserver(gameObject);
-            }
+        auto&& pLogic = pScene->GetLogicBase().DynamicCast<SR_WORLD_NS::SceneCubeChunkLogic>();
+
+        auto&& gameObject = pMainCamera ? dynamic_cast<SR_UTILS_NS::GameObject*>(pMainCamera->GetParent()) : nullptr;
+        if (gameObject && pLogic) {
+            pLogic->SetObserver(gameObject);
+        }
+
+        /// any chunk is fine to see the shift of the world offset, it moves all of them
+        const SR_MATH_NS::IVector3 anchor(1, 1, 1);
+        const SR_MATH_NS::FVector3 anchorPosition = pLogic ? pLogic->GetWorldPosition(anchor, anchor) : SR_MATH_NS::FVector3();
+
+        auto&& pPhysicsScene = pEngine->GetPhysicsScene();
+
+        /// the rigidbodies moved by the shift of the world offset are checked at once after the update
+        if (pPhysicsScene) {
+            pPhysicsScene->BeginOriginShift();
         }
 
+        /// chunks are loaded here and instantiated by ChunkInstantiateState right after it
         pScene->GetLogicBase()->Update(m_worldTimer.GetDeltaTime());
 
-        pEngineScene->UpdateChunkDebug();
+        /// the shifted transforms are not teleports, the physics moves its origin by the same shift at once
+        SR_MATH_NS::FVector3 shift(SR_MATH_NS::Unit(0));
+
+        if (pLogic) {
+            shift = pLogic->GetWorldPosition(anchor, anchor) - anchorPosition;
+
+            if (shift.IsEquals(SR_MATH_NS::FVector3(SR_MATH_NS::Unit(0)), SR_MATH_NS::Unit(0.0001))) {
+                shift = SR_MATH_NS::FVector3(SR_MATH_NS::Unit(0));
+            }
+        }
+
+        if (pPhysicsScene) {
+            pPhysicsScene->EndOriginShift(shift);
+        }
 
         return SR_UTILS_NS::ThreadWorkerResult::Success;
     }
@@ -3,9 +3,12 @@
 //
 
 #include <Core/States/DeltaTimeState.h>
+#include <Core/Utils/InputRecorder.h>
+#include <Core/Tests/Benchmark.h>
+#include <Core/Engine.h>
 
 namespace SR_CORE_NS {
-    SR_UTILS_NS::ThreadWorkerResult DeltaTimeState::ExecuteImpl() {
+    SR_UTILS_NS::ThreadWorkerResult DeltaTimeState::ExecuteState() {
         SR_HTYPES_NS::Time::Instance().Update();
 
         const auto now = SR_HTYPES_NS::Time::Instance().Now();
@@ -15,9 +18,29 @@ namespace SR_CORE_NS {
         }
 
         const auto deltaTime = now - m_timeStart.value(); /// nanoseconds
-        const auto dt = static_cast<float_t>(deltaTime.count()) / SR_CLOCKS_PER_SEC / SR_CLOCKS_PER_SEC / SR_CLOCKS_PER_SEC; /// Seconds
+        auto dt = static_cast<float_t>(deltaTime.count()) / SR_CLOCKS_PER_SEC / SR_CLOCKS_PER_SEC / SR_CLOCKS_PER_SEC; /// Seconds
         m_timeStart = now;
 
+        auto&& recorder = InputRecorder::Instance();
+        if (recorder.GetMode() != InputRecorderMode::None) {
+            dt = recorder.OnFrame(dt);
+
+            if (recorder.IsReplaying() && recorder.IsFinished()) {
+                SR_SYSTEM_LOG("DeltaTimeState::ExecuteState() : input replay is finished, stopping the engine...");
+                GetThreadsWorker()->StopAsync();
+                return SR_UTILS_NS::ThreadWorkerResult::Break;
+            }
+        }
+
+        if (auto&& benchmark = Benchmark::Instance(); benchmark.IsActive()) {
+            auto&& pEngine = GetContext().GetPointer<Engine>();
+            if (benchmark.OnFrame(pEngine)) {
+                SR_SYSTEM_LOG("DeltaTimeState::ExecuteState() : benchmark is finished, stopping the engine...");
+                GetThreadsWorker()->StopAsync();
+                return SR_UTILS_NS::ThreadWorkerResult::Break;
+            }
+        }
+
         GetContext().SetValue("DeltaTime", dt);
 
         return SR_UTILS_NS::ThreadWorkerResult::Success;
@@ -10,7 +10,7 @@
 #include <Core/World/EngineScene.h>
 
 namespace SR_CORE_NS {
-    SR_UTILS_NS::ThreadWorkerResult DrawState::ExecuteImpl() {
+    SR_UTILS_NS::ThreadWorkerResult DrawState::ExecuteSynced() {
         auto&& pEngine = GetContext().GetPointer<Engine>();
         auto&& pEngineScene = pEngine->GetEngineScene();
 
@@ -19,6 +19,13 @@ namespace SR_CORE_NS {
         }
 
         auto&& pWindow = pEngine->GetMainWindow();
+
+        /// headless, there is nothing to draw
+        if (!pWindow && pEngine->IsHeadless()) {
+            SetProduced(false);
+            return SR_UTILS_NS::ThreadWorkerResult::Success;
+        }
+
         if (!pWindow || !pWindow->IsVisible()) {
             return SR_UTILS_NS::ThreadWorkerResult::Break;
         }
@@ -41,8 +48,12 @@ namespace SR_CORE_NS {
             }
         }
 
+        /// TODO: the render snapshot is not implemented yet. RenderScene::Render() reads the live components,
+        ///  so the draw stays on the engine thread and only the submit overlaps the next frame.
+        ///  The transforms, the camera and the renderables have to be captured by RenderScene (Graphics) after SceneUpdate,
+        ///  then the draw can move to the render thread and wait only for that capture.
         pRenderScene->Render();
 
         return SR_UTILS_NS::ThreadWorkerResult::Success;
     }
-}
\ No newline at end of file
+}
@@ -0,0 +1,39 @@
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <Core/States/EngineThreadState.h>
+#include <Core/Utils/StateTimings.h>
+#include <Core/Engine.h>
+
+namespace SR_CORE_NS {
+    SR_UTILS_NS::ThreadWorkerResult EngineThreadState::ExecuteImpl() {
+        auto&& pEngine = GetContext().GetPointer<Engine>();
+        auto&& pTimings = pEngine ? pEngine->GetStateTimings() : nullptr;
+
+        if (!pTimings) {
+            return ExecuteState();
+        }
+
+        if (!m_timings) {
+            m_timings = pTimings->GetBuffer(GetStateName());
+        }
+
+        m_waitTime = 0.0;
+
+        const auto start = std::chrono::steady_clock::now();
+        const auto result = ExecuteState();
+        const auto elapsed = std::chrono::duration<double_t, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        m_timings->Push(SR_MAX(elapsed - m_waitTime, 0.0));
+
+        if (m_waitTime > 0.0 || m_waitTimings) {
+            if (!m_waitTimings) {
+                m_waitTimings = pTimings->GetBuffer(GetStateName() + " (wait)");
+            }
+            m_waitTimings->Push(m_waitTime);
+        }
+
+        return result;
+    }
+}
@@ -0,0 +1,31 @@
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <Core/States/FramePacingState.h>
+#include <Core/Utils/FramePacer.h>
+#include <Core/Engine.h>
+
+#include <Graphics/Render/RenderContext.h>
+#include <Graphics/Pipeline/Pipeline.h>
+
+namespace SR_CORE_NS {
+    SR_UTILS_NS::ThreadWorkerResult FramePacingState::ExecuteState() {
+        auto&& pEngine = GetContext().GetPointer<Engine>();
+        auto&& pFramePacer = pEngine->GetFramePacer();
+
+        if (!pFramePacer) {
+            return SR_UTILS_NS::ThreadWorkerResult::Success;
+        }
+
+        if (auto&& pRenderContext = pEngine->GetRenderContext(); pRenderContext && pRenderContext->GetPipeline()) {
+            if (pFramePacer->ConsumeVSyncChanged()) {
+                pRenderContext->GetPipeline()->SetVSyncEnabled(pFramePacer->GetMode() == FramePacingMode::VSync);
+            }
+        }
+
+        pFramePacer->WaitForNextFrame();
+
+        return SR_UTILS_NS::ThreadWorkerResult::Success;
+    }
+}
@@ -11,7 +11,7 @@
 #include <Core/GUI/EditorGUI.h>
 
 namespace SR_CORE_NS {
-    SR_UTILS_NS::ThreadWorkerResult InitializeState::ExecuteImpl() {
+    SR_UTILS_NS::ThreadWorkerResult InitializeState::ExecuteState() {
         if (m_isInitialized) {
             return SR_UTILS_NS::ThreadWorkerResult::Success;
         }
@@ -19,6 +19,12 @@ namespace SR_CORE_NS {
         auto&& pEngine = GetContext().GetPointer<Engine>();
         auto&& pRenderContext = pEngine->GetRenderContext();
 
+        /// headless, nothing to initialize
+        if (!pRenderContext && !pEngine->GetMainWindow()) {
+            m_isInitialized = true;
+            return SR_UTILS_NS::ThreadWorkerResult::Success;
+        }
+
         auto&& pWindow = pEngine->GetMainWindow();
         auto&& pWindowImpl = pWindow ? pWindow->GetImplementation<SR_GRAPH_NS::BasicWindowImpl>() : nullptr;
 
@@ -0,0 +1,25 @@
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <Core/States/PhysicsSimulationState.h>
+#include <Core/Engine.h>
+
+#include <Physics/PhysicsScene.h>
+
+namespace SR_CORE_NS {
+    SR_UTILS_NS::ThreadWorkerResult PhysicsSimulationState::ExecuteSynced() {
+        SR_TRACY_ZONE_N("PhysicsSimulationState");
+
+        auto&& pEngine = GetContext().GetPointer<Engine>();
+
+        /// the result is produced even without steps, synchronization waits for it every frame.
+        /// Waits for the step started by the scene update off the engine thread, Bullet and Box2D
+        /// can't step in the background and simulate the whole step here.
+        if (auto&& pPhysicsScene = pEngine->GetPhysicsScene()) {
+            pPhysicsScene->Simulate();
+        }
+
+        return SR_UTILS_NS::ThreadWorkerResult::Success;
+    }
+}
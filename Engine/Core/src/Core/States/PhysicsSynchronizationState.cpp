@@ -0,0 +1,34 @@
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <Core/States/PhysicsSynchronizationState.h>
+#include <Core/Engine.h>
+
+#include <Physics/PhysicsScene.h>
+
+namespace SR_CORE_NS {
+    SyncThreadState::Condition PhysicsSynchronizationState::GetStartCondition() {
+        Condition condition = Super::GetStartCondition();
+
+        /// wait only if the simulation of the previous frame is requested or in flight,
+        /// otherwise (first frame, scene switch) just skip the synchronization
+        auto&& pSync = GetContext().GetPointer<Engine>()->GetThreadStateSync();
+        const bool isExpected = pSync->IsReady("SceneUpdate") || !pSync->IsIdle("PhysicsSimulation") || pSync->IsReady("PhysicsSimulation");
+        condition.timeout = isExpected ? Milliseconds(-1) : Milliseconds(0);
+
+        return condition;
+    }
+
+    SR_UTILS_NS::ThreadWorkerResult PhysicsSynchronizationState::ExecuteSynced() {
+        SR_TRACY_ZONE_N("PhysicsSynchronizationState");
+
+        auto&& pEngine = GetContext().GetPointer<Engine>();
+
+        if (auto&& pPhysicsScene = pEngine->GetPhysicsScene()) {
+            pPhysicsScene->Synchronize();
+        }
+
+        return SR_UTILS_NS::ThreadWorkerResult::Success;
+    }
+}
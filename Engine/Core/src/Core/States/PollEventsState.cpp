@@ -9,12 +9,12 @@
 #include <Core/Engine.h>
 
 namespace SR_CORE_NS {
-    SR_UTILS_NS::ThreadWorkerResult PollEventsState::ExecuteImpl() {
+    SR_UTILS_NS::ThreadWorkerResult PollEventsState::ExecuteState() {
         auto&& pEngine = GetContext().GetPointer<Engine>();
 
         if (auto&& pWindow = pEngine->GetMainWindow()) {
             if (!pWindow->IsValid()) {
-                SR_SYSTEM_LOG("PollEventsState::ExecuteImpl() : main window is invalid!");
+                SR_SYSTEM_LOG("PollEventsState::ExecuteState() : main window is invalid!");
                 GetThreadsWorker()->StopAsync();
                 return SR_UTILS_NS::ThreadWorkerResult::Break;
             }
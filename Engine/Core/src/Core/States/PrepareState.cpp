@@ -8,6 +8,7 @@
 
 #include <Scripting/Impl/EvoScriptManager.h>
 
+#include <Physics/2D/Raycast2D.h>
 #include <Physics/3D/Raycast3D.h>
 #include <Physics/PhysicsScene.h>
 
@@ -20,10 +21,18 @@
 #include <Utils/Common/Features.h>
 
 namespace SR_CORE_NS {
-    SR_UTILS_NS::ThreadWorkerResult PrepareState::ExecuteImpl() {
+    void PrepareState::ExecuteBeforeSync() {
+        /// pauses all synchronized states, so it can not be called while this state is busy
+        GetContext().GetPointer<Engine>()->FlushScene();
+    }
+
+    SR_UTILS_NS::ThreadWorkerResult PrepareState::ExecuteSynced() {
         auto&& pEngine = GetContext().GetPointer<Engine>();
 
-        pEngine->FlushScene();
+        /// the previous frame has drawn the interpolated poses, nothing of this frame may read them
+        if (auto&& pPhysicsScene = pEngine->GetPhysicsScene()) {
+            pPhysicsScene->RestoreSimulatedPoses();
+        }
 
         SR_SCRIPTING_NS::EvoScriptManager::Instance().Update(false);
 
@@ -36,6 +45,8 @@ namespace SR_CORE_NS {
         }
 
         if (auto&& pPhysicsScene = pEngine->GetPhysicsScene()) {
+            /// the worlds are created by the first rigidbody of their space
+            SR_PHYSICS_NS::Raycast2D::Instance().SwitchPhysics(pPhysicsScene->Get2DWorld());
             SR_PHYSICS_NS::Raycast3D::Instance().SwitchPhysics(pPhysicsScene->Get3DWorld());
         }
 
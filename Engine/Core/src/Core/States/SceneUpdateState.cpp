@@ -13,7 +13,7 @@
 #include <Utils/DebugDraw.h>
 
 namespace SR_CORE_NS {
-    SR_UTILS_NS::ThreadWorkerResult SceneUpdateState::ExecuteImpl() {
+    SR_UTILS_NS::ThreadWorkerResult SceneUpdateState::ExecuteSynced() {
         SR_TRACY_ZONE_N("SceneUpdateState");
 
         const auto dt = GetContext().GetValue<float_t>("DeltaTime");
@@ -5,7 +5,7 @@
 #include <Core/States/StopState.h>
 
 namespace SR_CORE_NS {
-    SR_UTILS_NS::ThreadWorkerResult StopState::ExecuteImpl() {
+    SR_UTILS_NS::ThreadWorkerResult StopState::ExecuteState() {
         GetThreadsWorker()->StopAsync();
         return SR_UTILS_NS::ThreadWorkerResult::Break;
     }
@@ -6,16 +6,30 @@
 
 #include <Graphics/Window/Window.h>
 #include <Graphics/Render/RenderScene.h>
+#include <Graphics/Render/RenderContext.h>
 #include <Graphics/Pipeline/Pipeline.h>
 
 #include <Core/Engine.h>
 #include <Core/World/EngineScene.h>
 
 namespace SR_CORE_NS {
-    SR_UTILS_NS::ThreadWorkerResult SubmitState::ExecuteImpl() {
+    SR_UTILS_NS::ThreadWorkerResult SubmitState::ExecuteSynced() {
         auto&& pEngine = GetContext().GetPointer<Engine>();
 
+        /// submit can live on its own thread, the render context is thread local
+        if (!m_isContextAttached && SR_THIS_THREAD) {
+            SR_THIS_THREAD->GetContext()->SetValue<SR_GRAPH_NS::RenderContext::Ptr>(pEngine->GetRenderContext());
+            m_isContextAttached = true;
+        }
+
         auto&& pWindow = pEngine->GetMainWindow();
+
+        /// headless, there is nothing to draw
+        if (!pWindow && pEngine->IsHeadless()) {
+            SetProduced(false);
+            return SR_UTILS_NS::ThreadWorkerResult::Success;
+        }
+
         if (!pWindow || !pWindow->IsVisible()) {
             return SR_UTILS_NS::ThreadWorkerResult::Break;
         }
@@ -0,0 +1,51 @@
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <Core/States/SyncThreadState.h>
+#include <Core/Engine.h>
+
+namespace SR_CORE_NS {
+    SyncThreadState::Condition SyncThreadState::GetStartCondition() {
+        auto&& pEngine = GetContext().GetPointer<Engine>();
+        auto&& pSync = pEngine ? pEngine->GetThreadStateSync() : nullptr;
+        return pSync ? pSync->GetStartCondition(GetStateName()) : Condition();
+    }
+
+    SyncThreadState::Condition SyncThreadState::GetFinishCondition() {
+        auto&& pEngine = GetContext().GetPointer<Engine>();
+        auto&& pSync = pEngine ? pEngine->GetThreadStateSync() : nullptr;
+        return pSync ? pSync->GetFinishCondition(GetStateName()) : Condition();
+    }
+
+    SR_UTILS_NS::ThreadWorkerResult SyncThreadState::ExecuteState() {
+        auto&& pEngine = GetContext().GetPointer<Engine>();
+        auto&& pSync = pEngine ? pEngine->GetThreadStateSync() : nullptr;
+
+        ExecuteBeforeSync();
+
+        if (!pSync) {
+            return ExecuteSynced();
+        }
+
+        const std::string name = GetStateName();
+
+        const auto waitStart = std::chrono::steady_clock::now();
+        const bool isStarted = pSync->Begin(name, GetStartCondition(), IsProducer());
+        AddWaitTime(std::chrono::duration<double_t, std::milli>(std::chrono::steady_clock::now() - waitStart).count());
+
+        if (!isStarted) {
+            return SR_UTILS_NS::ThreadWorkerResult::Success;
+        }
+
+        m_produced = true;
+
+        const auto result = ExecuteSynced();
+
+        const auto finishStart = std::chrono::steady_clock::now();
+        pSync->End(name, GetFinishCondition(), m_produced && result == SR_UTILS_NS::ThreadWorkerResult::Success);
+        AddWaitTime(std::chrono::duration<double_t, std::milli>(std::chrono::steady_clock::now() - finishStart).count());
+
+        return result;
+    }
+}
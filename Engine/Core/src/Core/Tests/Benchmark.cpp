@@ -0,0 +1,342 @@
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <Core/Tests/Benchmark.h>
+#include <Core/Engine.h>
+
+#include <Utils/Common/CmdOptions.h>
+#include <Utils/Resources/Xml.h>
+#include <Utils/Resources/ResourceManager.h>
+
+#ifdef SR_LINUX
+    #include <sys/resource.h>
+#endif
+
+namespace SR_CORE_NS {
+    namespace {
+        /// absolute noise floor, milliseconds or megabytes, tiny values are never reported as regressions
+        constexpr double_t BenchmarkTolerance = 0.05;
+
+        double_t Percentile(std::vector<double_t> samples, double_t p) {
+            if (samples.empty()) {
+                return 0.0;
+            }
+
+            std::sort(samples.begin(), samples.end());
+
+            const auto index = static_cast<size_t>(p * static_cast<double_t>(samples.size() - 1) + 0.5);
+            return samples[SR_MIN(index, samples.size() - 1)];
+        }
+    }
+
+    bool Benchmark::Configure(int argc, char** argv) {
+        auto&& resourceManager = SR_UTILS_NS::ResourceManager::Instance();
+
+        m_name = SR_UTILS_NS::GetCmdOption(argv, argv + argc, "--benchmark");
+        if (m_name.empty()) {
+            SR_ERROR("Benchmark::Configure() : benchmark name or scene is not set!");
+            return false;
+        }
+
+        m_scenePath = m_name;
+
+        auto&& document = SR_XML_NS::Document::Load(resourceManager.GetResPath().Concat("Engine/Configs/Benchmarks.xml"));
+        if (document.Valid()) {
+            auto&& benchmarksNode = document.Root().GetNode("Benchmarks");
+
+            auto&& defaultsNode = benchmarksNode.TryGetNode("Defaults");
+            m_frames = static_cast<uint32_t>(SR_MAX(defaultsNode.TryGetAttribute("Frames").ToInt(static_cast<int32_t>(m_frames)), 1));
+            m_warmup = static_cast<uint32_t>(SR_MAX(defaultsNode.TryGetAttribute("Warmup").ToInt(static_cast<int32_t>(m_warmup)), 0));
+            if (auto&& margin = defaultsNode.TryGetAttribute("Margin").ToString(); !margin.empty()) {
+                m_margin = SR_MAX(std::atof(margin.c_str()), 0.0);
+            }
+
+            for (auto&& benchmarkNode : benchmarksNode.TryGetNodes()) {
+                if (benchmarkNode.TryGetAttribute("Name").ToString() == m_name) {
+                    m_scenePath = benchmarkNode.GetAttribute("Scene").ToString();
+                    break;
+                }
+            }
+        }
+        else {
+            SR_WARN("Benchmark::Configure() : benchmark list is not found, \"" + m_name + "\" is used as a scene path.");
+        }
+
+        /// a path passed instead of a name gives the report a readable name
+        if (m_scenePath == m_name) {
+            m_name = m_scenePath.GetBaseName();
+        }
+
+        if (auto&& frames = SR_UTILS_NS::GetCmdOption(argv, argv + argc, "--frames"); !frames.empty()) {
+            m_frames = static_cast<uint32_t>(SR_MAX(std::atoi(frames.c_str()), 1));
+        }
+
+        if (auto&& warmup = SR_UTILS_NS::GetCmdOption(argv, argv + argc, "--warmup"); !warmup.empty()) {
+            m_warmup = static_cast<uint32_t>(SR_MAX(std::atoi(warmup.c_str()), 0));
+        }
+
+        if (auto&& margin = SR_UTILS_NS::GetCmdOption(argv, argv + argc, "--benchmark-margin"); !margin.empty()) {
+            m_margin = SR_MAX(std::atof(margin.c_str()), 0.0);
+        }
+
+        if (auto&& report = SR_UTILS_NS::GetCmdOption(argv, argv + argc, "--benchmark-report"); !report.empty()) {
+            m_reportPath = report;
+        }
+        else {
+            m_reportPath = resourceManager.GetCachePath().Concat("Benchmarks").Concat(m_name).ConcatExt("json");
+        }
+
+        if (auto&& baseline = SR_UTILS_NS::GetCmdOption(argv, argv + argc, "--benchmark-baseline"); !baseline.empty()) {
+            m_baselinePath = baseline;
+        }
+        else {
+            m_baselinePath = resourceManager.GetResPath().Concat("Engine/Benchmarks").Concat(m_name).ConcatExt("xml");
+        }
+
+        m_saveBaseline = SR_UTILS_NS::HasCmdOption(argv, argv + argc, "--benchmark-save-baseline");
+
+        m_frameTimes.clear();
+        m_frameTimes.reserve(m_frames);
+        m_physicsStepTimes.clear();
+
+        m_isActive = true;
+
+        SR_SYSTEM_LOG("Benchmark::Configure() : benchmark \"{}\", scene \"{}\", {} frames after {} warmup frames.",
+            m_name, m_scenePath.ToString(), m_frames, m_warmup);
+
+        return true;
+    }
+
+    void Benchmark::Begin() {
+        m_frame = 0;
+        m_isCollected = false;
+        m_loadStart = Clock::now();
+    }
+
+    bool Benchmark::OnFrame(Engine* pEngine) {
+        if (m_isCollected) {
+            return true;
+        }
+
+        auto&& pTimings = pEngine ? pEngine->GetStateTimings() : nullptr;
+
+        const auto now = Clock::now();
+
+        if (m_frame == 0) {
+            m_loadTime = std::chrono::duration<double_t, std::milli>(now - m_loadStart).count();
+            SR_LOG("Benchmark::OnFrame() : the scene was loaded in {} ms.", m_loadTime);
+        }
+        else if (m_frame > m_warmup) {
+            m_frameTimes.emplace_back(std::chrono::duration<double_t, std::milli>(now - m_lastFrame).count());
+        }
+
+        CollectPhysics(pEngine);
+
+        /// the warmup is over, everything measured after this point goes to the report
+        if (m_frame == m_warmup) {
+            if (pTimings) {
+                pTimings->Reset();
+            }
+            m_physicsStepTimes.clear();
+        }
+
+        m_lastFrame = now;
+        ++m_frame;
+
+        if (m_frameTimes.size() < m_frames) {
+            return false;
+        }
+
+        Collect(pTimings);
+
+        return true;
+    }
+
+    void Benchmark::CollectPhysics(Engine* pEngine) {
+        auto&& pPhysicsScene = pEngine ? pEngine->GetPhysicsScene() : SR_PHYSICS_NS::PhysicsScene::Ptr();
+        if (!pPhysicsScene) {
+            return;
+        }
+
+        for (auto&& sample : pPhysicsScene->GetStatistics().GetSamplesSince(m_physicsCursor)) {
+            m_physicsStepTimes.emplace_back(sample.simulateTime + sample.fetchTime);
+        }
+    }
+
+    void Benchmark::Collect(StateTimings* pTimings) {
+        SR_TRACY_ZONE;
+
+        m_isCollected = true;
+        m_metrics.clear();
+
+        m_metrics.emplace_back(Metric { "load_ms", m_loadTime });
+        m_metrics.emplace_back(Metric { "frame_p50_ms", Percentile(m_frameTimes, 0.50) });
+        m_metrics.emplace_back(Metric { "frame_p95_ms", Percentile(m_frameTimes, 0.95) });
+        m_metrics.emplace_back(Metric { "frame_p99_ms", Percentile(m_frameTimes, 0.99) });
+
+        /// the state also waits for the scene update, the step itself is measured by the physics scene
+        if (!m_physicsStepTimes.empty()) {
+            m_metrics.emplace_back(Metric { "physics_step_p50_ms", Percentile(m_physicsStepTimes, 0.50) });
+            m_metrics.emplace_back(Metric { "physics_step_p95_ms", Percentile(m_physicsStepTimes, 0.95) });
+        }
+
+        if (pTimings) {
+            m_states = pTimings->Summarize();
+
+            if (auto&& scripts = pTimings->Summarize("Scripts")) {
+                m_metrics.emplace_back(Metric { "script_p50_ms", scripts->p50 });
+                m_metrics.emplace_back(Metric { "script_p95_ms", scripts->p95 });
+            }
+        }
+
+        if (const uint64_t memory = GetPeakMemoryUsage(); memory > 0) {
+            m_metrics.emplace_back(Metric { "memory_peak_mb", static_cast<double_t>(memory) / (1024.0 * 1024.0) });
+        }
+    }
+
+    int32_t Benchmark::Finish() {
+        if (!m_isCollected) {
+            SR_ERROR("Benchmark::Finish() : the benchmark was interrupted after {} frames!", m_frame);
+            return 4;
+        }
+
+        auto&& regressions = CompareWithBaseline();
+
+        WriteReport(regressions);
+
+        if (m_saveBaseline) {
+            SaveBaseline();
+            return 0;
+        }
+
+        if (!regressions.empty()) {
+            for (auto&& regression : regressions) {
+                SR_ERROR("Benchmark::Finish() : regression: " + regression);
+            }
+            return RegressionExitCode;
+        }
+
+        SR_LOG("Benchmark::Finish() : benchmark \"{}\" passed.", m_name);
+
+        return 0;
+    }
+
+    bool Benchmark::WriteReport(const std::vector<std::string>& regressions) const {
+        if (!m_reportPath.GetFolder().CreateIfNotExists()) {
+            SR_ERROR("Benchmark::WriteReport() : failed to create folder!\n\tPath: " + m_reportPath.ToString());
+            return false;
+        }
+
+        std::ofstream file(m_reportPath.ToString());
+        if (!file.is_open()) {
+            SR_ERROR("Benchmark::WriteReport() : failed to open file!\n\tPath: " + m_reportPath.ToString());
+            return false;
+        }
+
+        file << "{\n";
+        file << "  \"name\": \"" << EscapeJSON(m_name) << "\",\n";
+        file << "  \"scene\": \"" << EscapeJSON(m_scenePath.ToString()) << "\",\n";
+        file << "  \"frames\": " << m_frames << ",\n";
+        file << "  \"warmup\": " << m_warmup << ",\n";
+
+        file << "  \"metrics\": {\n";
+        for (size_t i = 0; i < m_metrics.size(); ++i) {
+            file << "    \"" << m_metrics[i].name << "\": " << m_metrics[i].value << (i + 1 < m_metrics.size() ? "," : "") << '\n';
+        }
+        file << "  },\n";
+
+        file << "  \"states\": [\n";
+        for (size_t i = 0; i < m_states.size(); ++i) {
+            auto&& summary = m_states[i];
+            file << "    { \"name\": \"" << EscapeJSON(summary.name) << "\", \"samples\": " << summary.samples
+                 << ", \"p50_ms\": " << summary.p50 << ", \"p95_ms\": " << summary.p95
+                 << ", \"p99_ms\": " << summary.p99 << ", \"max_ms\": " << summary.max << " }"
+                 << (i + 1 < m_states.size() ? "," : "") << '\n';
+        }
+        file << "  ],\n";
+
+        file << "  \"baseline\": \"" << EscapeJSON(m_baselinePath.ToString()) << "\",\n";
+        file << "  \"margin\": " << m_margin << ",\n";
+
+        file << "  \"regressions\": [";
+        for (size_t i = 0; i < regressions.size(); ++i) {
+            file << (i == 0 ? "\n" : ",\n") << "    \"" << EscapeJSON(regressions[i]) << "\"";
+        }
+        file << (regressions.empty() ? "]\n" : "\n  ]\n");
+
+        file << "}\n";
+
+        SR_LOG("Benchmark::WriteReport() : report was saved to \"" + m_reportPath.ToString() + "\"");
+
+        return true;
+    }
+
+    bool Benchmark::SaveBaseline() const {
+        if (!m_baselinePath.GetFolder().CreateIfNotExists()) {
+            SR_ERROR("Benchmark::SaveBaseline() : failed to create folder!\n\tPath: " + m_baselinePath.ToString());
+            return false;
+        }
+
+        auto&& document = SR_XML_NS::Document::New();
+        auto&& baselineNode = document.Root().AppendNode("Baseline");
+
+        for (auto&& metric : m_metrics) {
+            baselineNode.AppendNode("Metric").NAppendAttribute("Name", metric.name).NAppendAttribute("Value", std::to_string(metric.value));
+        }
+
+        if (!document.Save(m_baselinePath)) {
+            SR_ERROR("Benchmark::SaveBaseline() : failed to save the document!\n\tPath: " + m_baselinePath.ToString());
+            return false;
+        }
+
+        SR_LOG("Benchmark::SaveBaseline() : baseline was saved to \"" + m_baselinePath.ToString() + "\"");
+
+        return true;
+    }
+
+    std::vector<std::string> Benchmark::CompareWithBaseline() const {
+        std::vector<std::string> regressions;
+
+        if (!m_baselinePath.Exists(SR_UTILS_NS::Path::Type::File)) {
+            SR_LOG("Benchmark::CompareWithBaseline() : there is no baseline, nothing to compare with.\n\tPath: " + m_baselinePath.ToString());
+            return regressions;
+        }
+
+        auto&& document = SR_XML_NS::Document::Load(m_baselinePath);
+        if (!document.Valid()) {
+            SR_ERROR("Benchmark::CompareWithBaseline() : failed to load baseline!\n\tPath: " + m_baselinePath.ToString());
+            return regressions;
+        }
+
+        for (auto&& metricNode : document.Root().GetNode("Baseline").TryGetNodes()) {
+            const std::string name = metricNode.GetAttribute("Name").ToString();
+            const double_t baseline = std::atof(metricNode.GetAttribute("Value").ToString().c_str());
+
+            auto&& pIt = std::find_if(m_metrics.begin(), m_metrics.end(), [&name](const Metric& metric) {
+                return metric.name == name;
+            });
+
+            if (pIt == m_metrics.end()) {
+                continue;
+            }
+
+            if (pIt->value > baseline * (1.0 + m_margin) + BenchmarkTolerance) {
+                regressions.emplace_back(SR_FORMAT("{} is {} (baseline {}, margin {}%)", name, pIt->value, baseline, m_margin * 100.0));
+            }
+        }
+
+        return regressions;
+    }
+
+    uint64_t Benchmark::GetPeakMemoryUsage() {
+    #ifdef SR_LINUX
+        rusage usage = { };
+        if (getrusage(RUSAGE_SELF, &usage) == 0) {
+            /// kilobytes on Linux
+            return static_cast<uint64_t>(usage.ru_maxrss) * 1024;
+        }
+    #endif
+        return 0;
+    }
+}
@@ -3,6 +3,7 @@
 //
 
 #include <Core/Tests/TestManager.h>
+#include <Core/Tests/Benchmark.h>
 #include <Utils/Platform/Platform.h>
 #include <Core/Launcher.h>
 
@@ -67,6 +68,59 @@ namespace SR_CORE_NS {
         });
     }
 
+    int32_t TestManager::RunBenchmark(int argc, char** argv) {
+        int32_t code = 0;
+
+        SR_HTYPES_NS::SharedPtr pLauncher = new SR_CORE_NS::Launcher();
+        auto&& launcherInitStatus = pLauncher->InitLauncher(argc, argv);
+
+        if (launcherInitStatus == SR_CORE_NS::LauncherInitStatus::Error) {
+            SR_PLATFORM_NS::WriteConsoleError("TestManager::RunBenchmark() : failed to initialize launcher!\n");
+            code = 1;
+        }
+        else if (launcherInitStatus == SR_CORE_NS::LauncherInitStatus::Unpacking) {
+            SR_PLATFORM_NS::WriteConsoleError("TestManager::RunBenchmark() : run the application at least once without benchmark!\n");
+            code = 1;
+        }
+
+        if (code == 0 && !pLauncher->EarlyInit()) {
+            SR_ERROR("TestManager::RunBenchmark() : failed to early initialize application!");
+            code = 3;
+        }
+
+        auto&& benchmark = Benchmark::Instance();
+
+        if (code == 0 && !benchmark.Configure(argc, argv)) {
+            SR_ERROR("TestManager::RunBenchmark() : failed to configure benchmark!");
+            code = 3;
+        }
+
+        if (code == 0) {
+            SR_LOG("TestManager::RunBenchmark() : SpaRcle Engine is being run in benchmark mode!");
+
+            pLauncher->SetStartupScene(benchmark.GetScenePath());
+            benchmark.Begin();
+
+            if (!pLauncher->Init()) {
+                SR_ERROR("TestManager::RunBenchmark() : failed to initialize application!");
+                code = 3;
+            }
+            else if (!pLauncher->Execute()) {
+                SR_ERROR("TestManager::RunBenchmark() : failed to execute application!");
+                code = 4;
+            }
+            else {
+                code = benchmark.Finish();
+            }
+        }
+
+        pLauncher.AutoFree([](auto&& pData) {
+            delete pData;
+        });
+
+        return code;
+    }
+
     bool TestManager::RunTest(const TestManager::Test& test) {
         auto&& pApplication = SR_CORE_NS::Application::MakeShared();
 
@@ -3,6 +3,7 @@
 //
 
 #include <Core/UI/IButton.h>
+#include <Core/Utils/InputRecorder.h>
 
 #include <Graphics/Types/Geometry/Mesh3D.h>
 #include <Graphics/Types/Camera.h>
@@ -48,7 +49,7 @@ namespace SR_CORE_UI_NS {
         auto&& pRenderTechnique = pCamera->GetRenderTechnique();
         auto&& pMesh = pRenderTechnique->PickMeshAt(mousePosition);
         auto&& pHoveredMesh = dynamic_cast<IRenderComponent*>(pMesh);
-        auto&& isPressed = SR_UTILS_NS::Input::Instance().GetMouse(SR_UTILS_NS::MouseCode::MouseLeft);
+        auto&& isPressed = SR_CORE_NS::InputRecorder::Instance().GetMouse(SR_UTILS_NS::MouseCode::MouseLeft);
         bool isHovered = pHoveredMesh ? CompareObject(pHoveredMesh->GetGameObject()) : false;
 
         if (isHovered) {
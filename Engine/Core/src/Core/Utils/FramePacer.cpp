@@ -0,0 +1,137 @@
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <Core/Utils/FramePacer.h>
+
+#include <Utils/Resources/Xml.h>
+
+namespace SR_CORE_NS {
+    bool FramePacer::Load(const SR_UTILS_NS::Path& path) {
+        if (!path.Exists(SR_UTILS_NS::Path::Type::File)) {
+            SR_WARN("FramePacer::Load() : config is not found, using defaults.\n\tPath: " + path.ToString());
+            return false;
+        }
+
+        auto&& document = SR_XML_NS::Document::Load(path);
+        if (!document.Valid()) {
+            SR_ERROR("FramePacer::Load() : failed to load xml document!\n\tPath: " + path.ToString());
+            return false;
+        }
+
+        auto&& rootNode = document.Root().GetNode("FramePacing");
+
+        if (auto&& mode = rootNode.TryGetNode("Mode").TryGetAttribute("Value").ToString(); !mode.empty()) {
+            SetMode(SR_UTILS_NS::EnumReflector::FromString<FramePacingMode>(mode));
+        }
+
+        SetTargetFPS(static_cast<uint32_t>(SR_MAX(rootNode.TryGetNode("TargetFPS").TryGetAttribute("Value").ToInt(static_cast<int32_t>(m_targetFPS)), 0)));
+        /// milliseconds, fractions are allowed
+        SetSpinThreshold(rootNode.TryGetNode("SpinThreshold").TryGetAttribute("Value").ToDouble(m_spinThreshold));
+
+        return true;
+    }
+
+    void FramePacer::WaitForNextFrame() {
+        SR_TRACY_ZONE;
+
+        FramePacingMode mode;
+        uint32_t targetFPS;
+        double_t spinThreshold;
+        std::optional<Clock::time_point> frameStart;
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            mode = m_mode;
+            targetFPS = m_targetFPS;
+            spinThreshold = m_spinThreshold;
+            frameStart = m_frameStart;
+        }
+
+        double_t slept = 0.0;
+        double_t spun = 0.0;
+
+        if (mode == FramePacingMode::FixedFPS && targetFPS > 0 && frameStart.has_value()) {
+            const auto deadline = frameStart.value() + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double_t>(1.0 / targetFPS));
+            const auto spinDuration = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double_t, std::milli>(spinThreshold));
+
+            auto now = Clock::now();
+
+            if (now + spinDuration < deadline) {
+                std::this_thread::sleep_until(deadline - spinDuration);
+                const auto afterSleep = Clock::now();
+                slept = std::chrono::duration<double_t, std::milli>(afterSleep - now).count();
+                now = afterSleep;
+            }
+
+            const auto spinStart = now;
+            while (now < deadline) {
+                std::this_thread::yield();
+                now = Clock::now();
+            }
+            spun = std::chrono::duration<double_t, std::milli>(now - spinStart).count();
+        }
+
+        const auto now = Clock::now();
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if (m_frameStart.has_value()) {
+            m_stats.frameTime = std::chrono::duration<double_t, std::milli>(now - m_frameStart.value()).count();
+        }
+
+        m_frameStart = now;
+
+        m_stats.slept = slept;
+        m_stats.spun = spun;
+        m_stats.totalSlept += slept;
+        m_stats.totalSpun += spun;
+        ++m_stats.frames;
+
+        SR_TRACY_PLOT("Frame slept", slept);
+        SR_TRACY_PLOT("Frame spun", spun);
+    }
+
+    void FramePacer::SetMode(FramePacingMode mode) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_mode == mode) {
+            return;
+        }
+
+        if ((m_mode == FramePacingMode::VSync) != (mode == FramePacingMode::VSync)) {
+            m_vsyncChanged = true;
+        }
+
+        m_mode = mode;
+    }
+
+    void FramePacer::SetTargetFPS(uint32_t fps) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_targetFPS = fps;
+    }
+
+    void FramePacer::SetSpinThreshold(double_t milliseconds) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_spinThreshold = SR_MAX(milliseconds, 0.0);
+    }
+
+    FramePacingMode FramePacer::GetMode() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_mode;
+    }
+
+    uint32_t FramePacer::GetTargetFPS() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_targetFPS;
+    }
+
+    FramePacingStats FramePacer::GetStats() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_stats;
+    }
+
+    bool FramePacer::ConsumeVSyncChanged() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return std::exchange(m_vsyncChanged, false);
+    }
+}
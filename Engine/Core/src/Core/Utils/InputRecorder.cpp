@@ -0,0 +1,504 @@
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <Core/Utils/InputRecorder.h>
+
+namespace SR_CORE_NS {
+    namespace {
+        constexpr char InputRecorderMagic[4] = { 'S', 'R', 'I', 'R' };
+
+        template<typename T> void WriteBinary(std::ofstream& stream, const T& value) {
+            stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+        }
+
+        template<typename T> bool ReadBinary(std::ifstream& stream, T& value) {
+            return static_cast<bool>(stream.read(reinterpret_cast<char*>(&value), sizeof(T)));
+        }
+
+        bool InputRecorderHasPosition(InputEventType type) {
+            return type == InputEventType::MouseDown || type == InputEventType::MouseUp || type == InputEventType::MouseMove;
+        }
+
+        bool InputRecorderHasValue(InputEventType type) {
+            return type == InputEventType::MouseMove || type == InputEventType::Scroll;
+        }
+
+        void WriteVector(std::ofstream& stream, const SR_MATH_NS::FVector2& vector) {
+            WriteBinary(stream, static_cast<float_t>(vector.x));
+            WriteBinary(stream, static_cast<float_t>(vector.y));
+        }
+
+        bool ReadVector(std::ifstream& stream, SR_MATH_NS::FVector2& vector) {
+            float_t x = 0.f, y = 0.f;
+            if (!ReadBinary(stream, x) || !ReadBinary(stream, y)) {
+                return false;
+            }
+            vector = SR_MATH_NS::FVector2(x, y);
+            return true;
+        }
+    }
+
+    bool InputRecorder::StartRecording(const SR_UTILS_NS::Path& path) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if (m_mode != InputRecorderMode::None) {
+            SR_ERROR("InputRecorder::StartRecording() : recorder is already active!");
+            return false;
+        }
+
+        if (!path.GetFolder().CreateIfNotExists()) {
+            SR_ERROR("InputRecorder::StartRecording() : failed to create folder!\n\tPath: " + path.GetFolder().ToString());
+            return false;
+        }
+
+        m_output.open(path.ToString(), std::ios::binary | std::ios::trunc);
+        if (!m_output.is_open()) {
+            SR_ERROR("InputRecorder::StartRecording() : failed to open file!\n\tPath: " + path.ToString());
+            return false;
+        }
+
+        m_output.write(InputRecorderMagic, sizeof(InputRecorderMagic));
+        WriteBinary(m_output, Version);
+
+        m_mode = InputRecorderMode::Record;
+        m_frame = 0;
+        m_ticks.clear();
+        m_tick.clear();
+        m_frameDeltaTime = std::nullopt;
+
+        SR_INFO("InputRecorder::StartRecording() : recording input to \"" + path.ToString() + "\"");
+
+        return true;
+    }
+
+    bool InputRecorder::StartReplay(const SR_UTILS_NS::Path& path, float_t lockedDeltaTime) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if (m_mode != InputRecorderMode::None) {
+            SR_ERROR("InputRecorder::StartReplay() : recorder is already active!");
+            return false;
+        }
+
+        m_input.open(path.ToString(), std::ios::binary);
+        if (!m_input.is_open()) {
+            SR_ERROR("InputRecorder::StartReplay() : failed to open file!\n\tPath: " + path.ToString());
+            return false;
+        }
+
+        char magic[4] = { };
+        uint32_t version = 0;
+        m_input.read(magic, sizeof(magic));
+
+        if (!ReadBinary(m_input, version) || std::memcmp(magic, InputRecorderMagic, sizeof(magic)) != 0 || version != Version) {
+            SR_ERROR("InputRecorder::StartReplay() : unsupported file!\n\tPath: " + path.ToString());
+            m_input.close();
+            return false;
+        }
+
+        m_mode = InputRecorderMode::Replay;
+        m_lockedDeltaTime = lockedDeltaTime;
+        m_frame = 0;
+        m_isFinished = false;
+        m_ticks.clear();
+        m_tickIndex = 0;
+        ApplyTick(Tick());
+        m_keys.reset();
+        m_mouse = 0;
+
+        SR_INFO("InputRecorder::StartReplay() : replaying input from \"" + path.ToString() + "\"");
+
+        return true;
+    }
+
+    void InputRecorder::Stop() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if (m_mode == InputRecorderMode::Record) {
+            /// the events of the last tick and frame are not closed by OnTick() and OnFrame()
+            if (!m_tick.empty()) {
+                m_ticks.emplace_back(std::move(m_tick));
+                m_tick.clear();
+            }
+            WriteFrame();
+            m_output.flush();
+            m_output.close();
+            SR_INFO("InputRecorder::Stop() : recorded " + std::to_string(m_frame) + " frames.");
+        }
+        else if (m_mode == InputRecorderMode::Replay) {
+            m_input.close();
+        }
+
+        m_handlers.clear();
+        m_mode = InputRecorderMode::None;
+    }
+
+    void InputRecorder::Register(SR_UTILS_NS::InputHandler* pHandler) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if (pHandler && std::find(m_handlers.begin(), m_handlers.end(), pHandler) == m_handlers.end()) {
+            m_handlers.emplace_back(pHandler);
+        }
+    }
+
+    void InputRecorder::Unregister(SR_UTILS_NS::InputHandler* pHandler) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_handlers.erase(std::remove(m_handlers.begin(), m_handlers.end(), pHandler), m_handlers.end());
+    }
+
+    float_t InputRecorder::OnFrame(float_t dt) {
+        SR_TRACY_ZONE;
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        switch (m_mode) {
+            case InputRecorderMode::Record:
+                WriteFrame();
+                m_frameDeltaTime = dt;
+                break;
+            case InputRecorderMode::Replay:
+                if (!ReadFrame(dt)) {
+                    if (!m_isFinished) {
+                        SR_INFO("InputRecorder::OnFrame() : replay is finished after " + std::to_string(m_frame) + " frames.");
+                    }
+                    m_isFinished = true;
+                    m_ticks.clear();
+                    m_tickIndex = 0;
+                }
+                break;
+            default:
+                break;
+        }
+
+        return dt;
+    }
+
+    void InputRecorder::OnTick() {
+        SR_TRACY_ZONE;
+
+        Tick tick;
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            if (m_mode == InputRecorderMode::Record) {
+                m_ticks.emplace_back(std::move(m_tick));
+                m_tick.clear();
+                return;
+            }
+
+            if (m_mode != InputRecorderMode::Replay) {
+                return;
+            }
+
+            /// a frame with more fixed steps than recorded ones gets empty ticks, the state of the keys stays
+            if (m_tickIndex < m_ticks.size()) {
+                tick = std::move(m_ticks[m_tickIndex]);
+                ++m_tickIndex;
+            }
+
+            ApplyTick(tick);
+        }
+
+        /// handlers read the polled state of the recorder, so they are called without the lock
+        DispatchTick(tick);
+    }
+
+    void InputRecorder::OnScroll(double_t x, double_t y) {
+        InputEvent event;
+        event.type = InputEventType::Scroll;
+        event.value = SR_MATH_NS::FVector2(static_cast<float_t>(x), static_cast<float_t>(y));
+        RecordEvent(event);
+    }
+
+    void InputRecorder::RecordEvent(const InputEvent& event) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if (m_mode == InputRecorderMode::Record && m_tick.size() < std::numeric_limits<uint16_t>::max()) {
+            m_tick.emplace_back(event);
+        }
+    }
+
+    void InputRecorder::WriteFrame() {
+        if (!m_frameDeltaTime.has_value()) {
+            return;
+        }
+
+        const auto ticksCount = static_cast<uint16_t>(std::min<size_t>(m_ticks.size(), std::numeric_limits<uint16_t>::max()));
+
+        WriteBinary(m_output, m_frameDeltaTime.value());
+        WriteBinary(m_output, ticksCount);
+
+        for (uint16_t i = 0; i < ticksCount; ++i) {
+            auto&& tick = m_ticks[i];
+
+            WriteBinary(m_output, static_cast<uint16_t>(tick.size()));
+
+            for (auto&& event : tick) {
+                WriteBinary(m_output, static_cast<uint8_t>(event.type));
+                WriteBinary(m_output, event.code);
+
+                if (InputRecorderHasPosition(event.type)) {
+                    WriteVector(m_output, event.position);
+                }
+
+                if (InputRecorderHasValue(event.type)) {
+                    WriteVector(m_output, event.value);
+                }
+            }
+        }
+
+        m_ticks.clear();
+        m_frameDeltaTime = std::nullopt;
+
+        ++m_frame;
+    }
+
+    bool InputRecorder::ReadFrame(float_t& dt) {
+        float_t recordedDt = 0.f;
+        uint16_t ticksCount = 0;
+
+        if (!ReadBinary(m_input, recordedDt) || !ReadBinary(m_input, ticksCount)) {
+            return false;
+        }
+
+        m_ticks.clear();
+        m_ticks.resize(ticksCount);
+        m_tickIndex = 0;
+
+        for (auto&& tick : m_ticks) {
+            uint16_t eventsCount = 0;
+            if (!ReadBinary(m_input, eventsCount)) {
+                return false;
+            }
+
+            tick.resize(eventsCount);
+
+            for (auto&& event : tick) {
+                uint8_t type = 0;
+                if (!ReadBinary(m_input, type) || !ReadBinary(m_input, event.code)) {
+                    return false;
+                }
+
+                event.type = static_cast<InputEventType>(type);
+
+                if (InputRecorderHasPosition(event.type) && !ReadVector(m_input, event.position)) {
+                    return false;
+                }
+
+                if (InputRecorderHasValue(event.type) && !ReadVector(m_input, event.value)) {
+                    return false;
+                }
+            }
+        }
+
+        dt = m_lockedDeltaTime > 0.f ? m_lockedDeltaTime : recordedDt;
+
+        ++m_frame;
+
+        return true;
+    }
+
+    void InputRecorder::ApplyTick(const Tick& tick) {
+        m_keysDown.reset();
+        m_keysUp.reset();
+        m_mouseDown = m_mouseUp = 0;
+        m_mouseDrag = SR_MATH_NS::FVector2();
+        m_mouseWheel = 0.f;
+
+        for (auto&& event : tick) {
+            switch (event.type) {
+                case InputEventType::KeyDown:
+                    m_keys.set(event.code);
+                    m_keysDown.set(event.code);
+                    break;
+                case InputEventType::KeyUp:
+                    m_keys.reset(event.code);
+                    m_keysUp.set(event.code);
+                    break;
+                case InputEventType::MouseDown:
+                    m_mouse |= event.code;
+                    m_mouseDown |= event.code;
+                    break;
+                case InputEventType::MouseUp:
+                    m_mouse &= ~event.code;
+                    m_mouseUp |= event.code;
+                    break;
+                case InputEventType::MouseMove:
+                    m_mouseDrag += event.value;
+                    break;
+                case InputEventType::Scroll:
+                    m_mouseWheel += event.value.y;
+                    break;
+                default:
+                    break;
+            }
+        }
+    }
+
+    void InputRecorder::DispatchTick(const Tick& tick) const {
+        std::vector<SR_UTILS_NS::InputHandler*> handlers;
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            handlers = m_handlers;
+        }
+
+        for (auto&& event : tick) {
+            switch (event.type) {
+                case InputEventType::KeyDown:
+                case InputEventType::KeyPress:
+                case InputEventType::KeyUp: {
+                    SR_UTILS_NS::KeyboardInputData data(static_cast<SR_UTILS_NS::KeyCode>(event.code));
+                    for (auto&& pHandler : handlers) {
+                        if (event.type == InputEventType::KeyDown) {
+                            pHandler->OnKeyDown(&data);
+                        }
+                        else if (event.type == InputEventType::KeyPress) {
+                            pHandler->OnKeyPress(&data);
+                        }
+                        else {
+                            pHandler->OnKeyUp(&data);
+                        }
+                    }
+                    break;
+                }
+                case InputEventType::MouseDown:
+                case InputEventType::MouseUp:
+                case InputEventType::MouseMove: {
+                    SR_UTILS_NS::MouseInputData data(static_cast<SR_UTILS_NS::MouseCode>(event.code), event.position, event.value);
+                    for (auto&& pHandler : handlers) {
+                        if (event.type == InputEventType::MouseDown) {
+                            pHandler->OnMouseDown(&data);
+                        }
+                        else if (event.type == InputEventType::MouseUp) {
+                            pHandler->OnMouseUp(&data);
+                        }
+                        else {
+                            pHandler->OnMouseMove(&data);
+                        }
+                    }
+                    break;
+                }
+                case InputEventType::Scroll:
+                    SR_UTILS_NS::Input::Instance().SetMouseScroll(event.value.x, event.value.y);
+                    break;
+                default:
+                    break;
+            }
+        }
+    }
+
+    void InputRecorder::OnMouseMove(const SR_UTILS_NS::MouseInputData* data) {
+        InputEvent event;
+        event.type = InputEventType::MouseMove;
+        event.code = static_cast<uint8_t>(data->m_code);
+        event.position = data->m_position;
+        event.value = data->GetDrag();
+        RecordEvent(event);
+    }
+
+    void InputRecorder::OnMouseDown(const SR_UTILS_NS::MouseInputData* data) {
+        InputEvent event;
+        event.type = InputEventType::MouseDown;
+        event.code = static_cast<uint8_t>(data->m_code);
+        event.position = data->m_position;
+        RecordEvent(event);
+    }
+
+    void InputRecorder::OnMouseUp(const SR_UTILS_NS::MouseInputData* data) {
+        InputEvent event;
+        event.type = InputEventType::MouseUp;
+        event.code = static_cast<uint8_t>(data->m_code);
+        event.position = data->m_position;
+        RecordEvent(event);
+    }
+
+    void InputRecorder::OnKeyDown(const SR_UTILS_NS::KeyboardInputData* data) {
+        InputEvent event;
+        event.type = InputEventType::KeyDown;
+        event.code = static_cast<uint8_t>(data->GetKeyCode());
+        RecordEvent(event);
+    }
+
+    void InputRecorder::OnKeyPress(const SR_UTILS_NS::KeyboardInputData* data) {
+        InputEvent event;
+        event.type = InputEventType::KeyPress;
+        event.code = static_cast<uint8_t>(data->GetKeyCode());
+        RecordEvent(event);
+    }
+
+    void InputRecorder::OnKeyUp(const SR_UTILS_NS::KeyboardInputData* data) {
+        InputEvent event;
+        event.type = InputEventType::KeyUp;
+        event.code = static_cast<uint8_t>(data->GetKeyCode());
+        RecordEvent(event);
+    }
+
+    bool InputRecorder::GetKey(SR_UTILS_NS::KeyCode key) const {
+        if (!IsReplaying()) {
+            return SR_UTILS_NS::Input::Instance().GetKey(key);
+        }
+        std::lock_guard<std::mutex> lock(m_mutex);
+        const auto code = static_cast<uint32_t>(key);
+        return code < KeysCount && m_keys.test(code);
+    }
+
+    bool InputRecorder::GetKeyDown(SR_UTILS_NS::KeyCode key) const {
+        if (!IsReplaying()) {
+            return SR_UTILS_NS::Input::Instance().GetKeyDown(key);
+        }
+        std::lock_guard<std::mutex> lock(m_mutex);
+        const auto code = static_cast<uint32_t>(key);
+        return code < KeysCount && m_keysDown.test(code);
+    }
+
+    bool InputRecorder::GetKeyUp(SR_UTILS_NS::KeyCode key) const {
+        if (!IsReplaying()) {
+            return SR_UTILS_NS::Input::Instance().GetKeyUp(key);
+        }
+        std::lock_guard<std::mutex> lock(m_mutex);
+        const auto code = static_cast<uint32_t>(key);
+        return code < KeysCount && m_keysUp.test(code);
+    }
+
+    bool InputRecorder::GetMouse(SR_UTILS_NS::MouseCode code) const {
+        if (!IsReplaying()) {
+            return SR_UTILS_NS::Input::Instance().GetMouse(code);
+        }
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_mouse & static_cast<uint8_t>(code);
+    }
+
+    bool InputRecorder::GetMouseDown(SR_UTILS_NS::MouseCode code) const {
+        if (!IsReplaying()) {
+            return SR_UTILS_NS::Input::Instance().GetMouseDown(code);
+        }
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_mouseDown & static_cast<uint8_t>(code);
+    }
+
+    bool InputRecorder::GetMouseUp(SR_UTILS_NS::MouseCode code) const {
+        if (!IsReplaying()) {
+            return SR_UTILS_NS::Input::Instance().GetMouseUp(code);
+        }
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_mouseUp & static_cast<uint8_t>(code);
+    }
+
+    SR_MATH_NS::FVector2 InputRecorder::GetMouseDrag() const {
+        if (!IsReplaying()) {
+            return SR_UTILS_NS::Input::Instance().GetMouseDrag();
+        }
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_mouseDrag;
+    }
+
+    int32_t InputRecorder::GetMouseWheel() const {
+        if (!IsReplaying()) {
+            return SR_UTILS_NS::Input::Instance().GetMouseWheel();
+        }
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return static_cast<int32_t>(m_mouseWheel);
+    }
+}
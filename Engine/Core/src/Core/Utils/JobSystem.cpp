@@ -0,0 +1,165 @@
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <Core/Utils/JobSystem.h>
+
+namespace SR_CORE_NS {
+    namespace {
+        /// index of the worker queue of the current thread, the shared queue for other threads
+        thread_local int32_t g_workerIndex = -1;
+    }
+
+    JobSystem::JobSystem(uint32_t workers) {
+        for (uint32_t i = 0; i <= workers; ++i) {
+            m_queues.emplace_back(std::make_unique<Queue>());
+        }
+
+        m_threads.resize(workers);
+
+        for (uint32_t i = 0; i < workers; ++i) {
+            SR_HTYPES_NS::Thread::Factory::Instance().Create(m_threads[i], [this, i]() {
+                WorkerLoop(i);
+            });
+            m_threads[i]->SetName("Job worker " + std::to_string(i));
+        }
+
+        SR_INFO("JobSystem::JobSystem() : started " + std::to_string(workers) + " workers.");
+    }
+
+    JobSystem::~JobSystem() {
+        {
+            std::lock_guard<std::mutex> lock(m_sleepMutex);
+            m_stopped = true;
+        }
+        m_sleepCondition.notify_all();
+
+        for (auto&& pThread : m_threads) {
+            if (pThread && pThread->Joinable()) {
+                pThread->Join();
+            }
+
+            if (pThread) {
+                pThread->Free();
+            }
+        }
+
+        m_threads.clear();
+    }
+
+    uint32_t JobSystem::GetDefaultWorkersCount() {
+        const uint32_t cores = std::thread::hardware_concurrency();
+        return cores > 4 ? cores - 3 : 1;
+    }
+
+    void JobSystem::Schedule(Job job, Counter* pCounter) {
+        if (pCounter) {
+            pCounter->m_pending.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        if (m_threads.empty()) {
+            Task task { std::move(job), pCounter };
+            Execute(task);
+            return;
+        }
+
+        const uint32_t index = g_workerIndex >= 0 ? static_cast<uint32_t>(g_workerIndex) : static_cast<uint32_t>(m_threads.size());
+
+        /// counted before the push, so the counter never goes below the real amount of jobs
+        {
+            std::lock_guard<std::mutex> lock(m_sleepMutex);
+            m_queued.fetch_add(1, std::memory_order_release);
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_queues[index]->mutex);
+            m_queues[index]->tasks.emplace_back(Task { std::move(job), pCounter });
+        }
+
+        m_sleepCondition.notify_one();
+    }
+
+    void JobSystem::Wait(const Counter& counter) {
+        SR_TRACY_ZONE;
+
+        const uint32_t index = g_workerIndex >= 0 ? static_cast<uint32_t>(g_workerIndex) : static_cast<uint32_t>(m_threads.size());
+
+        while (!counter.IsDone()) {
+            if (!TryExecute(index)) {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    void JobSystem::WorkerLoop(uint32_t index) {
+        g_workerIndex = static_cast<int32_t>(index);
+
+        while (true) {
+            if (TryExecute(index)) {
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(m_sleepMutex);
+            m_sleepCondition.wait(lock, [this]() {
+                return m_stopped || m_queued.load(std::memory_order_acquire) > 0;
+            });
+
+            if (m_stopped) {
+                break;
+            }
+        }
+    }
+
+    bool JobSystem::TryExecute(uint32_t index) {
+        Task task;
+
+        if (!TryPop(index, task)) {
+            return false;
+        }
+
+        m_queued.fetch_sub(1, std::memory_order_acq_rel);
+
+        Execute(task);
+
+        return true;
+    }
+
+    bool JobSystem::TryPop(uint32_t index, Task& task) {
+        /// own queue first, newest job is the hottest in the cache
+        {
+            auto&& queue = *m_queues[index];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            if (!queue.tasks.empty()) {
+                task = std::move(queue.tasks.back());
+                queue.tasks.pop_back();
+                return true;
+            }
+        }
+
+        /// steal the oldest job, it is usually the biggest piece of the remaining work
+        const auto count = static_cast<uint32_t>(m_queues.size());
+        for (uint32_t offset = 1; offset < count; ++offset) {
+            auto&& queue = *m_queues[(index + offset) % count];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            if (!queue.tasks.empty()) {
+                task = std::move(queue.tasks.front());
+                queue.tasks.pop_front();
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    void JobSystem::Execute(Task& task) {
+        SR_TRACY_ZONE;
+
+        if (task.job) {
+            task.job();
+        }
+
+        if (task.pCounter) {
+            task.pCounter->m_pending.fetch_sub(1, std::memory_order_acq_rel);
+        }
+    }
+}
@@ -0,0 +1,188 @@
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <Core/Utils/StateTimings.h>
+
+namespace SR_CORE_NS {
+    std::string EscapeJSON(const std::string& value) {
+        std::string result;
+        result.reserve(value.size());
+
+        for (const char symbol : value) {
+            switch (symbol) {
+                case '"': result += "\\\""; break;
+                case '\\': result += "\\\\"; break;
+                case '\n': result += "\\n"; break;
+                case '\r': result += "\\r"; break;
+                case '\t': result += "\\t"; break;
+                default:
+                    if (static_cast<unsigned char>(symbol) < 0x20) {
+                        char buffer[8];
+                        std::snprintf(buffer, sizeof(buffer), "\\u%04x", static_cast<uint32_t>(symbol));
+                        result += buffer;
+                    }
+                    else {
+                        result += symbol;
+                    }
+                    break;
+            }
+        }
+
+        return result;
+    }
+
+    StateTimingBuffer::StateTimingBuffer(uint32_t capacity)
+        : m_samples(std::make_unique<std::atomic<float_t>[]>(SR_MAX(capacity, 1u)))
+        , m_capacity(SR_MAX(capacity, 1u))
+    { }
+
+    void StateTimingBuffer::Push(double_t milliseconds) noexcept {
+        const uint64_t index = m_count.load(std::memory_order_relaxed);
+        m_samples[index % m_capacity].store(static_cast<float_t>(milliseconds), std::memory_order_relaxed);
+        m_count.store(index + 1, std::memory_order_release);
+    }
+
+    void StateTimingBuffer::Reset() noexcept {
+        m_count.store(0, std::memory_order_release);
+    }
+
+    StateTimingSummary StateTimingBuffer::Summarize() const {
+        StateTimingSummary summary;
+
+        const uint64_t count = m_count.load(std::memory_order_acquire);
+        if (count == 0) {
+            return summary;
+        }
+
+        const uint64_t size = SR_MIN(count, static_cast<uint64_t>(m_capacity));
+
+        std::vector<float_t> samples;
+        samples.reserve(size);
+
+        for (uint64_t i = count - size; i < count; ++i) {
+            samples.emplace_back(m_samples[i % m_capacity].load(std::memory_order_relaxed));
+        }
+
+        summary.samples = count;
+        summary.last = samples.back();
+
+        std::sort(samples.begin(), samples.end());
+
+        auto&& percentile = [&samples](double_t p) -> double_t {
+            const auto index = static_cast<size_t>(p * static_cast<double_t>(samples.size() - 1) + 0.5);
+            return samples[SR_MIN(index, samples.size() - 1)];
+        };
+
+        summary.p50 = percentile(0.50);
+        summary.p95 = percentile(0.95);
+        summary.p99 = percentile(0.99);
+        summary.max = samples.back();
+
+        return summary;
+    }
+
+    StateTimings::StateTimings(uint32_t capacity)
+        : m_capacity(capacity)
+    { }
+
+    StateTimingBuffer* StateTimings::GetBuffer(const std::string& name) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if (auto&& pIt = m_buffers.find(name); pIt != m_buffers.end()) {
+            return &pIt->second;
+        }
+
+        return &m_buffers.try_emplace(name, m_capacity).first->second;
+    }
+
+    std::vector<StateTimingSummary> StateTimings::Summarize() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        std::vector<StateTimingSummary> summaries;
+        summaries.reserve(m_buffers.size());
+
+        for (auto&& [name, buffer] : m_buffers) {
+            auto&& summary = summaries.emplace_back(buffer.Summarize());
+            summary.name = name;
+        }
+
+        return summaries;
+    }
+
+    std::optional<StateTimingSummary> StateTimings::Summarize(const std::string& name) const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        auto&& pIt = m_buffers.find(name);
+        if (pIt == m_buffers.end()) {
+            return std::nullopt;
+        }
+
+        auto&& summary = pIt->second.Summarize();
+        summary.name = name;
+        return summary;
+    }
+
+    void StateTimings::Reset() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        for (auto&& [name, buffer] : m_buffers) {
+            buffer.Reset();
+        }
+    }
+
+    bool StateTimings::DumpCSV(const SR_UTILS_NS::Path& path) const {
+        if (!path.GetFolder().CreateIfNotExists()) {
+            SR_ERROR("StateTimings::DumpCSV() : failed to create folder!\n\tPath: " + path.ToString());
+            return false;
+        }
+
+        std::ofstream file(path.ToString());
+        if (!file.is_open()) {
+            SR_ERROR("StateTimings::DumpCSV() : failed to open file!\n\tPath: " + path.ToString());
+            return false;
+        }
+
+        file << "state,samples,last_ms,p50_ms,p95_ms,p99_ms,max_ms\n";
+
+        for (auto&& summary : Summarize()) {
+            file << summary.name << ',' << summary.samples << ',' << summary.last << ',' << summary.p50 << ','
+                 << summary.p95 << ',' << summary.p99 << ',' << summary.max << '\n';
+        }
+
+        SR_LOG("StateTimings::DumpCSV() : state timings were saved to \"" + path.ToString() + "\"");
+
+        return true;
+    }
+
+    bool StateTimings::DumpJSON(const SR_UTILS_NS::Path& path) const {
+        if (!path.GetFolder().CreateIfNotExists()) {
+            SR_ERROR("StateTimings::DumpJSON() : failed to create folder!\n\tPath: " + path.ToString());
+            return false;
+        }
+
+        std::ofstream file(path.ToString());
+        if (!file.is_open()) {
+            SR_ERROR("StateTimings::DumpJSON() : failed to open file!\n\tPath: " + path.ToString());
+            return false;
+        }
+
+        auto&& summaries = Summarize();
+
+        file << "{\n  \"states\": [\n";
+
+        for (size_t i = 0; i < summaries.size(); ++i) {
+            auto&& summary = summaries[i];
+            file << "    { \"name\": \"" << EscapeJSON(summary.name) << "\", \"samples\": " << summary.samples
+                 << ", \"last_ms\": " << summary.last << ", \"p50_ms\": " << summary.p50
+                 << ", \"p95_ms\": " << summary.p95 << ", \"p99_ms\": " << summary.p99
+                 << ", \"max_ms\": " << summary.max << " }" << (i + 1 < summaries.size() ? "," : "") << '\n';
+        }
+
+        file << "  ]\n}\n";
+
+        SR_LOG("StateTimings::DumpJSON() : state timings were saved to \"" + path.ToString() + "\"");
+
+        return true;
+    }
+}
@@ -0,0 +1,313 @@
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <Core/Utils/ThreadStateSync.h>
+
+namespace SR_CORE_NS {
+    namespace {
+        std::string ThreadStateSyncTrim(const std::string& value) {
+            const auto first = value.find_first_not_of(" \t\r\"'");
+            if (first == std::string::npos) {
+                return std::string();
+            }
+            const auto last = value.find_last_not_of(" \t\r\"'");
+            return value.substr(first, last - first + 1);
+        }
+
+        /// ["A", "B"] or [A, B]
+        ThreadStateSync::Names ThreadStateSyncParseNames(const std::string& value) {
+            ThreadStateSync::Names names;
+
+            const auto begin = value.find('[');
+            const auto end = value.rfind(']');
+            if (begin == std::string::npos || end == std::string::npos || end < begin) {
+                if (auto&& name = ThreadStateSyncTrim(value); !name.empty()) {
+                    names.emplace_back(name);
+                }
+                return names;
+            }
+
+            std::stringstream stream(value.substr(begin + 1, end - begin - 1));
+            std::string item;
+            while (std::getline(stream, item, ',')) {
+                if (auto&& name = ThreadStateSyncTrim(item); !name.empty()) {
+                    names.emplace_back(name);
+                }
+            }
+
+            return names;
+        }
+    }
+
+    bool ThreadStateSync::LoadConditions(const SR_UTILS_NS::Path& path) {
+        SR_TRACY_ZONE;
+
+        std::ifstream file(path.ToString());
+        if (!file.is_open()) {
+            SR_ERROR("ThreadStateSync::LoadConditions() : failed to open the file!\n\tPath: " + path.ToString());
+            return false;
+        }
+
+        std::map<std::string, StateConditions, std::less<>> conditions;
+
+        /// only the subset of yaml used by the threads config: "states" lists with "- name" items
+        /// and the condition maps under them, the values are flow sequences or numbers
+        int32_t statesIndent = -1;
+        int32_t conditionIndent = -1;
+        std::string stateName;
+        Condition* pCondition = nullptr;
+
+        std::string line;
+        while (std::getline(file, line)) {
+            if (auto&& comment = line.find('#'); comment != std::string::npos) {
+                line.resize(comment);
+            }
+
+            const auto first = line.find_first_not_of(" \t");
+            if (first == std::string::npos) {
+                continue;
+            }
+
+            const auto indent = static_cast<int32_t>(first);
+            std::string content = line.substr(first);
+
+            if (pCondition && indent <= conditionIndent) {
+                pCondition = nullptr;
+            }
+
+            if (statesIndent >= 0 && indent <= statesIndent) {
+                statesIndent = -1;
+                stateName.clear();
+            }
+
+            const bool isItem = content.rfind("- ", 0) == 0;
+            if (isItem) {
+                content = content.substr(2);
+            }
+
+            const auto colon = content.find(':');
+            if (colon == std::string::npos) {
+                continue;
+            }
+
+            const std::string key = ThreadStateSyncTrim(content.substr(0, colon));
+            const std::string value = ThreadStateSyncTrim(content.substr(colon + 1));
+
+            if (key == "states") {
+                statesIndent = indent;
+                continue;
+            }
+
+            if (statesIndent < 0) {
+                continue;
+            }
+
+            if (isItem && key == "name") {
+                stateName = value;
+                pCondition = nullptr;
+                continue;
+            }
+
+            if (stateName.empty()) {
+                continue;
+            }
+
+            if (key == "start_condition" || key == "finish_condition") {
+                auto&& stateConditions = conditions[stateName];
+                pCondition = key == "start_condition" ? &stateConditions.start : &stateConditions.finish;
+                conditionIndent = indent;
+                continue;
+            }
+
+            if (!pCondition) {
+                continue;
+            }
+
+            if (key == "ready") {
+                pCondition->ready = ThreadStateSyncParseNames(value);
+            }
+            else if (key == "idle") {
+                pCondition->idle = ThreadStateSyncParseNames(value);
+            }
+            else if (key == "consumed") {
+                pCondition->consumed = ThreadStateSyncParseNames(value);
+            }
+            else if (key == "timeout") {
+                pCondition->timeout = Milliseconds(std::strtol(value.c_str(), nullptr, 10));
+            }
+            else {
+                SR_WARN("ThreadStateSync::LoadConditions() : unknown key \"" + key + "\" in the condition of \"" + stateName + "\"");
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_conditions = std::move(conditions);
+
+        return true;
+    }
+
+    ThreadStateSync::Condition ThreadStateSync::GetStartCondition(const std::string& name) const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto&& pIt = m_conditions.find(name);
+        return pIt == m_conditions.end() ? Condition() : pIt->second.start;
+    }
+
+    ThreadStateSync::Condition ThreadStateSync::GetFinishCondition(const std::string& name) const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto&& pIt = m_conditions.find(name);
+        return pIt == m_conditions.end() ? Condition() : pIt->second.finish;
+    }
+
+    template<typename Predicate> bool ThreadStateSync::Wait(std::unique_lock<std::mutex>& lock, Milliseconds timeout, Predicate&& predicate) {
+        if (timeout.count() < 0) {
+            /// wake up periodically, the worker can be stopped without notifying us
+            while (!m_condition.wait_for(lock, Milliseconds(100), predicate)) {
+                if (m_stopped) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        return m_condition.wait_for(lock, timeout, predicate);
+    }
+
+    bool ThreadStateSync::Begin(const std::string& name, const Condition& condition, bool waitConsumed) {
+        SR_TRACY_ZONE;
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        const bool isMet = Wait(lock, condition.timeout, [&]() {
+            if (m_stopped) {
+                return true;
+            }
+
+            if (m_paused || !IsMet(condition)) {
+                return false;
+            }
+
+            /// producer can not overwrite the result that has not been consumed yet
+            return !waitConsumed || !GetInfo(name).ready;
+        });
+
+        if (!isMet || m_stopped) {
+            return false;
+        }
+
+        for (auto&& readyName : condition.ready) {
+            GetInfo(readyName).ready = false;
+        }
+
+        GetInfo(name).busy = true;
+
+        lock.unlock();
+        m_condition.notify_all();
+
+        return true;
+    }
+
+    void ThreadStateSync::End(const std::string& name, const Condition& condition, bool produced) {
+        SR_TRACY_ZONE;
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        auto&& info = GetInfo(name);
+        info.busy = false;
+        if (produced) {
+            info.ready = true;
+        }
+
+        m_condition.notify_all();
+
+        if (condition.Empty()) {
+            return;
+        }
+
+        Wait(lock, condition.timeout, [&]() {
+            return m_stopped || m_paused || IsMet(condition);
+        });
+    }
+
+    void ThreadStateSync::Pause() {
+        SR_TRACY_ZONE;
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        m_paused = true;
+        m_condition.notify_all();
+
+        Wait(lock, Milliseconds(-1), [this]() {
+            return m_stopped || AllIdle();
+        });
+    }
+
+    void ThreadStateSync::Resume() {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_paused = false;
+        }
+        m_condition.notify_all();
+    }
+
+    void ThreadStateSync::Stop() {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stopped = true;
+        }
+        m_condition.notify_all();
+    }
+
+    bool ThreadStateSync::IsReady(const std::string& name) const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto&& pIt = m_states.find(name);
+        return pIt != m_states.end() && pIt->second.ready;
+    }
+
+    bool ThreadStateSync::IsIdle(const std::string& name) const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto&& pIt = m_states.find(name);
+        return pIt == m_states.end() || !pIt->second.busy;
+    }
+
+    bool ThreadStateSync::IsMet(const Condition& condition) const {
+        for (auto&& readyName : condition.ready) {
+            auto&& pIt = m_states.find(readyName);
+            if (pIt == m_states.end() || !pIt->second.ready) {
+                return false;
+            }
+        }
+
+        for (auto&& idleName : condition.idle) {
+            auto&& pIt = m_states.find(idleName);
+            if (pIt != m_states.end() && pIt->second.busy) {
+                return false;
+            }
+        }
+
+        for (auto&& consumedName : condition.consumed) {
+            auto&& pIt = m_states.find(consumedName);
+            if (pIt != m_states.end() && pIt->second.ready) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool ThreadStateSync::AllIdle() const {
+        for (auto&& [name, info] : m_states) {
+            if (info.busy) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    ThreadStateSync::StateInfo& ThreadStateSync::GetInfo(const std::string& name) {
+        if (auto&& pIt = m_states.find(name); pIt != m_states.end()) {
+            return pIt->second;
+        }
+        return m_states[name];
+    }
+}
@@ -3,6 +3,7 @@
 //
 
 #include <Core/World/EngineScene.h>
+#include <Core/Engine.h>
 #include <Core/GUI/EditorGUI.h>
 
 #include <Physics/3D/Raycast3D.h>
@@ -13,6 +14,8 @@
 
 #include <Utils/DebugDraw.h>
 #include <Utils/Common/Features.h>
+#include <Utils/Resources/Xml.h>
+#include <Utils/Resources/ResourceManager.h>
 #include <Utils/World/SceneCubeChunkLogic.h>
 
 namespace SR_CORE_NS {
@@ -24,7 +27,9 @@ namespace SR_CORE_NS {
 
     EngineScene::~EngineScene() {
         pRenderScene.Do([this](SR_GRAPH_NS::RenderScene* pData) {
-            pData->Remove(pEngine->GetEditor());
+            if (auto&& pEditor = pEngine->GetEditor()) {
+                pData->Remove(pEditor);
+            }
             pData->Remove(&SR_GRAPH_NS::GUI::GlobalWidgetManager::Instance());
         });
 
@@ -39,15 +44,23 @@ namespace SR_CORE_NS {
     }
 
     bool EngineScene::Init() {
-        SetSpeed(1.f);
-
         SRAssert(pScene);
 
+        LoadSimulationSettings(SR_UTILS_NS::ResourceManager::Instance().GetResPath().Concat("Engine/Configs/Simulation.xml"));
+
+        /// a scene can override the engine settings with its own config
+        if (!pScene->IsPrefab()) {
+            LoadSimulationSettings(pScene->GetAbsPath().GetFolder().Concat("Simulation.xml"));
+        }
+
+        SetSpeed(1.f);
+
         pScene->Init();
 
         m_accumulateDt = SR_UTILS_NS::Features::Instance().Enabled("AccumulateDt", true);
 
-        if (SR_UTILS_NS::Features::Instance().Enabled("Renderer", true)) {
+        /// in headless mode there is no render context at all
+        if (SR_UTILS_NS::Features::Instance().Enabled("Renderer", true) && pEngine->GetRenderContext()) {
             if (auto&& pContext = pEngine->GetRenderContext(); pContext.LockIfValid()) {
                 pRenderScene = pContext->CreateScene(pScene);
                 pContext.Unlock();
@@ -60,20 +73,28 @@ namespace SR_CORE_NS {
             if (pRenderScene) {
                 pRenderScene->SetTechnique("Editor/Configs/OverlayRenderTechnique.xml");
 
-                pRenderScene->Register(pEngine->GetEditor());
+                auto&& pEditor = pEngine->GetEditor();
+
+                if (pEditor) {
+                    pRenderScene->Register(pEditor);
+                }
                 pRenderScene->Register(&Graphics::GUI::GlobalWidgetManager::Instance());
 
-                pRenderScene->SetOverlayEnabled(pEngine->GetEditor()->Enabled());
+                pRenderScene->SetOverlayEnabled(pEditor && pEditor->Enabled());
             }
         }
 
         if (SR_UTILS_NS::Features::Instance().Enabled("Physics", true)) {
             pPhysicsScene = new SR_PHYSICS_NS::PhysicsScene(pScene);
 
+            pPhysicsScene->SetFixedStep(m_fixedStep);
+
             if (!pPhysicsScene->Init()) {
                 SR_ERROR("InitializeScene() : failed to initialize physics scene!");
                 return false;
             }
+
+            pPhysicsScene->SetInterpolationEnabled(m_interpolation);
         }
 
         pScene->GetDataStorage().SetValue(pRenderScene);
@@ -103,11 +124,15 @@ namespace SR_CORE_NS {
     }
 
     void EngineScene::SetActive(bool active) {
-        pSceneUpdater->SetDirty();
+        if (pSceneUpdater) {
+            pSceneUpdater->SetDirty();
+        }
     }
 
     void EngineScene::SetPaused(bool pause) {
-        pSceneUpdater->SetDirty();
+        if (pSceneUpdater) {
+            pSceneUpdater->SetDirty();
+        }
     }
 
     void EngineScene::SetGameMode(bool gameMode) {
@@ -141,34 +166,79 @@ namespace SR_CORE_NS {
         pScene.Unlock();
     }
 
+    bool EngineScene::LoadSimulationSettings(const SR_UTILS_NS::Path& path) {
+        if (!path.Exists(SR_UTILS_NS::Path::Type::File)) {
+            return false;
+        }
+
+        auto&& document = SR_XML_NS::Document::Load(path);
+        if (!document.Valid()) {
+            SR_ERROR("EngineScene::LoadSimulationSettings() : failed to load xml document!\n\tPath: " + path.ToString());
+            return false;
+        }
+
+        auto&& rootNode = document.Root().GetNode("Simulation");
+
+        const int32_t tickRate = rootNode.TryGetNode("TickRate").TryGetAttribute("Value").ToInt(static_cast<int32_t>(1.f / m_fixedStep + 0.5f));
+        if (tickRate > 0) {
+            m_fixedStep = 1.f / static_cast<float_t>(tickRate);
+        }
+        else {
+            SR_WARN("EngineScene::LoadSimulationSettings() : invalid tick rate!\n\tPath: " + path.ToString());
+        }
+
+        m_maxSubSteps = static_cast<uint32_t>(SR_MAX(rootNode.TryGetNode("MaxSubSteps").TryGetAttribute("Value").ToInt(static_cast<int32_t>(m_maxSubSteps)), 1));
+        m_interpolation = rootNode.TryGetNode("Interpolation").TryGetAttribute("Value").ToBool(m_interpolation);
+
+        return true;
+    }
+
     void EngineScene::UpdateFrequency() {
-        const uint32_t framesPerSecond = 60;
-        m_updateFrequency = (1.f / (static_cast<float_t>(framesPerSecond) * m_speed));
+        m_updateFrequency = m_fixedStep / m_speed;
     }
 
     void EngineScene::FixedStep(bool isPaused) {
         SR_TRACY_ZONE;
         SR_TRACY_ZONE_TEXT(SR_UTILS_NS::ToString(m_accumulator));
 
+        /// the step is started before the scripts and stays in flight while they run (see PhysicsScene),
+        /// it is ended by PhysicsSimulationState and the results are applied by PhysicsSynchronizationState.
+        /// Only one step is in flight, the next ones of the frame are left to PhysicsSimulationState as well,
+        /// otherwise starting them would wait for the previous one here.
         if (!isPaused && pPhysicsScene) {
-            pPhysicsScene->FixedUpdate();
+            pPhysicsScene->RequestStep(m_fixedStep);
+
+            if (!pPhysicsScene->IsStepInFlight()) {
+                pPhysicsScene->BeginStep();
+            }
         }
 
         pEngine->FixedUpdate();
 
+        const auto start = std::chrono::steady_clock::now();
         pSceneUpdater->FixedUpdate(isPaused);
+        m_scriptTime += std::chrono::duration<double_t, std::milli>(std::chrono::steady_clock::now() - start).count();
     }
 
     void EngineScene::Update(float_t dt) {
         SR_TRACY_ZONE;
 
+        /// every frame, the scene logic finishes the loading of the chunks and the objects here, not only after ChunkSystem
         pScene->GetLogicBase()->PostLoad();
         pScene->Prepare();
 
         const bool isPaused = pEngine->IsPaused() || !pEngine->IsActive() || pEngine->HasSceneInQueue();
 
         pSceneUpdater->Build(isPaused);
+
+        m_scriptTime = 0.0;
+
+        /// TODO: the components are still updated one by one on this thread. The batches (by root object or by
+        ///  component type) have to be built by SceneUpdater (Utils) and run on Engine::GetJobSystem(), with the
+        ///  add/remove/destroy of the batches merged in a fixed order after Update, FixedUpdate and LateUpdate.
+        auto start = std::chrono::steady_clock::now();
         pSceneUpdater->Update(dt, isPaused);
+        m_scriptTime += std::chrono::duration<double_t, std::milli>(std::chrono::steady_clock::now() - start).count();
 
         UpdateFrequency();
 
@@ -179,18 +249,43 @@ namespace SR_CORE_NS {
             m_accumulator += SR_MIN(dt, m_updateFrequency);
         }
 
+        /// after a long frame never simulate more than m_maxSubSteps, the rest of the time is dropped
+        m_accumulator = SR_MIN(m_accumulator, m_updateFrequency * static_cast<float_t>(m_maxSubSteps));
+
         /// fixed update
-        if (m_accumulator >= m_updateFrequency)
-        {
-            while (m_accumulator >= m_updateFrequency)
-            {
-                FixedStep(isPaused);
-                m_accumulator -= m_updateFrequency;
-            }
+        for (uint32_t subStep = 0; subStep < m_maxSubSteps && m_accumulator >= m_updateFrequency; ++subStep) {
+            FixedStep(isPaused);
+            m_accumulator -= m_updateFrequency;
         }
 
+        m_interpolationAlpha = SR_MAX(0.f, SR_MIN(m_accumulator / m_updateFrequency, 1.f));
+        SR_TRACY_PLOT("Interpolation alpha", m_interpolationAlpha);
+
+        start = std::chrono::steady_clock::now();
         pSceneUpdater->LateUpdate(isPaused);
+        m_scriptTime += std::chrono::duration<double_t, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        /// the scripts have seen the simulated poses, the interpolated ones are only drawn.
+        /// PrepareState restores the simulated poses before the next frame
+        if (pPhysicsScene && !isPaused) {
+            pPhysicsScene->Interpolate(m_interpolationAlpha);
+        }
+
+        PushScriptTime();
 
         pEngine->SetOneFramePauseSkip(false);
     }
+
+    void EngineScene::PushScriptTime() {
+        /// the timings are created after the startup scene
+        if (!m_scriptTimings) {
+            auto&& pTimings = pEngine->GetStateTimings();
+            if (!pTimings) {
+                return;
+            }
+            m_scriptTimings = pTimings->GetBuffer("Scripts");
+        }
+
+        m_scriptTimings->Push(m_scriptTime);
+    }
 }
\ No newline at end of file
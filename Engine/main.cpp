@@ -23,6 +23,12 @@ int main(int argc, char** argv) {
         return 10;
     }
 
+    if (SR_UTILS_NS::HasCmdOption(argv, argv + argc, "--benchmark")) {
+        const int32_t code = SR_CORE_NS::TestManager::Instance().RunBenchmark(argc, argv);
+        SR_HTYPES_NS::SharedPtrDynamicDataCounter::CheckMemoryLeaks();
+        return code;
+    }
+
     if (SR_UTILS_NS::HasCmdOption(argv, argv + argc, "--unit-tests")) {
         SR_CORE_NS::TestManager::Instance().AddTest([]() {
             return SR_CORE_NS::Tests::AtlasBuilderTest::Run();
@@ -7,57 +7,73 @@
 
 #include <Libraries/Utils/Allocator.h>
 #include <Libraries/Types/Behaviour.h>
+#include <Libraries/Math/Quaternion.h>
 
 #include <Libraries/Debug.h>
 #include <Libraries/Input.h>
+#include <Libraries/Component.h>
+#include <Libraries/CharacterController3D.h>
+#include <Libraries/Casts.h>
 
+/// Drives the CharacterController3D component of the game object, the moves are executed by the next physics step.
 class CharacterController : public Behaviour {
 public:
-    void FixedUpdate() override {
-        if (!transform) {
+    void Update(float_t dt) override {
+        if (!gameObject || !transform) {
             return;
         }
 
-        float_t _speed = Input::GetKey(KeyCode::LShift) ? speed * 5.0f : speed;
+        auto&& pController = DynamicCastComponentToCharacterController3D(gameObject->GetComponent("CharacterController3D"));
+        if (!pController) {
+            return;
+        }
+
+        if (Input::GetMouse(MouseCode::MouseRight)) {
+            auto&& drag = Input::GetMouseDrag();
+            transform->Rotate(FVector3(0.f, drag.x * (rotateSpeed / 10.f), 0.f));
+        }
+
+        auto&& q = Quaternion(transform->GetRotation().Radians());
+        const float_t _speed = Input::GetKey(KeyCode::LShift) ? speed * 2.f : speed;
+
+        FVector3 direction;
 
         if (Input::GetKey(KeyCode::W)) {
-            velocity += FVector3(0, 0, (_speed / 250.f));
+            direction += q * FVector3(0, 0, 1);
         }
 
         if (Input::GetKey(KeyCode::S)) {
-            velocity -= FVector3(0, 0, (_speed / 250.f));
+            direction -= q * FVector3(0, 0, 1);
         }
 
         if (Input::GetKey(KeyCode::A)) {
-            velocity -= FVector3((_speed / 250.f), 0, 0);
+            direction -= q * FVector3(1, 0, 0);
         }
 
         if (Input::GetKey(KeyCode::D)) {
-            velocity += FVector3((_speed / 250.f), 0, 0);
+            direction += q * FVector3(1, 0, 0);
         }
 
-        if (Input::GetMouse(MouseCode::MouseRight)) {
-            auto&& drag = Input::GetMouseDrag();
+        /// the controller keeps to the ground, the moves are horizontal
+        direction.y = 0.f;
 
-            drag *= (rotateSpeed / 25.f);
+        pController->Move(direction * (_speed * dt));
 
-            transform->GlobalRotate(FVector3(drag.y, drag.x, 0.f));
+        if (Input::GetKeyDown(KeyCode::Space) && pController->IsGrounded()) {
+            pController->SetVerticalVelocity(jumpVelocity);
         }
-
-        transform->Translate(velocity);
-
-        velocity = velocity / 1.025f;
     }
 
 private:
-    FVector3 velocity;
-
     SR_PROPERTY(speed)
-    float_t speed = 1.f;
+    float_t speed = 3.f;
 
     SR_PROPERTY(rotateSpeed)
     float_t rotateSpeed = 1.f;
 
+    SR_PROPERTY(jumpVelocity)
+    float_t jumpVelocity = 5.f;
+
 };
 
 #endif //SR_ENGINE_CHARACTER_CONTROLLER_H